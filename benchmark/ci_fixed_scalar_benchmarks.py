@@ -112,3 +112,24 @@ def test_fixed_scalar_abs_long(benchmark):
     a = APyFixed.from_float(np.random.rand(1)[0] - 0.5, bits=200, int_bits=1)
 
     benchmark(abs, a)
+
+
+def _fixed_scalar_accumulate(x, y):
+    acc = x
+    for _ in range(100):
+        acc = (acc + x * y).cast(int_bits=x.int_bits + 4, frac_bits=x.frac_bits)
+    return acc
+
+
+def test_fixed_scalar_loop_short(benchmark):
+    a = APyFixed.from_float(np.random.rand(1)[0] - 0.5, bits=20, int_bits=1)
+    b = APyFixed.from_float(np.random.rand(1)[0] - 0.5, bits=20, int_bits=1)
+
+    benchmark(_fixed_scalar_accumulate, a, b)
+
+
+def test_fixed_scalar_loop_long(benchmark):
+    a = APyFixed.from_float(np.random.rand(1)[0] - 0.5, bits=200, int_bits=1)
+    b = APyFixed.from_float(np.random.rand(1)[0] - 0.5, bits=200, int_bits=1)
+
+    benchmark(_fixed_scalar_accumulate, a, b)
@@ -81,3 +81,24 @@ def test_float_scalar_to_float_short(benchmark):
     a = APyFloat.from_float(np.random.rand(1)[0] - 0.5, 4, 7)
 
     benchmark(float, a)
+
+
+def _float_scalar_accumulate(x, y):
+    acc = x
+    for _ in range(100):
+        acc = acc + x * y
+    return acc
+
+
+def test_float_scalar_loop_short(benchmark):
+    a = APyFloat.from_float(np.random.rand(1)[0] - 0.5, 4, 7)
+    b = APyFloat.from_float(np.random.rand(1)[0] - 0.5, 4, 7)
+
+    benchmark(_float_scalar_accumulate, a, b)
+
+
+def test_float_scalar_loop_long(benchmark):
+    a = APyFloat.from_float(np.random.rand(1)[0] - 0.5, 16, 60)
+    b = APyFloat.from_float(np.random.rand(1)[0] - 0.5, 16, 60)
+
+    benchmark(_float_scalar_accumulate, a, b)
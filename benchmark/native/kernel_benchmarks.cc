@@ -0,0 +1,512 @@
+/*
+ * Native micro-benchmarks for the APyTypes arithmetic kernels.
+ *
+ * The kernels are called directly from C++, without going through the Python
+ * interpreter or nanobind argument conversion, and are swept over problem sizes and
+ * word lengths. Results are printed as a table and can optionally be written as JSON:
+ *
+ *     meson compile -C build apytypes_kernel_benchmarks
+ *     ./build/apytypes_kernel_benchmarks --json kernels.json
+ *
+ * Command line options:
+ *     --json <file>       Write results as JSON to `<file>`
+ *     --filter <string>   Only run benchmarks whose name contains `<string>`
+ *     --min-time <sec>    Minimum measurement time per benchmark (default: 0.1)
+ *     --quick             Only run the smallest size of each sweep
+ *
+ * No Python interpreter is initialized: the benchmark arrays are constructed from
+ * random limbs and fields through the C++-only constructors, and the kernels never
+ * release the GIL since it is not held.
+ */
+
+#include <algorithm>  // std::min
+#include <chrono>     // std::chrono::steady_clock
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <cstdio>     // std::FILE, std::fopen
+#include <cstring>    // std::strcmp
+#include <functional> // std::function
+#include <random>     // std::mt19937_64
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+#include <fmt/format.h>
+
+#include "../../src/apyfixed_util.h"
+#include "../../src/apyfixedarray.h"
+#include "../../src/apyfloat_util.h"
+#include "../../src/apyfloatarray.h"
+#include "../../src/apytypes_allocator.h"
+#include "../../src/apytypes_common.h"
+#include "../../src/apytypes_simd.h"
+#include "../../src/apytypes_util.h"
+
+/*
+ * GMP should be included after all other includes
+ */
+#include "../../extern/mini-gmp/mini-gmp.h"
+
+/* ********************************************************************************** *
+ * *                             Benchmark infrastructure                           * *
+ * ********************************************************************************** */
+
+//! Prevent the compiler from optimizing away the computation of `value`
+template <typename T> static APY_INLINE void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+//! Named sweep parameter of a benchmark, e.g., `{ "bits", 64 }`
+struct BenchmarkArg {
+    template <typename T>
+    BenchmarkArg(const char* key, T value)
+        : key { key }
+        , value { static_cast<long long>(value) }
+    {
+    }
+    std::string key;
+    long long value;
+};
+
+//! Measured result of a single benchmark
+struct BenchmarkResult {
+    std::string name;               // Kernel name
+    std::vector<BenchmarkArg> args; // Sweep parameters
+    std::size_t items;              // Elements per iteration
+    std::size_t bytes;              // Bytes processed per iteration
+    std::size_t iterations;         // Number of timed iterations
+    double ns_per_iteration;        // Mean time per iteration
+};
+
+struct BenchmarkOptions {
+    std::string json_path;
+    std::string filter;
+    double min_time = 0.1;
+    bool quick = false;
+};
+
+static std::vector<BenchmarkResult> results;
+static BenchmarkOptions options;
+
+/*!
+ * Time `fn`, doubling the number of iterations until the measurement takes at least
+ * `options.min_time` seconds, and store the result.
+ */
+static void run_benchmark(
+    const std::string& name,
+    std::vector<BenchmarkArg> args,
+    std::size_t items,
+    std::size_t bytes,
+    const std::function<void()>& fn
+)
+{
+    if (name.find(options.filter) == std::string::npos) {
+        return;
+    }
+
+    using clock = std::chrono::steady_clock;
+    fn(); // Warm-up
+    std::size_t iterations = 1;
+    double elapsed = 0.0;
+    for (;;) {
+        auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            fn();
+        }
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        if (elapsed >= options.min_time || iterations >= (std::size_t(1) << 40)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    BenchmarkResult result { name, std::move(args), items, bytes, iterations,
+                             elapsed * 1e9 / double(iterations) };
+    std::string arg_str;
+    for (const auto& arg : result.args) {
+        arg_str += fmt::format("{}={} ", arg.key, arg.value);
+    }
+    fmt::print(
+        "{:<32} {:<40} {:>14.1f} ns {:>10.3e} items/s\n",
+        result.name,
+        arg_str,
+        result.ns_per_iteration,
+        double(items) * 1e9 / result.ns_per_iteration
+    );
+    results.push_back(std::move(result));
+}
+
+//! Write all results as JSON to `path`
+static void write_json(const std::string& path)
+{
+    std::string json = "{\n  \"context\": {\n";
+    json += fmt::format("    \"simd\": \"{}\",\n", simd::get_simd_version_str());
+    json += fmt::format("    \"limb_bits\": {},\n", _LIMB_SIZE_BITS);
+    json += fmt::format("    \"min_time\": {}\n", options.min_time);
+    json += "  },\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        json += fmt::format("    {{\"name\": \"{}\", \"args\": {{", r.name);
+        for (std::size_t j = 0; j < r.args.size(); j++) {
+            json += fmt::format(
+                "{}\"{}\": {}", j ? ", " : "", r.args[j].key, r.args[j].value
+            );
+        }
+        json += fmt::format(
+            "}}, \"iterations\": {}, \"ns_per_iteration\": {:.3f}, "
+            "\"items_per_second\": {:.6e}, \"bytes_per_second\": {:.6e}}}{}\n",
+            r.iterations,
+            r.ns_per_iteration,
+            double(r.items) * 1e9 / r.ns_per_iteration,
+            double(r.bytes) * 1e9 / r.ns_per_iteration,
+            i + 1 < results.size() ? "," : ""
+        );
+    }
+    json += "  ]\n}\n";
+
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        throw std::runtime_error(fmt::format("could not open '{}' for writing", path));
+    }
+    std::fputs(json.c_str(), file);
+    std::fclose(file);
+}
+
+//! Sweep values, or only the first one in `--quick` mode
+template <typename T> static std::vector<T> sweep(std::vector<T> values)
+{
+    if (options.quick) {
+        values.resize(1);
+    }
+    return values;
+}
+
+static std::mt19937_64 rng(0x41505954);
+
+//! Random limb vector of `n` limbs
+static APyLimbVector random_limbs(std::size_t n)
+{
+    APyLimbVector result(n);
+    for (auto& limb : result) {
+        limb = mp_limb_t(rng());
+    }
+    return result;
+}
+
+//! Random `APyFixedArray` with shape `(rows, cols)`, or `(cols,)` if `rows == 0`
+static APyFixedArray random_fixed_array(std::size_t rows, std::size_t cols, int bits)
+{
+    std::vector<std::size_t> shape = { cols };
+    if (rows) {
+        shape = { rows, cols };
+    }
+    const std::size_t n = (rows ? rows : 1) * cols;
+    return APyFixedArray(shape, bits, bits / 2, random_limbs(n * bits_to_limbs(bits)));
+}
+
+//! Random normal `APyFloatArray` with shape `(rows, cols)`, or `(cols,)` if `rows == 0`
+static APyFloatArray random_float_array(
+    std::size_t rows, std::size_t cols, int exp_bits, int man_bits
+)
+{
+    std::vector<std::size_t> shape = { cols };
+    if (rows) {
+        shape = { rows, cols };
+    }
+    APyFloatArray result(shape, exp_bits, man_bits);
+    const exp_t bias = result.bias;
+    for (auto& element : result.data) {
+        element.sign = rng() & 1;
+        // Exponents close to the bias, to avoid overflow in the results
+        element.exp = bias - 2 + rng() % 5;
+        element.man = rng() & ((man_t(1) << man_bits) - 1);
+    }
+    return result;
+}
+
+/* ********************************************************************************** *
+ * *                                 SIMD kernels                                   * *
+ * ********************************************************************************** */
+
+static void benchmark_simd()
+{
+    for (std::size_t n : sweep<std::size_t>({ 64, 1024, 16384, 262144 })) {
+        auto src1 = random_limbs(n);
+        auto src2 = random_limbs(n);
+        APyLimbVector dst(n);
+        const std::size_t bytes = 3 * n * sizeof(mp_limb_t);
+        const std::vector<BenchmarkArg> args = { { "n", n } };
+
+        run_benchmark("simd::vector_add", args, n, bytes, [&]() {
+            simd::vector_add(src1.cbegin(), src2.cbegin(), dst.begin(), n);
+            do_not_optimize(dst[0]);
+        });
+        run_benchmark("simd::vector_sub", args, n, bytes, [&]() {
+            simd::vector_sub(src1.cbegin(), src2.cbegin(), dst.begin(), n);
+            do_not_optimize(dst[0]);
+        });
+        run_benchmark("simd::vector_mul", args, n, bytes, [&]() {
+            simd::vector_mul(src1.cbegin(), src2.cbegin(), dst.begin(), n);
+            do_not_optimize(dst[0]);
+        });
+        run_benchmark("simd::vector_shift_add", args, n, bytes, [&]() {
+            simd::vector_shift_add(src1.cbegin(), src2.cbegin(), dst.begin(), 3, 5, n);
+            do_not_optimize(dst[0]);
+        });
+        const std::size_t unary_bytes = 2 * n * sizeof(mp_limb_t);
+        run_benchmark("simd::vector_mul_const", args, n, unary_bytes, [&]() {
+            simd::vector_mul_const(src1.cbegin(), mp_limb_t(12345), dst.begin(), n);
+            do_not_optimize(dst[0]);
+        });
+        run_benchmark(
+            "simd::vector_multiply_accumulate",
+            args,
+            n,
+            2 * n * sizeof(mp_limb_t),
+            [&]() {
+                auto acc
+                    = simd::vector_multiply_accumulate(src1.cbegin(), src2.cbegin(), n);
+                do_not_optimize(acc);
+            }
+        );
+    }
+}
+
+/* ********************************************************************************** *
+ * *                           Quantization and overflow                            * *
+ * ********************************************************************************** */
+
+static void benchmark_quantize_overflow()
+{
+    const std::size_t n = options.quick ? 256 : 4096;
+    const std::vector<std::pair<const char*, QuantizationMode>> q_modes = {
+        { "TRN", QuantizationMode::TRN },
+        { "RND_INF", QuantizationMode::RND_INF },
+        { "RND_CONV", QuantizationMode::RND_CONV },
+        { "JAM", QuantizationMode::JAM },
+    };
+    const std::vector<std::pair<const char*, OverflowMode>> v_modes = {
+        { "WRAP", OverflowMode::WRAP },
+        { "SAT", OverflowMode::SAT },
+    };
+
+    for (int bits : sweep<int>({ 16, 64, 128, 256, 1000 })) {
+        const std::size_t limbs = bits_to_limbs(bits);
+        const int int_bits = bits / 2;
+        const auto src = random_limbs(n * limbs);
+        APyLimbVector work(n * limbs);
+        const std::size_t bytes = 2 * n * limbs * sizeof(mp_limb_t);
+
+        for (std::size_t q = 0; q < q_modes.size(); q++) {
+            const auto mode = q_modes[q].second;
+            run_benchmark(
+                fmt::format("quantize::{}", q_modes[q].first),
+                { { "n", n }, { "bits", bits }, { "drop_bits", 8 } },
+                n,
+                bytes,
+                [&]() {
+                    std::copy(src.cbegin(), src.cend(), work.begin());
+                    for (std::size_t i = 0; i < n; i++) {
+                        auto begin = work.begin() + i * limbs;
+                        quantize(
+                            begin,
+                            begin + limbs,
+                            bits,
+                            int_bits,
+                            bits - 8,
+                            int_bits,
+                            mode
+                        );
+                    }
+                    do_not_optimize(work[0]);
+                }
+            );
+        }
+
+        for (std::size_t v = 0; v < v_modes.size(); v++) {
+            const auto mode = v_modes[v].second;
+            run_benchmark(
+                fmt::format("overflow::{}", v_modes[v].first),
+                { { "n", n }, { "bits", bits }, { "drop_bits", 4 } },
+                n,
+                bytes,
+                [&]() {
+                    std::copy(src.cbegin(), src.cend(), work.begin());
+                    for (std::size_t i = 0; i < n; i++) {
+                        auto begin = work.begin() + i * limbs;
+                        overflow(begin, begin + limbs, bits - 4, int_bits - 4, mode);
+                    }
+                    do_not_optimize(work[0]);
+                }
+            );
+        }
+    }
+}
+
+/* ********************************************************************************** *
+ * *                             Fixed-point products                               * *
+ * ********************************************************************************** */
+
+static void benchmark_fixedpoint_product()
+{
+    const std::size_t n = options.quick ? 256 : 4096;
+    for (int bits : sweep<int>({ 64, 128, 256, 512, 2048 })) {
+        const std::size_t limbs = bits_to_limbs(bits);
+        const auto src1 = random_limbs(n * limbs);
+        const auto src2 = random_limbs(n * limbs);
+        APyLimbVector dst(2 * n * limbs);
+        APyLimbVector op1_abs(limbs), op2_abs(limbs), prod_abs(2 * limbs);
+        run_benchmark(
+            "fixedpoint_product",
+            { { "n", n }, { "bits", bits } },
+            n,
+            4 * n * limbs * sizeof(mp_limb_t),
+            [&]() {
+                for (std::size_t i = 0; i < n; i++) {
+                    fixedpoint_product(
+                        src1.cbegin() + i * limbs,
+                        src2.cbegin() + i * limbs,
+                        dst.begin() + 2 * i * limbs,
+                        limbs,
+                        limbs,
+                        2 * limbs,
+                        op1_abs,
+                        op2_abs,
+                        prod_abs
+                    );
+                }
+                do_not_optimize(dst[0]);
+            }
+        );
+    }
+}
+
+/* ********************************************************************************** *
+ * *                                Array kernels                                   * *
+ * ********************************************************************************** */
+
+//! Fixed-point `_checked_2d_matmul` and elementwise product, through their public
+//! entry points
+static void benchmark_fixed_array()
+{
+    for (int bits : sweep<int>({ 16, 40, 64, 200 })) {
+        for (std::size_t n : sweep<std::size_t>({ 16, 64, 128 })) {
+            const auto a = random_fixed_array(n, n, bits);
+            const auto b = random_fixed_array(n, n, bits);
+            const std::size_t limbs = bits_to_limbs(bits);
+            run_benchmark(
+                "APyFixedArray::_checked_2d_matmul",
+                { { "n", n }, { "bits", bits } },
+                n * n * n,
+                3 * n * n * limbs * sizeof(mp_limb_t),
+                [&]() { do_not_optimize(a.matmul(b)); }
+            );
+            run_benchmark(
+                "APyFixedArray::operator*",
+                { { "n", n * n }, { "bits", bits } },
+                n * n,
+                3 * n * n * limbs * sizeof(mp_limb_t),
+                [&]() { do_not_optimize(a * b); }
+            );
+        }
+    }
+}
+
+//! Floating-point elementwise product, inner product, and 2-D matrix multiplication,
+//! through their public entry points. The rows are named after the kernels that run:
+//! standard formats multiply with native floating-point arithmetic, and the other
+//! formats with the vectorized `FloatProductKernel`. Inner products and matrix
+//! products run the fused `FloatDotKernel`.
+static void benchmark_float_array()
+{
+    const std::vector<std::pair<int, int>> formats
+        = { { 5, 10 }, { 8, 23 }, { 11, 52 }, { 6, 9 } };
+    for (auto [exp_bits, man_bits] : sweep(formats)) {
+        for (std::size_t n : sweep<std::size_t>({ 1024, 16384 })) {
+            const auto a = random_float_array(0, n, exp_bits, man_bits);
+            const auto b = random_float_array(0, n, exp_bits, man_bits);
+            const bool is_native
+                = native_float_format(exp_bits, man_bits, a.get_bias())
+                != NativeFloatFormat::NONE;
+            const std::vector<BenchmarkArg> args
+                = { { "n", n }, { "exp_bits", exp_bits }, { "man_bits", man_bits } };
+            run_benchmark(
+                is_native ? "APyFloatArray::operator* (native)"
+                          : "APyFloatArray::operator* (FloatProductKernel)",
+                args,
+                n,
+                3 * n * sizeof(APyFloatData),
+                [&]() { do_not_optimize(a * b); }
+            );
+            run_benchmark(
+                "APyFloatArray::matmul 1-D (FloatDotKernel)",
+                args,
+                n,
+                2 * n * sizeof(APyFloatData),
+                [&]() { do_not_optimize(a.matmul(b)); }
+            );
+        }
+        for (std::size_t n : sweep<std::size_t>({ 16, 64 })) {
+            const auto a = random_float_array(n, n, exp_bits, man_bits);
+            const auto b = random_float_array(n, n, exp_bits, man_bits);
+            run_benchmark(
+                "APyFloatArray::matmul 2-D (FloatDotKernel)",
+                { { "n", n }, { "exp_bits", exp_bits }, { "man_bits", man_bits } },
+                n * n * n,
+                3 * n * n * sizeof(APyFloatData),
+                [&]() { do_not_optimize(a.matmul(b)); }
+            );
+        }
+    }
+}
+
+/* ********************************************************************************** *
+ * *                                     Main                                       * *
+ * ********************************************************************************** */
+
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--json") && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (!std::strcmp(argv[i], "--min-time") && i + 1 < argc) {
+            options.min_time = std::stod(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--quick")) {
+            options.quick = true;
+        } else {
+            fmt::print(
+                stderr,
+                "Usage: {} [--json FILE] [--filter STRING] [--min-time SECONDS] "
+                "[--quick]\n",
+                argv[0]
+            );
+            return 1;
+        }
+    }
+
+    int status = 0;
+    try {
+        fmt::print("{}\n", simd::get_simd_version_str());
+        benchmark_simd();
+        benchmark_quantize_overflow();
+        benchmark_fixedpoint_product();
+        benchmark_fixed_array();
+        benchmark_float_array();
+        if (!options.json_path.empty()) {
+            write_json(options.json_path);
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "error: {}\n", e.what());
+        status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,355 @@
+"""
+Benchmark sweep harness for APyTypes arrays.
+
+Sweeps array operations over size x bits x int_bits x quantization x op x threads for
+both fixed-point and floating-point arrays. It reports elements/s and bytes/s, and can
+compare the results against a stored baseline.
+
+Usage::
+
+    # Run the sweep and store the results
+    python benchmark/sweep.py run -o results.json
+
+    # Compare against a baseline, exit with status 1 on regressions larger than 10 %
+    python benchmark/sweep.py compare results.json baseline.json --threshold 0.10
+
+    # Plot throughput scaling over the array size
+    python benchmark/sweep.py plot results.json -o performancescale.png
+
+The bytes/s figure counts the bytes of all operands and the result, based on the
+in-memory size of each element (whole limbs for fixed-point, 16 bytes for
+floating-point).
+"""
+
+import argparse
+import contextlib
+import itertools
+import json
+import math
+import platform
+import sys
+import time
+import timeit
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import apytypes
+from apytypes import (
+    APyFixedArray,
+    APyFloatArray,
+    APyFloatQuantizationContext,
+    QuantizationMode,
+)
+
+DEFAULT_SIZES = [10, 100, 1000, 10000, 100000]
+DEFAULT_FIXED_BITS = [16, 32, 63, 64, 65, 128, 300]
+DEFAULT_FLOAT_FORMATS = [(5, 10), (8, 7), (8, 23), (11, 52)]
+DEFAULT_QUANTIZATIONS = ["TRN", "RND_CONV"]
+DEFAULT_THREADS = [1]
+
+FIXED_OPS = {
+    "add": (2, lambda a, b, q: a + b),
+    "mul": (2, lambda a, b, q: a * b),
+    "matmul": (2, lambda a, b, q: a @ b),
+    "sum": (1, lambda a, b, q: a.sum()),
+    "cast": (
+        1,
+        lambda a, b, q: a.cast(
+            int_bits=a.int_bits, frac_bits=a.bits - a.int_bits - 4, quantization=q
+        ),
+    ),
+}
+
+FLOAT_OPS = {
+    "add": (2, lambda a, b, q: a + b),
+    "mul": (2, lambda a, b, q: a * b),
+    "matmul": (2, lambda a, b, q: a @ b),
+    "sum": (1, lambda a, b, q: a.sum()),
+    "cast": (1, lambda a, b, q: a.cast(a.exp_bits, a.man_bits - 2, quantization=q)),
+}
+
+# Operations for which the quantization mode matters
+FIXED_QUANTIZED_OPS = {"cast"}
+FLOAT_QUANTIZED_OPS = set(FLOAT_OPS)
+
+
+def _operand_shape(op, n):
+    """Matrix multiplications use square matrices with about `n` elements."""
+    if op == "matmul":
+        side = max(1, math.isqrt(n))
+        return (side, side)
+    return (n,)
+
+
+def _time(fn, threads, min_time, context=contextlib.nullcontext):
+    """
+    Best time per call of `fn`, run concurrently on `threads` threads. Each thread
+    calls `fn` inside its own `context()`, as the APyTypes contexts are thread-local.
+    """
+    if threads == 1:
+        with context():
+            number, _ = timeit.Timer(fn).autorange()
+            return min(timeit.Timer(fn).repeat(repeat=3, number=number)) / number
+
+    with ThreadPoolExecutor(max_workers=threads) as pool:
+
+        def run(number):
+            with context():
+                for _ in range(number):
+                    fn()
+
+        number = 1
+        while True:
+            start = time.perf_counter()
+            list(pool.map(run, [number] * threads))
+            elapsed = time.perf_counter() - start
+            if elapsed >= min_time:
+                # Aggregate throughput: `threads * number` calls in `elapsed` seconds
+                return elapsed / (threads * number)
+            number *= 2
+
+
+def _fixed_cases(args, rng):
+    for op, n, bits in itertools.product(args.ops, args.sizes, args.fixed_bits):
+        if op not in FIXED_OPS:
+            continue
+        int_bits_list = args.int_bits or [bits // 2]
+        quantizations = args.quantizations if op in FIXED_QUANTIZED_OPS else [None]
+        for int_bits, q in itertools.product(int_bits_list, quantizations):
+            if not 0 <= int_bits <= bits or (op == "cast" and bits - int_bits < 4):
+                continue
+            shape = _operand_shape(op, n)
+            frac_bits = bits - int_bits
+            scale = 2.0 ** min(int_bits - 1, 30)
+            a, b = (
+                APyFixedArray.from_float(
+                    (rng.random(shape) - 0.5) * scale,
+                    int_bits=int_bits,
+                    frac_bits=frac_bits,
+                )
+                for _ in range(2)
+            )
+            elem_bytes = 8 * math.ceil(bits / 64)
+            yield {
+                "kind": "fixed",
+                "op": op,
+                "n": int(np.prod(shape)),
+                "bits": bits,
+                "int_bits": int_bits,
+                "quantization": q,
+            }, a, b, elem_bytes, FIXED_OPS[op]
+
+
+def _float_cases(args, rng):
+    for op, n, (exp_bits, man_bits) in itertools.product(
+        args.ops, args.sizes, args.float_formats
+    ):
+        if op not in FLOAT_OPS:
+            continue
+        quantizations = args.quantizations if op in FLOAT_QUANTIZED_OPS else [None]
+        for q in quantizations:
+            shape = _operand_shape(op, n)
+            a, b = (
+                APyFloatArray.from_float(rng.random(shape) - 0.5, exp_bits, man_bits)
+                for _ in range(2)
+            )
+            yield {
+                "kind": "float",
+                "op": op,
+                "n": int(np.prod(shape)),
+                "bits": 1 + exp_bits + man_bits,
+                "exp_bits": exp_bits,
+                "man_bits": man_bits,
+                "quantization": q,
+            }, a, b, 16, FLOAT_OPS[op]
+
+
+def run(args):
+    rng = np.random.default_rng(0)
+    results = []
+    cases = []
+    if "fixed" in args.kinds:
+        cases.append(_fixed_cases(args, rng))
+    if "float" in args.kinds:
+        cases.append(_float_cases(args, rng))
+
+    for case, a, b, elem_bytes, (n_operands, fn) in itertools.chain(*cases):
+        q = getattr(QuantizationMode, case["quantization"] or "RND_CONV")
+
+        def call(a=a, b=b, q=q, fn=fn):
+            return fn(a, b, q)
+
+        def context(q=q, kind=case["kind"]):
+            if kind == "float":
+                return APyFloatQuantizationContext(q)
+            return contextlib.nullcontext()
+
+        for threads in args.threads:
+            seconds = _time(call, threads, args.min_time, context)
+            n = case["n"]
+            result = dict(case)
+            result["threads"] = threads
+            result["seconds"] = seconds
+            result["elements_per_second"] = n / seconds
+            result["bytes_per_second"] = (n_operands + 1) * n * elem_bytes / seconds
+            results.append(result)
+            print(
+                f"{result['kind']:>5} {result['op']:>6} n={n:<7} "
+                f"bits={result['bits']:<4} q={str(result['quantization']):<8} "
+                f"threads={threads:<2} {result['elements_per_second']:10.3e} elem/s "
+                f"{result['bytes_per_second']:10.3e} B/s"
+            )
+
+    output = {
+        "context": {
+            "apytypes": apytypes.__version__,
+            "simd": apytypes._get_simd_version_str(),
+            "python": sys.version,
+            "platform": platform.platform(),
+            "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        },
+        "results": results,
+    }
+    with open(args.output, "w") as f:
+        json.dump(output, f, indent=1)
+    print(f"Wrote {len(results)} results to {args.output}")
+
+
+_KEY_FIELDS = (
+    "kind",
+    "op",
+    "n",
+    "bits",
+    "int_bits",
+    "exp_bits",
+    "man_bits",
+    "quantization",
+    "threads",
+)
+
+
+def _key(result):
+    return tuple(result.get(field) for field in _KEY_FIELDS)
+
+
+def compare(args):
+    with open(args.results) as f:
+        current = {_key(r): r for r in json.load(f)["results"]}
+    with open(args.baseline) as f:
+        baseline = {_key(r): r for r in json.load(f)["results"]}
+
+    regressions = 0
+    for key in sorted(current.keys() & baseline.keys(), key=str):
+        ratio = (
+            current[key]["elements_per_second"] / baseline[key]["elements_per_second"]
+        )
+        regressed = ratio < 1.0 - args.threshold
+        regressions += regressed
+        if regressed or args.verbose:
+            desc = ", ".join(
+                f"{field}={value}"
+                for field, value in zip(_KEY_FIELDS, key)
+                if value is not None
+            )
+            print(f"{'REGRESSION' if regressed else 'ok':>10} {ratio:6.3f}x  {desc}")
+
+    missing = len(baseline.keys() - current.keys())
+    print(
+        f"{len(current.keys() & baseline.keys())} compared, {regressions} regressions "
+        f"(threshold {args.threshold:.1%}), {missing} baseline entries not measured"
+    )
+    return 1 if regressions else 0
+
+
+def plot(args):
+    import matplotlib.pyplot as plt
+
+    with open(args.results) as f:
+        results = json.load(f)["results"]
+
+    series = {}
+    for r in results:
+        if r["threads"] != 1 or r["quantization"] not in (None, "RND_CONV"):
+            continue
+        label = f"{r['kind']} {r['op']}, {r['bits']}-bit"
+        series.setdefault(label, []).append((r["n"], r["elements_per_second"]))
+
+    fig, ax = plt.subplots(layout="constrained", figsize=(8, 6.5))
+    for label, points in sorted(series.items()):
+        points.sort()
+        ax.plot(*zip(*points), label=label)
+    ax.set_xscale("log")
+    ax.set_yscale("log")
+    ax.set_ylabel("Elements/s")
+    ax.set_xlabel("Elements in array")
+    ax.legend(loc="upper left", fontsize="small")
+    ax.grid(True)
+    fig.savefig(args.output)
+
+
+def _float_format(s):
+    exp_bits, man_bits = s.split(",")
+    return int(exp_bits), int(man_bits)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_run = sub.add_parser("run", help="run the benchmark sweep")
+    p_run.add_argument("-o", "--output", default="sweep.json")
+    p_run.add_argument("--kinds", nargs="+", default=["fixed", "float"])
+    p_run.add_argument("--ops", nargs="+", default=list(FIXED_OPS))
+    p_run.add_argument("--sizes", nargs="+", type=int, default=DEFAULT_SIZES)
+    p_run.add_argument("--fixed-bits", nargs="+", type=int, default=DEFAULT_FIXED_BITS)
+    p_run.add_argument(
+        "--int-bits",
+        nargs="+",
+        type=int,
+        default=None,
+        help="fixed-point integer bits (default: bits // 2)",
+    )
+    p_run.add_argument(
+        "--float-formats",
+        nargs="+",
+        type=_float_format,
+        default=DEFAULT_FLOAT_FORMATS,
+        help="floating-point formats as exp_bits,man_bits",
+    )
+    p_run.add_argument("--quantizations", nargs="+", default=DEFAULT_QUANTIZATIONS)
+    p_run.add_argument("--threads", nargs="+", type=int, default=DEFAULT_THREADS)
+    p_run.add_argument(
+        "--min-time",
+        type=float,
+        default=0.2,
+        help="minimum measurement time in seconds for multi-threaded runs",
+    )
+
+    p_cmp = sub.add_parser("compare", help="compare results against a baseline")
+    p_cmp.add_argument("results")
+    p_cmp.add_argument("baseline")
+    p_cmp.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="relative slowdown reported as a regression (default: 0.10)",
+    )
+    p_cmp.add_argument("-v", "--verbose", action="store_true")
+
+    p_plot = sub.add_parser("plot", help="plot throughput over array size")
+    p_plot.add_argument("results")
+    p_plot.add_argument("-o", "--output", default="performancescale.png")
+
+    args = parser.parse_args(argv)
+    if args.command == "run":
+        run(args)
+    elif args.command == "compare":
+        return compare(args)
+    else:
+        plot(args)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
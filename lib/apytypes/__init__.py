@@ -16,6 +16,8 @@ from apytypes._apytypes import (
     get_float_quantization_seed,
     set_float_quantization_seed,
     _get_simd_version_str,
+    _get_allocator_stats,
+    _reset_allocator_stats,
 )
 
 from apytypes._array_functions import (
@@ -30,8 +32,17 @@ from apytypes._array_functions import (
     expand_dims,
 )
 
+from apytypes._io import save, load, LazyArray, _reduce_ex_fixed, _reduce_ex_float
+
+from apytypes._stream import stream, StreamingFIR
+
+from apytypes import profiling
+
 from apytypes._version import version as __version__
 
+APyFixedArray.__reduce_ex__ = _reduce_ex_fixed
+APyFloatArray.__reduce_ex__ = _reduce_ex_float
+
 __all__ = [
     "APyFixed",
     "APyFixedArray",
@@ -49,6 +60,8 @@ __all__ = [
     "get_float_quantization_seed",
     "set_float_quantization_seed",
     "_get_simd_version_str",
+    "_get_allocator_stats",
+    "_reset_allocator_stats",
     "squeeze",
     "convolve",
     "reshape",
@@ -58,6 +71,12 @@ __all__ = [
     "moveaxis",
     "swapaxes",
     "expand_dims",
+    "save",
+    "load",
+    "LazyArray",
+    "stream",
+    "StreamingFIR",
+    "profiling",
 ]
 
 APyFloat.__doc__ = r"""
@@ -202,6 +221,14 @@ Matrix multiplication using stochastic quantization and a wider accumulator
 >>> with APyFloatAccumulatorContext(exp_bits=6, man_bits=15, quantization=m):
 ...     d = A @ b.T
 
+Matrix multiplication with exact accumulation of the products, which are quantized
+once to the resulting format. This models fused dot-product hardware, and is
+supported for operands with at most 11 exponent bits, and at most 61 mantissa bits
+in total.
+
+>>> with APyFloatAccumulatorContext(exact=True):
+...     e = A @ b.T
+
 
 If no quantization mode is specified to the accumulator context it will fallback to the mode set globally,
 see :class:`APyFloatQuantizationContext`.
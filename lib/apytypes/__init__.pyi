@@ -3,7 +3,10 @@ import __future__
 from . import (
     _apytypes as _apytypes,
     _array_functions as _array_functions,
+    _io as _io,
+    _stream as _stream,
     _version as _version,
+    profiling as profiling,
 )
 from ._apytypes import (
     APyFixed as APyFixed,
@@ -16,7 +19,9 @@ from ._apytypes import (
     APyFloatQuantizationContext as APyFloatQuantizationContext,
     OverflowMode as OverflowMode,
     QuantizationMode as QuantizationMode,
+    _get_allocator_stats as _get_allocator_stats,
     _get_simd_version_str as _get_simd_version_str,
+    _reset_allocator_stats as _reset_allocator_stats,
     get_float_quantization_mode as get_float_quantization_mode,
     get_float_quantization_seed as get_float_quantization_seed,
     set_float_quantization_mode as set_float_quantization_mode,
@@ -33,6 +38,15 @@ from ._array_functions import (
     swapaxes as swapaxes,
     transpose as transpose,
 )
+from ._io import (
+    LazyArray as LazyArray,
+    load as load,
+    save as save,
+)
+from ._stream import (
+    StreamingFIR as StreamingFIR,
+    stream as stream,
+)
 
 __all__: list = [
     "APyFixed",
@@ -51,6 +65,8 @@ __all__: list = [
     "get_float_quantization_seed",
     "set_float_quantization_seed",
     "_get_simd_version_str",
+    "_get_allocator_stats",
+    "_reset_allocator_stats",
     "squeeze",
     "convolve",
     "reshape",
@@ -60,6 +76,12 @@ __all__: list = [
     "moveaxis",
     "swapaxes",
     "expand_dims",
+    "save",
+    "load",
+    "LazyArray",
+    "stream",
+    "StreamingFIR",
+    "profiling",
 ]
 
 annotations: __future__._Feature = ...
@@ -1330,6 +1330,66 @@ class APyFixedArray:
         :class:`APyFixedArray`
         """
 
+    @staticmethod
+    def from_bits(
+        bit_patterns: object,
+        int_bits: int | None = None,
+        frac_bits: int | None = None,
+        bits: int | None = None,
+    ) -> APyFixedArray:
+        """
+        Create an :class:`APyFixedArray` object from raw two's complement bit patterns.
+
+        This is the bulk counterpart of :class:`APyFixedArray` initialized from a sequence
+        of Python :class:`int`, suited for loading e.g. memory dumps. Bits above the
+        fixed-point word length are ignored and each element is sign-extended. Exactly two
+        of the three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must be set.
+
+        Parameters
+        ----------
+        bit_patterns : ndarray or bytes-like
+            Bit patterns to initialize from. Either a NumPy integer array or a bytes-like
+            object. For formats of at most 64 bits, each ndarray element holds one bit
+            pattern, and the array shape is the ndarray shape. For wider formats, the
+            ndarray must be of dtype `uint64` or `int64`, with a trailing axis of
+            `ceil(bits / 64)` words, least significant word first, and the array shape is
+            the ndarray shape without the trailing axis. A bytes-like object is read as
+            consecutive elements of `ceil(bits / 64)` little-endian 64-bit words, and
+            creates a one-dimensional array.
+        int_bits : int, optional
+            Number of integer bits in the created fixed-point tensor.
+        frac_bits : int, optional
+            Number of fractional bits in the created fixed-point tensor.
+        bits : int, optional
+            Total number of bits in the created fixed-point tensor.
+
+        Examples
+        --------
+
+        >>> from apytypes import APyFixedArray
+        >>> import numpy as np
+
+        Array `a`, with two 100-bit elements given as pairs of 64-bit words
+
+        >>> a = APyFixedArray.from_bits(
+        ...     np.array([[1, 0], [0, 1]], dtype=np.uint64),
+        ...     int_bits=100,
+        ...     frac_bits=0,
+        ... )
+        >>> a
+        APyFixedArray([1, 18446744073709551616], shape=(2,), bits=100, int_bits=100)
+
+        Array `b`, initialized from a bytes buffer
+
+        >>> b = APyFixedArray.from_bits(bytes([255] * 8), int_bits=4, frac_bits=0)
+        >>> b
+        APyFixedArray([15], shape=(1,), bits=4, int_bits=4)
+
+        Returns
+        -------
+        :class:`APyFixedArray`
+        """
+
     def __lshift__(self, shift_amnt: int) -> APyFixedArray: ...
     def __matmul__(self, rhs: APyFixedArray) -> APyFixedArray: ...
     def __repr__(self) -> str: ...
@@ -2001,6 +2061,14 @@ class APyFloatAccumulatorContext(ContextManager):
     >>> with APyFloatAccumulatorContext(exp_bits=6, man_bits=15, quantization=m):
     ...     d = A @ b.T
 
+    Matrix multiplication with exact accumulation of the products, which are quantized
+    once to the resulting format. This models fused dot-product hardware, and is
+    supported for operands with at most 11 exponent bits, and at most 61 mantissa bits
+    in total.
+
+    >>> with APyFloatAccumulatorContext(exact=True):
+    ...     e = A @ b.T
+
 
     If no quantization mode is specified to the accumulator context it will fallback to the mode set globally,
     see :class:`APyFloatQuantizationContext`.
@@ -2012,6 +2080,7 @@ class APyFloatAccumulatorContext(ContextManager):
         man_bits: int | None = None,
         bias: int | None = None,
         quantization: QuantizationMode | None = None,
+        exact: bool = False,
     ) -> None: ...
     def __enter__(self) -> None: ...
     def __exit__(
@@ -2209,6 +2278,33 @@ class APyFloatArray:
         :class:`numpy.ndarray`
         """
 
+    def to_bits(self) -> object:
+        """
+        Return the bit patterns of the array as a :class:`numpy.ndarray`.
+
+        Each element holds the IEEE-style bit pattern `[sign | exp | man]`, stored in the
+        narrowest of :class:`numpy.uint8`, :class:`numpy.uint16`, :class:`numpy.uint32`,
+        and :class:`numpy.uint64` that holds the format. Only formats of at most 64 bits are
+        supported.
+
+        Examples
+        --------
+
+        >>> from apytypes import APyFloatArray
+
+        >>> a = APyFloatArray.from_float([1.0, -2.0], exp_bits=5, man_bits=10)
+        >>> a.to_bits()
+        array([15360, 49152], dtype=uint16)
+
+        Returns
+        -------
+        :class:`numpy.ndarray`
+
+        See also
+        --------
+        from_bits
+        """
+
     def reshape(self, number_sequence: tuple) -> APyFloatArray:
         """
         Reshape the APyFloatArray to the specified shape without changing its data.
@@ -2390,6 +2486,57 @@ class APyFloatArray:
         :class:`APyFloatArray`
         """
 
+    @staticmethod
+    def from_bits(
+        bit_patterns: Annotated[ArrayLike, dict(order="C")],
+        exp_bits: int,
+        man_bits: int,
+        bias: int | None = None,
+    ) -> APyFloatArray:
+        """
+        Create an :class:`APyFloatArray` object from an ndarray of bit patterns.
+
+        Each element of the ndarray holds the IEEE-style bit pattern `[sign | exp | man]`
+        of one floating-point value, e.g., a raw FP8, FP16, or BF16 tensor dump. Bits above
+        the format are ignored. Signed integer dtypes are read as the unsigned type of the
+        same width.
+
+        Parameters
+        ----------
+        bit_patterns : ndarray
+            Integer ndarray of bit patterns, at least `1 + exp_bits + man_bits` bits wide.
+            The tensor shape will be taken from the ndarray shape.
+        exp_bits : int
+            Number of exponent bits in the created floating-point tensor
+        man_bits : int
+            Number of mantissa bits in the created floating-point tensor
+        bias : int, optional
+            Bias in the created floating-point tensor
+
+        Examples
+        --------
+
+        >>> from apytypes import APyFloatArray
+        >>> import numpy as np
+
+        Array `a`, initialized to [1.0, -2.0] from half-precision bit patterns
+
+        >>> a = APyFloatArray.from_bits(
+        ...     np.array([0x3C00, 0xC000], dtype=np.uint16), exp_bits=5, man_bits=10
+        ... )
+        >>> a
+        APyFloatArray([0, 1], [15, 16], [0, 0], shape=(2,), exp_bits=5, man_bits=10, bias=15)
+
+        Returns
+        -------
+        :class:`APyFloatArray`
+
+        See also
+        --------
+        to_bits
+        from_array
+        """
+
     def __matmul__(self, rhs: APyFloatArray) -> APyFloatArray | APyFloat: ...
     def __repr__(self) -> str: ...
     def __len__(self) -> int: ...
@@ -2521,6 +2668,10 @@ class APyFloatArray:
 
         Requires that ``ndim = 1`` for both `self` and `other`.
 
+        If an :class:`APyFloatAccumulatorContext` is active, the products and sums of
+        each output sample are computed in the accumulator format, and quantized back
+        to the result format, as for matrix multiplication.
+
         Parameters
         ----------
         other : :class:`APyFloatArray`
@@ -0,0 +1,409 @@
+"""
+Binary on-disk format for :class:`APyFixedArray` and :class:`APyFloatArray`.
+
+A file consists of a header, zero-padded to a multiple of 64 bytes, followed by the raw
+payload. All header fields and payload words are little-endian.
+
+Header:
+
+* ``b"APYTYPES"`` magic
+* ``uint16`` format version
+* ``uint8`` kind (0: :class:`APyFixedArray`, 1: :class:`APyFloatArray`)
+* ``uint8`` number of dimensions, followed by one ``uint64`` per dimension
+* :class:`APyFixedArray`: ``int32`` bits, ``int32`` int_bits, ``uint8`` limb size
+  in bytes
+* :class:`APyFloatArray`: ``uint8`` exp_bits, ``uint8`` man_bits, ``uint64`` bias
+
+Payload:
+
+* :class:`APyFixedArray`: the two's complement limbs of each element, least
+  significant limb first
+* :class:`APyFloatArray` of at most 64 bits: the IEEE-style bit pattern
+  ``[sign | exp | man]`` of each element (see :func:`APyFloatArray.to_bits`), in the
+  narrowest of 1, 2, 4, or 8 bytes that holds the format
+* Wider :class:`APyFloatArray`: all mantissas (``uint64``), then all biased exponents
+  (``uint32``), then all signs (``uint8``)
+"""
+
+import operator
+import os
+import struct
+
+from apytypes._apytypes import _LIMB_SIZE_BYTES, APyFixedArray, APyFloatArray
+
+_MAGIC = b"APYTYPES"
+_VERSION = 1
+_ALIGNMENT = 64
+_KIND_FIXED = 0
+_KIND_FLOAT = 1
+
+
+def _pad(n):
+    return -n % _ALIGNMENT
+
+
+def _packed_float_size(exp_bits, man_bits):
+    """
+    Bytes per element of the packed float payload, or None if the format is stored as
+    separate fields.
+    """
+    bits = 1 + exp_bits + man_bits
+    return next((size for size in (1, 2, 4, 8) if bits <= 8 * size), None)
+
+
+def save(file, a):
+    """
+    Save an :class:`APyFixedArray` or :class:`APyFloatArray` to a binary file.
+
+    The file can be loaded, in full or lazily, using :func:`load`.
+
+    Parameters
+    ----------
+    file : str, os.PathLike, or file object
+        File name or binary file object to write to.
+    a : :class:`APyFixedArray` or :class:`APyFloatArray`
+        The array to save.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    >>> apy.save("a.apy", a)  # doctest: +SKIP
+    """
+    import numpy as np
+
+    header = bytearray(_MAGIC)
+    if isinstance(a, APyFixedArray):
+        limbs = a._limb_view()
+        header += struct.pack("<HBB", _VERSION, _KIND_FIXED, a.ndim)
+        header += struct.pack(f"<{a.ndim}Q", *a.shape)
+        header += struct.pack("<iiB", a.bits, a.int_bits, limbs.itemsize)
+        payload = [limbs.astype(limbs.dtype.newbyteorder("<"), copy=False)]
+    elif isinstance(a, APyFloatArray):
+        header += struct.pack("<HBB", _VERSION, _KIND_FLOAT, a.ndim)
+        header += struct.pack(f"<{a.ndim}Q", *a.shape)
+        header += struct.pack("<BBQ", a.exp_bits, a.man_bits, a.bias)
+        size = _packed_float_size(a.exp_bits, a.man_bits)
+        if size is not None:
+            payload = [a.to_bits().astype(f"<u{size}", copy=False)]
+        else:
+            sign, exp, man = a._get_fields()
+            payload = [
+                man.astype("<u8", copy=False),
+                exp.astype("<u4", copy=False),
+                sign.astype("u1", copy=False),
+            ]
+    else:
+        raise TypeError(f"Cannot save {type(a)}")
+    header += bytes(_pad(len(header)))
+
+    def write(f):
+        f.write(header)
+        for field in payload:
+            f.write(np.ascontiguousarray(field).tobytes())
+
+    if isinstance(file, (str, os.PathLike)):
+        with open(file, "wb") as f:
+            write(f)
+    else:
+        write(file)
+
+
+def _read_header(f):
+    def read(fmt):
+        size = struct.calcsize(fmt)
+        buffer = f.read(size)
+        if len(buffer) != size:
+            raise ValueError("apytypes.load(): unexpected end of file")
+        return struct.unpack(fmt, buffer)
+
+    if f.read(len(_MAGIC)) != _MAGIC:
+        raise ValueError("apytypes.load(): not an APyTypes array file")
+    version, kind, ndim = read("<HBB")
+    if version != _VERSION:
+        raise ValueError(f"apytypes.load(): unsupported format version {version}")
+    shape = read(f"<{ndim}Q")
+    if kind == _KIND_FIXED:
+        spec = read("<iiB")
+    elif kind == _KIND_FLOAT:
+        spec = read("<BBQ")
+    else:
+        raise ValueError(f"apytypes.load(): unknown array kind {kind}")
+    return kind, shape, spec
+
+
+def _read_payload(file, offset, nbytes, lazy):
+    import numpy as np
+
+    if nbytes == 0:
+        return np.zeros(0, dtype=np.uint8)
+    if lazy:
+        return np.memmap(file, dtype=np.uint8, mode="r", offset=offset, shape=(nbytes,))
+    if isinstance(file, (str, os.PathLike)):
+        with open(file, "rb") as f:
+            f.seek(offset)
+            buffer = f.read(nbytes)
+    else:
+        file.seek(offset)
+        buffer = file.read(nbytes)
+    if len(buffer) != nbytes:
+        raise ValueError("apytypes.load(): unexpected end of file")
+    return np.frombuffer(buffer, dtype=np.uint8)
+
+
+def _fixed_from_bytes(raw, shape, bits, int_bits):
+    """
+    Create an :class:`APyFixedArray` from a :class:`numpy.ndarray` of bytes with shape
+    `(*shape, n_bytes)`, holding the little-endian two's complement data of each
+    element.
+    """
+    import numpy as np
+
+    # Re-pack the bytes of each element into native limbs, in case the data was written
+    # with a different limb size. Any added most significant bytes are sign-extended by
+    # `_from_limbs`.
+    native_dtype = np.dtype(f"u{_LIMB_SIZE_BYTES}")
+    native_size = -(-bits // (8 * native_dtype.itemsize)) * native_dtype.itemsize
+    if native_size != raw.shape[-1]:
+        repacked = np.zeros(tuple(shape) + (native_size,), dtype=np.uint8)
+        n = min(native_size, raw.shape[-1])
+        repacked[..., :n] = raw[..., :n]
+        raw = repacked
+    limbs = np.ascontiguousarray(raw).view(native_dtype.newbyteorder("<"))
+    return APyFixedArray._from_limbs(
+        np.ascontiguousarray(limbs, dtype=native_dtype), bits, int_bits
+    )
+
+
+class LazyArray:
+    """
+    Read-only handle to an array file written by :func:`save`, from which elements are
+    copied on demand.
+
+    Returned by :func:`load` when `lazy` is True. Creating the handle only reads the
+    header; the payload is memory-mapped, but no array ever shares memory with the
+    file. Every access copies: indexing along the first axis copies the selected
+    elements into a new :class:`APyFixedArray` or :class:`APyFloatArray`, reading only
+    the corresponding part of the file, and :func:`to_array` copies the whole array.
+    Indexing the same elements twice copies them twice. The handle can also be passed
+    directly to :func:`stream`, which then copies one block at a time.
+
+    Attributes
+    ----------
+    shape : tuple of int
+        Shape of the stored array.
+    ndim : int
+        Number of dimensions of the stored array.
+    bits, int_bits, frac_bits : int
+        Format of a stored :class:`APyFixedArray`.
+    exp_bits, man_bits, bias : int
+        Format of a stored :class:`APyFloatArray`.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> lazy = apy.load("a.apy", lazy=True)  # doctest: +SKIP
+    >>> first_rows = lazy[:100]  # doctest: +SKIP
+    """
+
+    def __init__(self, kind, shape, spec, raw):
+        self.shape = tuple(shape)
+        self.ndim = len(self.shape)
+        nitems = 1
+        for dim in self.shape:
+            nitems *= dim
+
+        # Views of the payload with the array shape as leading axes
+        self._kind = kind
+        if kind == _KIND_FIXED:
+            self.bits, self.int_bits, limb_size = spec
+            self.frac_bits = self.bits - self.int_bits
+            elem_size = -(-self.bits // (8 * limb_size)) * limb_size
+            self._fields = (raw.reshape(self.shape + (elem_size,)),)
+        else:
+            self.exp_bits, self.man_bits, self.bias = spec
+            size = _packed_float_size(self.exp_bits, self.man_bits)
+            if size is not None:
+                self._fields = (raw.view(f"<u{size}").reshape(self.shape),)
+            else:
+                self._fields = (
+                    raw[12 * nitems :].reshape(self.shape),
+                    raw[8 * nitems : 12 * nitems].view("<u4").reshape(self.shape),
+                    raw[: 8 * nitems].view("<u8").reshape(self.shape),
+                )
+
+    @staticmethod
+    def _payload_size(kind, shape, spec):
+        """Size in bytes of the payload of an array file."""
+        nitems = 1
+        for dim in shape:
+            nitems *= dim
+        if kind == _KIND_FIXED:
+            bits, _, limb_size = spec
+            return nitems * -(-bits // (8 * limb_size)) * limb_size
+        exp_bits, man_bits, _ = spec
+        return nitems * (_packed_float_size(exp_bits, man_bits) or 13)
+
+    def __len__(self):
+        return self.shape[0]
+
+    def __repr__(self):
+        if self._kind == _KIND_FIXED:
+            spec = f"bits={self.bits}, int_bits={self.int_bits}"
+        else:
+            spec = f"exp_bits={self.exp_bits}, man_bits={self.man_bits}"
+            spec += f", bias={self.bias}"
+        return f"LazyArray(shape={self.shape}, {spec})"
+
+    def __getitem__(self, key):
+        """
+        Copy the elements selected by an :class:`int` or a :class:`slice` along the
+        first axis into a new array. As for arrays, an integer index of a
+        one-dimensional handle returns a scalar.
+        """
+        import numpy as np
+
+        is_index = not isinstance(key, slice)
+        if is_index:
+            try:
+                index = range(self.shape[0])[operator.index(key)]
+            except TypeError:
+                raise TypeError(
+                    "LazyArray: only int and slice indices are supported"
+                ) from None
+            key = slice(index, index + 1)
+        fields = [field[key] for field in self._fields]
+
+        if self._kind == _KIND_FIXED:
+            (raw,) = fields
+            result = _fixed_from_bytes(raw, raw.shape[:-1], self.bits, self.int_bits)
+        elif len(fields) == 1:
+            (bits,) = fields
+            result = APyFloatArray.from_bits(
+                np.ascontiguousarray(bits, dtype=bits.dtype.newbyteorder("=")),
+                self.exp_bits,
+                self.man_bits,
+                self.bias,
+            )
+        else:
+            sign, exp, man = fields
+            result = APyFloatArray._from_fields(
+                np.ascontiguousarray(sign),
+                np.ascontiguousarray(exp, dtype=np.uint32),
+                np.ascontiguousarray(man, dtype=np.uint64),
+                self.exp_bits,
+                self.man_bits,
+                self.bias,
+            )
+        return result[0] if is_index else result
+
+    def to_array(self):
+        """
+        Copy the whole array out of the file.
+
+        Returns
+        -------
+        :class:`APyFixedArray` or :class:`APyFloatArray`
+        """
+        return self[:]
+
+
+def load(file, lazy=False):
+    """
+    Load an :class:`APyFixedArray` or :class:`APyFloatArray` saved with :func:`save`.
+
+    Parameters
+    ----------
+    file : str, os.PathLike, or file object
+        File name or binary file object to read from.
+    lazy : bool, default: False
+        If False, the array is read into memory. Otherwise, a :class:`LazyArray` handle
+        to the file is returned without reading any elements. The returned arrays do
+        not share memory with the file: each access to the handle copies the selected
+        elements out of it.
+
+    Returns
+    -------
+    :class:`APyFixedArray`, :class:`APyFloatArray`, or :class:`LazyArray`
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.load("a.apy")  # doctest: +SKIP
+    """
+    if isinstance(file, (str, os.PathLike)):
+        start = 0
+        with open(file, "rb") as f:
+            kind, shape, spec = _read_header(f)
+            header_size = f.tell()
+    else:
+        start = file.tell()
+        kind, shape, spec = _read_header(file)
+        header_size = file.tell() - start
+    offset = start + header_size + _pad(header_size)
+
+    nbytes = LazyArray._payload_size(kind, shape, spec)
+    raw = _read_payload(file, offset, nbytes, lazy)
+    handle = LazyArray(kind, shape, spec, raw)
+    return handle if lazy else handle.to_array()
+
+
+def _reduce_ex_fixed(self, protocol):
+    """
+    Pickle support for :class:`APyFixedArray`. With protocol 5 or higher, the limbs are
+    passed as an out-of-band :class:`pickle.PickleBuffer`.
+    """
+    import pickle
+
+    limbs = self._limb_view()
+    limbs = limbs.astype(limbs.dtype.newbyteorder("<"), copy=False)
+    buffer = pickle.PickleBuffer(limbs) if protocol >= 5 else limbs.tobytes()
+    return _rebuild_fixed, (buffer, self.shape, self.bits, self.int_bits)
+
+
+def _rebuild_fixed(buffer, shape, bits, int_bits):
+    import numpy as np
+
+    raw = np.frombuffer(buffer, dtype=np.uint8)
+    n_items = 1
+    for dim in shape:
+        n_items *= dim
+    elem_size = raw.size // n_items if n_items else 0
+    return _fixed_from_bytes(
+        raw.reshape(tuple(shape) + (elem_size,)), tuple(shape), bits, int_bits
+    )
+
+
+def _reduce_ex_float(self, protocol):
+    """
+    Pickle support for :class:`APyFloatArray`. With protocol 5 or higher, the fields are
+    passed as out-of-band :class:`pickle.PickleBuffer` objects.
+    """
+    import pickle
+
+    sign, exp, man = self._get_fields()
+    fields = (sign, exp.astype("<u4", copy=False), man.astype("<u8", copy=False))
+    if protocol >= 5:
+        buffers = tuple(pickle.PickleBuffer(field) for field in fields)
+    else:
+        buffers = tuple(field.tobytes() for field in fields)
+    return _rebuild_float, (
+        *buffers,
+        self.shape,
+        self.exp_bits,
+        self.man_bits,
+        self.bias,
+    )
+
+
+def _rebuild_float(sign, exp, man, shape, exp_bits, man_bits, bias):
+    import numpy as np
+
+    return APyFloatArray._from_fields(
+        np.frombuffer(sign, dtype=np.uint8).reshape(shape),
+        np.ascontiguousarray(np.frombuffer(exp, dtype="<u4"), np.uint32).reshape(shape),
+        np.ascontiguousarray(np.frombuffer(man, dtype="<u8"), np.uint64).reshape(shape),
+        exp_bits,
+        man_bits,
+        bias,
+    )
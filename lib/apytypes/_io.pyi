@@ -0,0 +1,8 @@
+import os
+from typing import BinaryIO, Literal
+from apytypes._typing import APyArray
+
+def save(file: str | os.PathLike | BinaryIO, a: APyArray) -> None: ...
+def load(
+    file: str | os.PathLike | BinaryIO, mmap_mode: Literal["r", "c"] | None = "r"
+) -> APyArray: ...
@@ -0,0 +1,225 @@
+"""
+Block-wise streaming evaluation of APyTypes operations with bounded memory.
+"""
+
+import queue
+import threading
+
+from apytypes._apytypes import APyFixedArray, APyFloatArray
+from apytypes._io import LazyArray
+
+_APY_ARRAYS = (APyFixedArray, APyFloatArray)
+
+
+def _concatenate(a, b):
+    """Concatenate two arrays of the same format along the first axis."""
+    import numpy as np
+
+    if isinstance(a, APyFixedArray):
+        limbs = np.concatenate((a._limb_view(), b._limb_view()))
+        return APyFixedArray._from_limbs(limbs, a.bits, a.int_bits)
+    fields = [np.concatenate(pair) for pair in zip(a._get_fields(), b._get_fields())]
+    return APyFloatArray._from_fields(*fields, a.exp_bits, a.man_bits, a.bias)
+
+
+def _slice(a, start, stop):
+    """Slice an array along the first axis."""
+    import numpy as np
+
+    if isinstance(a, APyFixedArray):
+        limbs = np.ascontiguousarray(a._limb_view()[start:stop])
+        return APyFixedArray._from_limbs(limbs, a.bits, a.int_bits)
+    fields = [np.ascontiguousarray(f[start:stop]) for f in a._get_fields()]
+    return APyFloatArray._from_fields(*fields, a.exp_bits, a.man_bits, a.bias)
+
+
+def _zeros_like(a, n):
+    """One-dimensional array of `n` zeros in the format of `a`."""
+    if isinstance(a, APyFixedArray):
+        return APyFixedArray([0] * n, bits=a.bits, int_bits=a.int_bits)
+    return APyFloatArray([0] * n, [0] * n, [0] * n, a.exp_bits, a.man_bits, a.bias)
+
+
+class StreamingFIR:
+    """
+    Stateful FIR filter for use in a :func:`stream` pipeline.
+
+    Each one-dimensional block is convolved with `taps`, using the last
+    ``len(taps) - 1`` input samples of the previous block as history. The concatenated
+    output equals the first ``N`` samples of ``convolve(x, taps)`` for the full
+    ``N``-sample input ``x``, i.e., the filter is causal with zero initial state.
+
+    Parameters
+    ----------
+    taps : :class:`APyFixedArray` or :class:`APyFloatArray`
+        One-dimensional filter coefficients.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> x = apy.APyFixedArray.from_float(list(range(8)), int_bits=6, frac_bits=0)
+    >>> h = apy.APyFixedArray.from_float([1, 1], int_bits=2, frac_bits=0)
+    >>> blocks = apy.stream(x, apy.StreamingFIR(h), block_size=3)
+    >>> [b.to_numpy().tolist() for b in blocks]
+    [[0.0, 1.0, 3.0], [5.0, 7.0, 9.0], [11.0, 13.0]]
+    """
+
+    def __init__(self, taps):
+        if not isinstance(taps, _APY_ARRAYS) or taps.ndim != 1:
+            raise ValueError(
+                "StreamingFIR: taps must be a one-dimensional APyTypes array"
+            )
+        self.taps = taps
+        self._history = None
+
+    def reset(self):
+        """Clear the filter history."""
+        self._history = None
+
+    def __call__(self, block):
+        if block.ndim != 1:
+            raise ValueError(
+                "StreamingFIR: blocks must be one-dimensional, "
+                f"got a block of shape {block.shape}"
+            )
+        n_history = self.taps.shape[0] - 1
+        if n_history == 0:
+            return block.convolve(self.taps, mode="valid")
+        if self._history is None:
+            self._history = _zeros_like(block, n_history)
+        x = _concatenate(self._history, block)
+        self._history = _slice(x, x.shape[0] - n_history, x.shape[0])
+        return x.convolve(self.taps, mode="valid")
+
+
+def _blocks(source, block_size):
+    """Split `source` into blocks along the first axis."""
+    if isinstance(source, _APY_ARRAYS):
+        for start in range(0, source.shape[0], block_size):
+            yield _slice(source, start, min(start + block_size, source.shape[0]))
+    elif isinstance(source, LazyArray):
+        # Each block is copied out of the file as it is pulled
+        for start in range(0, source.shape[0], block_size):
+            yield source[start : start + block_size]
+    elif hasattr(source, "__array_interface__") and hasattr(source, "shape"):
+        import numpy as np
+
+        for start in range(0, source.shape[0], block_size):
+            # Force the block into memory, so that memory-mapped data is read here
+            yield np.array(source[start : start + block_size])
+    else:
+        yield from source
+
+
+def stream(source, *ops, block_size=65536, prefetch=2):
+    """
+    Evaluate a chain of operations block by block.
+
+    Blocks are pulled from `source` on a background thread, up to `prefetch` blocks
+    ahead of the block currently being processed, so that reading the next block (e.g.,
+    from a memory-mapped file) overlaps with processing the current one. At most
+    ``prefetch + 2`` input blocks are held in memory at any time.
+
+    Parameters
+    ----------
+    source : iterable, :class:`numpy.ndarray`, :class:`LazyArray`, or APyTypes array
+        Source of blocks. Arrays, including :class:`numpy.memmap` and
+        :class:`LazyArray`, are split into blocks of `block_size` elements along the
+        first axis. Any other iterable, such
+        as a generator, is assumed to yield blocks directly.
+    *ops : callable
+        Operations applied in order to each block, e.g., a lambda performing a cast,
+        an elementwise operation, or a :class:`StreamingFIR`.
+    block_size : int, default: 65536
+        Number of elements along the first axis per block when splitting arrays.
+    prefetch : int, default: 2
+        Maximum number of blocks read ahead. If 0, blocks are read on the calling
+        thread.
+
+    Returns
+    -------
+    generator
+        Generator yielding the result of applying `ops` to each block.
+
+    Raises
+    ------
+    :class:`ValueError`
+        If `block_size` is not positive or `prefetch` is negative. Raised by the call
+        itself, not when the first block is pulled.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> import numpy as np
+    >>> x = np.linspace(0, 1, 10)
+    >>> blocks = apy.stream(
+    ...     x,
+    ...     lambda b: apy.APyFixedArray.from_float(b, int_bits=2, frac_bits=3),
+    ...     lambda b: b * b,
+    ...     block_size=4,
+    ... )
+    >>> [b.shape for b in blocks]
+    [(4,), (4,), (2,)]
+    """
+    # Validated here, as the generator below would only raise on the first `next()`
+    if block_size < 1:
+        raise ValueError("stream: block_size must be positive")
+    if prefetch < 0:
+        raise ValueError("stream: prefetch must be non-negative")
+    for op in ops:
+        if not callable(op):
+            raise TypeError(f"stream: operation {op!r} is not callable")
+    return _stream(source, ops, block_size, prefetch)
+
+
+def _stream(source, ops, block_size, prefetch):
+    blocks = _blocks(source, block_size)
+    if prefetch > 0:
+        blocks = _prefetch(blocks, prefetch)
+
+    for block in blocks:
+        for op in ops:
+            block = op(block)
+        yield block
+
+
+_DONE = object()
+
+
+def _prefetch(iterator, depth):
+    """Pull items from `iterator` on a background thread, `depth` items ahead."""
+    items = queue.Queue(maxsize=depth)
+    stop = threading.Event()
+
+    def put(item):
+        while not stop.is_set():
+            try:
+                items.put(item, timeout=0.1)
+                return True
+            except queue.Full:
+                pass
+        return False
+
+    def producer():
+        try:
+            for item in iterator:
+                if not put((item, None)):
+                    return
+        except BaseException as e:  # Re-raised on the consuming thread
+            put((_DONE, e))
+            return
+        put((_DONE, None))
+
+    thread = threading.Thread(target=producer, daemon=True)
+    thread.start()
+    try:
+        while True:
+            item, error = items.get()
+            if item is _DONE:
+                if error is not None:
+                    raise error
+                return
+            yield item
+    finally:
+        stop.set()
+        thread.join()
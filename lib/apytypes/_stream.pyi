@@ -0,0 +1,15 @@
+from typing import Any, Callable, Iterable, Iterator
+from apytypes._typing import APyArray
+
+class StreamingFIR:
+    taps: APyArray
+    def __init__(self, taps: APyArray) -> None: ...
+    def reset(self) -> None: ...
+    def __call__(self, block: APyArray) -> APyArray: ...
+
+def stream(
+    source: Iterable[Any] | APyArray,
+    *ops: Callable[[Any], Any],
+    block_size: int = 65536,
+    prefetch: int = 2,
+) -> Iterator[Any]: ...
@@ -0,0 +1,150 @@
+"""
+Opt-in runtime instrumentation of the APyTypes array kernels.
+
+While profiling is enabled, every call of an instrumented kernel path is counted. Each
+path has a name of the form ``<type>.<operation>.<path>``, e.g.,
+``fixed.add_sub.single_limb_simd`` or ``float.add.scalar_fallback``, which shows
+whether an operation took a fast path or fell back to a slower, more general one.
+
+For each path, the number of calls, the number of elements processed, the number of
+bytes allocated for buffers and scratch memories, and the total time in nanoseconds is
+accumulated. Nested paths (e.g., the broadcasting performed before an addition) are
+counted in both the inner and the outer path.
+
+Profiling is disabled by default, in which case the instrumentation costs a single
+flag test per kernel call.
+
+Examples
+--------
+>>> import apytypes as apy
+>>> a = apy.APyFixedArray.from_float([1, 2, 3], int_bits=10, frac_bits=0)
+>>> with apy.profiling.profile():
+...     b = a + a
+>>> apy.profiling.stats()["fixed.add_sub.single_limb_simd"]["calls"]
+1
+"""
+
+import contextlib
+import json
+import os
+
+from apytypes._apytypes import (
+    _profiling_disable,
+    _profiling_enable,
+    _profiling_is_enabled,
+    _profiling_reset,
+    _profiling_stats,
+    _profiling_trace_events,
+)
+
+
+def enable(trace=False):
+    """
+    Enable profiling of the kernel paths.
+
+    Parameters
+    ----------
+    trace : bool, default: False
+        If True, every call is also recorded as a trace event, which can be exported
+        using :func:`dump_chrome_trace`. At most 2\\ :sup:`20` events are retained.
+    """
+    _profiling_enable(trace)
+
+
+def disable():
+    """
+    Disable profiling. The accumulated counters and trace events are kept.
+    """
+    _profiling_disable()
+
+
+def is_enabled():
+    """
+    Test if profiling is enabled.
+
+    Returns
+    -------
+    :class:`bool`
+    """
+    return _profiling_is_enabled()
+
+
+def reset():
+    """
+    Reset all counters to zero and discard all recorded trace events.
+    """
+    _profiling_reset()
+
+
+def stats():
+    """
+    Retrieve the accumulated counters of all kernel paths called since the last
+    :func:`reset`.
+
+    Returns
+    -------
+    :class:`dict`
+        Mapping from kernel path name to a :class:`dict` with the number of ``calls``,
+        the number of ``elements`` processed, the number of ``bytes_allocated``, and
+        the total time ``ns`` in nanoseconds.
+    """
+    return _profiling_stats()
+
+
+@contextlib.contextmanager
+def profile(trace=False):
+    """
+    Context manager resetting the counters and profiling the enclosed block.
+
+    Parameters
+    ----------
+    trace : bool, default: False
+        If True, every call is also recorded as a trace event.
+    """
+    reset()
+    enable(trace)
+    try:
+        yield
+    finally:
+        disable()
+
+
+def dump_chrome_trace(file):
+    """
+    Write the recorded trace events in the Chrome trace event format.
+
+    The file can be opened in ``chrome://tracing`` or https://ui.perfetto.dev. Events
+    are only recorded while profiling is enabled with ``trace=True``.
+
+    Parameters
+    ----------
+    file : str, os.PathLike, or file object
+        File name or text file object to write to.
+    """
+    pid = os.getpid()
+    events = [
+        {
+            "name": name,
+            "cat": "apytypes",
+            "ph": "X",
+            "ts": start_ns / 1000,
+            "dur": duration_ns / 1000,
+            "pid": pid,
+            "tid": tid,
+            "args": {"elements": elements, "bytes_allocated": bytes_allocated},
+        }
+        for (
+            name,
+            start_ns,
+            duration_ns,
+            elements,
+            bytes_allocated,
+            tid,
+        ) in _profiling_trace_events()
+    ]
+    trace = {"traceEvents": events, "displayTimeUnit": "ns"}
+    if isinstance(file, (str, os.PathLike)):
+        with open(file, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, file)
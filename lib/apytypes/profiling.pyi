@@ -0,0 +1,11 @@
+import os
+from contextlib import AbstractContextManager
+from typing import IO
+
+def enable(trace: bool = False) -> None: ...
+def disable() -> None: ...
+def is_enabled() -> bool: ...
+def reset() -> None: ...
+def stats() -> dict[str, dict[str, int]]: ...
+def profile(trace: bool = False) -> AbstractContextManager[None]: ...
+def dump_chrome_trace(file: str | os.PathLike | IO[str]) -> None: ...
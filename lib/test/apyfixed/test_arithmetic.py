@@ -296,6 +296,31 @@ def test_shift():
     assert a.is_identical(b)
 
 
+def test_single_limb_comparisons():
+    a = APyFixed.from_float(1.25, int_bits=3, frac_bits=5)
+    b = APyFixed.from_float(1.25, int_bits=10, frac_bits=2)
+    c = APyFixed.from_float(-1.5, int_bits=40, frac_bits=20)
+    assert a == b and a <= b and a >= b
+    assert not (a != b or a < b or a > b)
+    assert c < a and c <= b and a > c and b >= c
+    assert a != c
+
+    # Aligned operands not fitting in a single limb
+    d = APyFixed.from_float(1.25, int_bits=60, frac_bits=4)
+    e = APyFixed.from_float(1.25 + 2**-30, int_bits=2, frac_bits=60)
+    assert d < e and e > d and d != e
+
+
+def test_single_limb_operands_product():
+    a = APyFixed.from_float(-3.25, int_bits=30, frac_bits=20)
+    b = APyFixed.from_float(1000.5, int_bits=40, frac_bits=10)
+    ref = APyFixed.from_float(-3251.625, int_bits=70, frac_bits=30)
+    assert (a * b).is_identical(ref)
+    assert (b * a).is_identical(ref)
+    a = APyFixed(1 << 63, int_bits=64, frac_bits=0)
+    assert (a * a).is_identical(APyFixed(1 << 126, int_bits=128, frac_bits=0))
+
+
 def test_comparisons_failing():
     a = APyFixed(3, 3, 2)
     assert a > 0
@@ -67,6 +67,21 @@ def test_to_string():
     )
 
 
+def test_to_string_wide():
+    from fractions import Fraction
+
+    # Integer and fractional parts wide enough for the decimal conversion to split on
+    # powers of ten
+    for value in [3**2500, -(3**2500), 7**1400 + 1, (1 << 4000) + 1, 1 << 3500]:
+        for frac_bits in [-50, 0, 1, 300, 3000, 4000]:
+            a = APyFixed(value % (1 << 4096), bits=4096, int_bits=4096 - frac_bits)
+            int_part, frac_part = (str(a).split(".") + [""])[:2]
+            assert not frac_part.endswith("0")
+            assert Fraction(int(int_part + frac_part), 10 ** len(frac_part)) == (
+                Fraction(value) / Fraction(2) ** frac_bits
+            )
+
+
 def test_is_positive():
     a = APyFixed(4, int_bits=2, frac_bits=1)
     assert not a._is_positive
@@ -1,5 +1,5 @@
 from apytypes import APyFixed
-from apytypes import QuantizationMode
+from apytypes import OverflowMode, QuantizationMode
 
 import pytest
 
@@ -469,6 +469,36 @@ def test_huge_extending_cast(mode):
     assert float(APyFixed.from_float(-0.75, 5, 2).cast(500, 500, mode)) == -0.75
 
 
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TRN,
+        QuantizationMode.TRN_INF,
+        QuantizationMode.TRN_ZERO,
+        QuantizationMode.TRN_AWAY,
+        QuantizationMode.TRN_MAG,
+        QuantizationMode.RND,
+        QuantizationMode.RND_INF,
+        QuantizationMode.RND_MIN_INF,
+        QuantizationMode.RND_ZERO,
+        QuantizationMode.RND_CONV,
+        QuantizationMode.RND_CONV_ODD,
+        QuantizationMode.JAM,
+        QuantizationMode.JAM_UNBIASED,
+    ],
+)
+def test_single_limb_cast(mode):
+    # Single-limb casts must agree with the same casts from a multi-limb source
+    for value in [0, 1, 7, 8, 9, 0x7FFFF, 0x80000, 0x80001, 0xAAAAA, 0xFFFFF]:
+        a = APyFixed(value, int_bits=5, frac_bits=15)
+        wide = a.cast(int_bits=85, frac_bits=15)
+        for frac_bits in [-3, 0, 3, 14, 15, 20]:
+            res = a.cast(5, frac_bits, mode)
+            assert res.is_identical(wide.cast(5, frac_bits, mode))
+            res = a.cast(2, frac_bits, mode, OverflowMode.SAT)
+            assert res.is_identical(wide.cast(2, frac_bits, mode, OverflowMode.SAT))
+
+
 # All of the non-implemented Python quantization methods for APyFixed
 @pytest.mark.parametrize(
     "mode",
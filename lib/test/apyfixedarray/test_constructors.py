@@ -233,3 +233,62 @@ def test_fizz_fuzz():
     a = APyFixedArray.from_float(fl, int_bits=16, frac_bits=16)
     b = APyFixedArray.from_array(np.array(fl), int_bits=16, frac_bits=16)
     assert a.is_identical(b)
+
+
+def test_ndarray_bit_patterns_wrap():
+    np = pytest.importorskip("numpy")
+    a = APyFixedArray(np.array([1023, 512, -1]), bits=10, int_bits=10)
+    assert a.is_identical(APyFixedArray([-1, -512, -1], bits=10, int_bits=10))
+    assert a.to_numpy().tolist() == [-1, -512, -1]
+
+
+def test_from_bits():
+    np = pytest.importorskip("numpy")
+
+    # Single-word formats are read element-wise
+    a = APyFixedArray.from_bits(np.array([[3, 31], [16, 1]]), int_bits=3, frac_bits=2)
+    assert a.is_identical(APyFixedArray([[3, 31], [16, 1]], int_bits=3, frac_bits=2))
+
+    # Wider formats use a trailing axis of 64-bit words
+    values = [0, 1, 2**64 - 1, 2**64, 2**99 + 5, 2**100 - 1, 2**128 - 1]
+    words = np.array([[v % 2**64, (v >> 64) % 2**64] for v in values], dtype=np.uint64)
+    ref = APyFixedArray(values, int_bits=60, frac_bits=40)
+    assert APyFixedArray.from_bits(words, int_bits=60, frac_bits=40).is_identical(ref)
+    assert APyFixedArray.from_bits(
+        words.view(np.int64).reshape(7, 1, 2), bits=100, int_bits=60
+    ).is_identical(ref.reshape((7, 1)))
+
+    # Bytes-like objects hold consecutive little-endian words
+    data = b"".join(v.to_bytes(16, "little") for v in values)
+    assert APyFixedArray.from_bits(data, bits=100, int_bits=60).is_identical(ref)
+    assert APyFixedArray.from_bits(
+        bytearray(data), bits=100, int_bits=60
+    ).is_identical(ref)
+    assert APyFixedArray.from_bits(
+        (255).to_bytes(8, "little"), bits=4, int_bits=4
+    ).is_identical(APyFixedArray([15], bits=4, int_bits=4))
+
+
+def test_from_bits_raises():
+    np = pytest.importorskip("numpy")
+
+    with pytest.raises(ValueError, match=r"2 words along the last axis"):
+        APyFixedArray.from_bits(np.zeros((3, 3), dtype=np.uint64), bits=100, int_bits=0)
+    with pytest.raises(ValueError, match=r"2 words along the last axis"):
+        APyFixedArray.from_bits(np.zeros((3, 2), dtype=np.int32), bits=100, int_bits=0)
+    with pytest.raises(ValueError, match=r"2 words along the last axis"):
+        APyFixedArray.from_bits(np.zeros(2, dtype=np.uint64), bits=100, int_bits=0)
+    with pytest.raises(ValueError, match=r"ndim == 0"):
+        APyFixedArray.from_bits(np.array(1), bits=10, int_bits=0)
+    with pytest.raises(ValueError, match=r"not a multiple of the 16 bytes"):
+        APyFixedArray.from_bits(bytes(24), bits=100, int_bits=0)
+    with pytest.raises(TypeError, match=r"bytes-like"):
+        APyFixedArray.from_bits([1, 2, 3], bits=10, int_bits=0)
+
+    # Errors of the buffer protocol are raised as is
+    view = memoryview(bytes(32))
+    with pytest.raises(BufferError, match=r"not C-contiguous"):
+        APyFixedArray.from_bits(view[::2], bits=10, int_bits=0)
+    view.release()
+    with pytest.raises(ValueError, match=r"released memoryview"):
+        APyFixedArray.from_bits(view, bits=10, int_bits=0)
@@ -1,4 +1,4 @@
-from itertools import permutations
+from itertools import accumulate, permutations
 from apytypes import APyFixedArray
 from apytypes import APyFixed
 
@@ -418,6 +418,55 @@ def test_cumprod_itemsize(prod_func):
     )
 
 
+@pytest.mark.parametrize("bits", [20, 64, 100])
+def test_cumsum_large(bits):
+    # Large enough for the vectorized scans, and for the lanes to be distributed over
+    # threads. For 64 bits, the result is wider than its input.
+    rows, cols = 300, 257
+    values = [((i * 7919) % 2001 - 1000) * (i % 3 + 1) for i in range(rows * cols)]
+    matrix = [values[r * cols : (r + 1) * cols] for r in range(rows)]
+    a = APyFixedArray(matrix, bits=bits, int_bits=bits)
+
+    flat = list(accumulate(values))
+    assert a.cumsum().is_identical(APyFixedArray(flat, int_bits=bits + 17, frac_bits=0))
+    columns = [list(accumulate(column)) for column in zip(*matrix)]
+    assert a.cumsum(0).is_identical(
+        APyFixedArray(
+            [list(row) for row in zip(*columns)], int_bits=bits + 9, frac_bits=0
+        )
+    )
+    assert a.cumsum(1).is_identical(
+        APyFixedArray(
+            [list(accumulate(row)) for row in matrix], int_bits=bits + 9, frac_bits=0
+        )
+    )
+
+
+@pytest.mark.parametrize("int_bits, frac_bits", [(4, 3), (20, 20)])
+def test_cumprod_fractional(int_bits, frac_bits):
+    values = [[1.5, -0.25, 2.0], [-3.0, 0.5, -1.75]]
+    a = APyFixedArray.from_float(values, int_bits=int_bits, frac_bits=frac_bits)
+
+    flat = list(accumulate(values[0] + values[1], lambda x, y: x * y))
+    assert a.cumprod().is_identical(
+        APyFixedArray.from_float(flat, int_bits=6 * int_bits, frac_bits=6 * frac_bits)
+    )
+    assert a.cumprod(0).is_identical(
+        APyFixedArray.from_float(
+            [values[0], [x * y for x, y in zip(*values)]],
+            int_bits=2 * int_bits,
+            frac_bits=2 * frac_bits,
+        )
+    )
+    assert a.cumprod(1).is_identical(
+        APyFixedArray.from_float(
+            [list(accumulate(row, lambda x, y: x * y)) for row in values],
+            int_bits=3 * int_bits,
+            frac_bits=3 * frac_bits,
+        )
+    )
+
+
 @pytest.mark.parametrize("max_func", ["max", "nanmax"])
 def test_max(max_func):
     a = APyFixedArray([[0, 1], [2, 3]], int_bits=5, frac_bits=0)
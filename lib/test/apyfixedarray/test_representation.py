@@ -30,3 +30,13 @@ def test_array_representation():
         APyFixedArray([[range(5, 8), range(3)]], bits=1000, int_bits=500).__repr__()
         == "APyFixedArray([5, 6, 7, 0, 1, 2], shape=(1, 2, 3), bits=1000, int_bits=500)"
     )
+
+
+def test_array_representation_wide():
+    # Wide enough for the decimal conversion to split on powers of ten
+    values = [(1 << 4095) - 12345, 1 << 4000, 3**2000, 0]
+    a = APyFixedArray(values, bits=4096, int_bits=100)
+    assert repr(a) == (
+        f"APyFixedArray([{', '.join(str(v) for v in values)}], shape=(4,), "
+        "bits=4096, int_bits=100)"
+    )
@@ -1,7 +1,8 @@
 from itertools import permutations as perm
 import math
+import random
 import pytest
-from apytypes import APyFloat
+from apytypes import APyFloat, APyFloatQuantizationContext, QuantizationMode
 
 
 # Negation
@@ -694,6 +695,39 @@ def test_long_mul():
     assert res.is_identical(APyFloat(sign=0, exp=1, man=0, exp_bits=11, man_bits=52))
 
 
+def _wide_operands(exp_bits, man_bits, n=200):
+    random.seed(exp_bits + man_bits)
+    return [
+        APyFloat(
+            random.randint(0, 1),
+            random.randint(1, 2**exp_bits - 2),
+            random.getrandbits(man_bits),
+            exp_bits,
+            man_bits,
+        )
+        for _ in range(n)
+    ]
+
+
+@pytest.mark.float_mul
+@pytest.mark.parametrize("mode", [QuantizationMode.RND_CONV, QuantizationMode.TRN])
+@pytest.mark.parametrize("exp_bits,man_bits", [(5, 61), (11, 60), (8, 53)])
+def test_mul_full_precision(mode, exp_bits, man_bits, exact_float):
+    """Test that products keep all mantissa bits of the widest formats."""
+    a = APyFloat(0, 15, 1 << 60, 5, 61)
+    b = APyFloat(0, 15, (1 << 61) - 1, 5, 61)
+    assert (a * b).is_identical(APyFloat(0, 16, (1 << 60) - 1, 5, 61))
+    assert (b * a).is_identical(APyFloat(0, 16, (1 << 60) - 1, 5, 61))
+
+    # Compare with the exact products, quantized once. Rounding the mantissa through a
+    # `double` first would lose up to `man_bits - 52` bits.
+    exact = exact_float(mode)
+    xs = _wide_operands(exp_bits, man_bits)
+    with APyFloatQuantizationContext(mode):
+        for x, y in zip(xs, reversed(xs)):
+            assert exact.matches(x * y, exact.mul(x, y, x)), (x, y)
+
+
 @pytest.mark.float_div
 @pytest.mark.parametrize("exp", list(perm(["5", "8"], 2)))
 @pytest.mark.parametrize("man", list(perm(["5", "8"], 2)))
@@ -841,6 +875,23 @@ def test_long_div():
     assert res.is_identical(APyFloat(sign=0, exp=0, man=2, exp_bits=14, man_bits=59))
 
 
+@pytest.mark.float_div
+@pytest.mark.parametrize("mode", [QuantizationMode.RND_CONV, QuantizationMode.TRN])
+@pytest.mark.parametrize("exp_bits,man_bits", [(5, 61), (11, 60), (8, 53)])
+def test_div_full_precision(mode, exp_bits, man_bits, exact_float):
+    """Test that quotients keep all mantissa bits of the widest formats."""
+    a = APyFloat(0, 15, (1 << 61) - 1, 5, 61)
+    b = APyFloat(0, 15, 1, 5, 61)
+    assert (a / b).is_identical(APyFloat(0, 15, (1 << 61) - 3, 5, 61))
+
+    # Compare with the exact quotients, quantized once
+    exact = exact_float(mode)
+    xs = _wide_operands(exp_bits, man_bits)
+    with APyFloatQuantizationContext(mode):
+        for x, y in zip(xs, reversed(xs)):
+            assert exact.matches(x / y, exact.div(x, y, x)), (x, y)
+
+
 @pytest.mark.float_div
 def test_div_mixed_bias():
     # Test that the implementation doesn't do "x.cast() / y.cast()"
@@ -976,6 +1027,23 @@ def test_negative_power():
     )
 
 
+@pytest.mark.float_pow
+def test_two_word_power():
+    """Test powers whose exact mantissa needs two words."""
+    a = APyFloat.from_float(1 + 2**-40, 11, 45)
+    assert (a**2).is_identical(APyFloat.from_float(1 + 2**-39, 11, 45))
+    b = APyFloat.from_float(-(1 + 2**-20), 8, 30)
+    assert (b**3).is_identical(APyFloat.from_float(-(1 + 3 * 2**-20), 8, 30))
+
+    with APyFloatQuantizationContext(QuantizationMode.TO_POS):
+        res = a**2
+        assert res.is_identical(APyFloat.from_float(1 + 2**-39 + 2**-45, 11, 45))
+        assert (b**3).is_identical(APyFloat.from_float(-(1 + 3 * 2**-20), 8, 30))
+    with APyFloatQuantizationContext(QuantizationMode.TO_NEG):
+        res = b**3
+        assert res.is_identical(APyFloat.from_float(-(1 + 3 * 2**-20 + 2**-30), 8, 30))
+
+
 @pytest.mark.float_pow
 def test_long_power():
     """Test the power function with long format."""
@@ -1043,6 +1111,23 @@ def test_power_overflow():
     assert res.is_identical(APyFloat(1, 31, 0, 5, 4))
 
 
+@pytest.mark.float_pow
+@pytest.mark.parametrize("man_bits", [4, 30, 60])
+def test_power_overflow_quantization(man_bits):
+    """Test that powers overflow as quantization does, with one word, two words,
+    and more for the exact mantissa."""
+    max_man = 2**man_bits - 1
+    x = APyFloat(1, 30, 1, 5, man_bits)
+    assert (x**2).is_identical(APyFloat(0, 31, 0, 5, man_bits))
+    assert (x**3).is_identical(APyFloat(1, 31, 0, 5, man_bits))
+    with APyFloatQuantizationContext(QuantizationMode.TO_ZERO):
+        assert (x**2).is_identical(APyFloat(0, 30, max_man, 5, man_bits))
+        assert (x**3).is_identical(APyFloat(1, 30, max_man, 5, man_bits))
+    with APyFloatQuantizationContext(QuantizationMode.TO_POS):
+        assert (x**2).is_identical(APyFloat(0, 31, 0, 5, man_bits))
+        assert (x**3).is_identical(APyFloat(1, 30, max_man, 5, man_bits))
+
+
 @pytest.mark.float_pow
 def test_power_underflow():
     """Test that the power function can underflow to zero."""
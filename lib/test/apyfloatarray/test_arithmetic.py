@@ -1,4 +1,5 @@
 from itertools import permutations
+import random
 import pytest
 from apytypes import (
     APyFloat,
@@ -1297,3 +1298,193 @@ def test_array_operation_with_numbers():
     assert (_ := q_one * a).is_identical(a)
     assert (_ := a / q_one).is_identical(a)
     assert (_ := q_one / a).is_identical(APyFloatArray([0], [14], [1], 5, 2))
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TIES_AWAY,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_NEG,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.JAM_UNBIASED,
+    ],
+)
+@pytest.mark.parametrize("exp_bits,man_bits", [(4, 3), (5, 10), (8, 23), (11, 52)])
+def test_array_add_mul_vectorized(mode, exp_bits, man_bits):
+    # Long enough to span several tiles of the vectorized kernels, with zeros,
+    # subnormals, infinities, NaNs, overflow, and cancellation mixed in
+    rng = random.Random(exp_bits * 100 + man_bits)
+    max_exp = (1 << exp_bits) - 1
+    n = 300
+
+    def operand():
+        exp = rng.choice([0, max_exp, max_exp - 1, 1] + [rng.randrange(max_exp)] * 6)
+        return rng.randrange(2), exp, rng.randrange(1 << man_bits)
+
+    x = [operand() for _ in range(n)]
+    y = [operand() for _ in range(n)]
+    y[::7] = [(1 - s, e, m) for s, e, m in x[::7]]
+    a = APyFloatArray(*zip(*x), exp_bits=exp_bits, man_bits=man_bits)
+    b = APyFloatArray(*zip(*y), exp_bits=exp_bits, man_bits=man_bits)
+    with APyFloatQuantizationContext(mode):
+        res_add = a + b
+        res_mul = a * b
+        for i in range(n):
+            for res, ref in ((res_add[i], a[i] + b[i]), (res_mul[i], a[i] * b[i])):
+                assert res.is_identical(ref) or (res.is_nan and ref.is_nan)
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("exp_bits,man_bits", [(5, 10), (8, 7), (8, 23), (11, 52)])
+def test_array_native_formats(exp_bits, man_bits):
+    # Standard formats with ties-to-even are computed with native floating-point
+    # arithmetic, which must agree with APyTypes, also for subnormals and special
+    # values
+    rng = random.Random(exp_bits + man_bits)
+    max_exp = (1 << exp_bits) - 1
+    n = 600
+
+    def operand():
+        special = [0, 0, max_exp, max_exp - 1, 1, 2]
+        exp = rng.choice(special + [rng.randrange(max_exp)] * 6)
+        return rng.randrange(2), exp, rng.randrange(1 << man_bits)
+
+    x = [operand() for _ in range(n)]
+    y = [operand() for _ in range(n)]
+    y[::5] = [(1 - s, e, m) for s, e, m in x[::5]]
+    a = APyFloatArray(*zip(*x), exp_bits=exp_bits, man_bits=man_bits)
+    b = APyFloatArray(*zip(*y), exp_bits=exp_bits, man_bits=man_bits)
+    with APyFloatQuantizationContext(QuantizationMode.TIES_EVEN):
+        res_add, res_sub, res_mul, res_div = a + b, a - b, a * b, a / b
+        for i in range(n):
+            ai, bi = a[i], b[i]
+            for res, ref in (
+                (res_add[i], ai + bi),
+                (res_sub[i], ai - bi),
+                (res_mul[i], ai * bi),
+                (res_div[i], ai / bi),
+            ):
+                assert res.is_identical(ref) or (res.is_nan and ref.is_nan)
+
+
+@pytest.mark.float_array
+def test_array_native_binary32_matches_numpy():
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(0)
+    x = (rng.standard_normal(1000) * 2.0 ** rng.integers(-140, 120, 1000)).astype(
+        np.float32
+    )
+    y = (rng.standard_normal(1000) * 2.0 ** rng.integers(-20, 20, 1000)).astype(
+        np.float32
+    )
+    a = APyFloatArray.from_float(x, exp_bits=8, man_bits=23)
+    b = APyFloatArray.from_float(y, exp_bits=8, man_bits=23)
+    with np.errstate(over="ignore", under="ignore"):
+        for res, ref in ((a + b, x + y), (a * b, x * y), (a / b, x / y)):
+            assert (res.to_numpy().astype(np.float32) == ref).all()
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TO_NEG,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.JAM,
+    ],
+)
+@pytest.mark.parametrize("formats", [((2, 1), (3, 2)), ((4, 3), (4, 3))])
+def test_array_small_formats_table(mode, formats):
+    # Formats of at most eight bits are computed with tables of all results
+    (x_exp_bits, x_man_bits), (y_exp_bits, y_man_bits) = formats
+    x = [
+        (s, e, m)
+        for s in range(2)
+        for e in range(2**x_exp_bits)
+        for m in range(2**x_man_bits)
+    ]
+    y = [
+        (s, e, m)
+        for s in range(2)
+        for e in range(2**y_exp_bits)
+        for m in range(2**y_man_bits)
+    ]
+    # All pairs, so that the tables are used. A sample of them is checked.
+    random.seed(41)
+    pairs = [(a, b) for a in x for b in y]
+    indices = random.sample(range(len(pairs)), min(len(pairs), 3000))
+    a = APyFloatArray(*zip(*(p[0] for p in pairs)), x_exp_bits, x_man_bits)
+    b = APyFloatArray(*zip(*(p[1] for p in pairs)), y_exp_bits, y_man_bits)
+    with APyFloatQuantizationContext(mode):
+        res_add, res_sub, res_mul, res_div = a + b, a - b, a * b, a / b
+        for i in indices:
+            ai, bi = a[i], b[i]
+            for res, ref in (
+                (res_add[i], ai + bi),
+                (res_sub[i], ai - bi),
+                (res_mul[i], ai * bi),
+                (res_div[i], ai / bi),
+            ):
+                assert res.is_identical(ref) or (res.is_nan and ref.is_nan)
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.RND_CONV,
+        QuantizationMode.TRN,
+        QuantizationMode.TRN_INF,
+        QuantizationMode.TRN_ZERO,
+    ],
+)
+@pytest.mark.parametrize(
+    "formats", [((8, 40), (8, 40)), ((6, 61), (6, 61)), ((11, 52), (5, 30))]
+)
+def test_array_two_word_mantissas(mode, formats, exact_float):
+    (x_exp_bits, x_man_bits), (y_exp_bits, y_man_bits) = formats
+    random.seed(x_man_bits + y_man_bits)
+    exact = exact_float(mode)
+
+    def operand(exp_bits, man_bits):
+        # Finite numbers only, so that no result is NaN
+        n = 200
+        return APyFloatArray(
+            [random.randint(0, 1) for _ in range(n)],
+            [random.randint(0, 2**exp_bits - 2) for _ in range(n)],
+            [random.getrandbits(man_bits) for _ in range(n)],
+            exp_bits,
+            man_bits,
+        )
+
+    # Results are checked against the exact results, quantized once
+    a = operand(x_exp_bits, x_man_bits)
+    b = operand(y_exp_bits, y_man_bits)
+    x_fmt = APyFloat(0, 0, 0, x_exp_bits, x_man_bits)
+    res_fmt = APyFloat(
+        0, 0, 0, max(x_exp_bits, y_exp_bits), max(x_man_bits, y_man_bits)
+    )
+    with APyFloatQuantizationContext(mode):
+        res_add, res_mul, res_div = a + b, a * b, a / b
+        for i in range(len(a)):
+            ai, bi = a[i], b[i]
+            for res, ref in (
+                (res_add[i], exact.add(ai, bi, res_fmt)),
+                (res_mul[i], exact.mul(ai, bi, res_fmt)),
+                (res_div[i], exact.div(ai, bi, res_fmt)),
+            ):
+                assert exact.matches(res, ref), (ai, bi, res, ref)
+
+        # Sequential sums and products
+        acc_sum = APyFloat(0, 0, 0, x_exp_bits, x_man_bits)
+        res_cumsum, res_cumprod = a.cumsum(), a.cumprod()
+        for i in range(len(a)):
+            acc_sum = exact.add(acc_sum, a[i], x_fmt)
+            acc_prod = a[0] if i == 0 else exact.mul(acc_prod, a[i], x_fmt)
+            assert exact.matches(res_cumsum[i], acc_sum)
+            assert exact.matches(res_cumprod[i], acc_prod)
+        assert exact.matches(a.sum(), acc_sum)
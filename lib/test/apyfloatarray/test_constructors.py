@@ -184,3 +184,67 @@ def test_c_striding():
     assert APyFloatArray.from_array(a.T, man_bits=10, exp_bits=10).is_identical(
         APyFloatArray.from_float([[1, 4], [2, 5], [3, 6]], man_bits=10, exp_bits=10)
     )
+
+
+def test_from_bits():
+    np = pytest.importorskip("numpy")
+
+    # Half precision, compared with NumPy
+    x = np.array([[1.0, -2.0, 0.5], [np.inf, -0.0, 1e-6]], dtype=np.float16)
+    a = APyFloatArray.from_bits(x.view(np.uint16), exp_bits=5, man_bits=10)
+    assert a.is_identical(
+        APyFloatArray.from_array(x.astype(np.float64), exp_bits=5, man_bits=10)
+    )
+
+    # FP8 and BF16, with signed dtypes read as unsigned
+    a = APyFloatArray.from_bits(
+        np.array([0b0_0111_000, 0b1_1111_111, 0b0_0000_001], dtype=np.uint8), 4, 3
+    )
+    assert a.is_identical(APyFloatArray([0, 1, 0], [7, 15, 0], [0, 7, 1], 4, 3))
+    a = APyFloatArray.from_bits(np.array([-1, 0x40], dtype=np.int8), 4, 3)
+    assert a.is_identical(APyFloatArray([1, 0], [15, 8], [7, 0], 4, 3))
+    a = APyFloatArray.from_bits(np.array([0x3F80, 0xC040], dtype=np.uint16), 8, 7)
+    assert a.is_identical(APyFloatArray.from_float([1.0, -3.0], 8, 7))
+
+    # Bits above the format are ignored, and the bias is kept
+    a = APyFloatArray.from_bits(np.array([0x13C00], dtype=np.uint64), 5, 10, bias=10)
+    assert a.is_identical(APyFloatArray([0], [15], [0], 5, 10, bias=10))
+
+
+def test_to_bits():
+    np = pytest.importorskip("numpy")
+
+    a = APyFloatArray([[0, 1], [1, 0]], [[7, 15], [0, 1]], [[0, 7], [1, 2]], 4, 3)
+    bits = a.to_bits()
+    assert bits.dtype == np.uint8
+    assert bits.tolist() == [[0b0_0111_000, 0b1_1111_111], [0b1_0000_001, 0b0_0001_010]]
+
+    x = np.array([1.0, -2.5, np.inf, 1e-40, -0.0])
+    for dt, exp_bits, man_bits, udt in [
+        (np.float16, 5, 10, np.uint16),
+        (np.float32, 8, 23, np.uint32),
+        (np.float64, 11, 52, np.uint64),
+    ]:
+        bits = APyFloatArray.from_array(x, exp_bits, man_bits).to_bits()
+        assert bits.dtype == udt
+        assert (bits == x.astype(dt).view(udt)).all()
+
+    # Round trip through an odd-sized format
+    bits = np.arange(2**12, dtype=np.uint16).reshape(64, 64)
+    assert (APyFloatArray.from_bits(bits, 5, 6).to_bits() == bits).all()
+    assert APyFloatArray([], [], [], 5, 10).to_bits().shape == (0,)
+
+
+def test_from_bits_raises():
+    np = pytest.importorskip("numpy")
+
+    with pytest.raises(ValueError, match=r"wider than 64 bits"):
+        APyFloatArray.from_bits(np.zeros(2, dtype=np.uint64), 11, 60)
+    with pytest.raises(ValueError, match=r"wider than 64 bits"):
+        APyFloatArray([0], [0], [0], 11, 60).to_bits()
+    with pytest.raises(ValueError, match=r"16-bit format does not fit in a 8-bit"):
+        APyFloatArray.from_bits(np.zeros(2, dtype=np.uint8), 5, 10)
+    with pytest.raises(ValueError, match=r"ndim == 0"):
+        APyFloatArray.from_bits(np.array(1, dtype=np.uint16), 5, 10)
+    with pytest.raises(TypeError, match=r"expected an integer ndarray"):
+        APyFloatArray.from_bits(np.zeros(2, dtype=np.float16), 5, 10)
@@ -1,5 +1,7 @@
 from apytypes import (
+    APyFloatAccumulatorContext,
     APyFloatArray,
+    QuantizationMode,
     convolve,
 )
 
@@ -116,3 +118,66 @@ def test_multi_limb_convolve_full():
     assert convolve(b, a, mode="same").is_identical(result_same)
     assert convolve(a, b, mode="valid").is_identical(result_valid)
     assert convolve(b, a, mode="valid").is_identical(result_valid)
+
+
+def _convolve_reference(a, b, a_fmt, b_fmt, mode):
+    # Each output sample is the inner product of the overlapping parts of `a` and the
+    # reversed `b`, with `a` the longer array
+    if len(a) < len(b):
+        a, b, a_fmt, b_fmt = b, a, b_fmt, a_fmt
+    full = []
+    for k in range(len(a) + len(b) - 1):
+        lo, hi = max(0, k - len(b) + 1), min(k, len(a) - 1)
+        x = APyFloatArray.from_float(a[lo : hi + 1], *a_fmt)
+        y = APyFloatArray.from_float(b[k - hi : k - lo + 1][::-1], *b_fmt)
+        full.append(x @ y)
+    if mode == "same":
+        begin = len(b) - 1 - len(b) // 2
+        return full[begin : begin + len(a)]
+    if mode == "valid":
+        return full[len(b) - 1 : len(a)]
+    return full
+
+
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+@pytest.mark.parametrize(
+    "acc", [(7, 6, QuantizationMode.TIES_EVEN), (5, 3, QuantizationMode.TO_ZERO)]
+)
+def test_convolve_accumulator_context(mode, acc):
+    a = [1.25, -2.5, 3.75, 0.0625, -4.0, 7.5, 1.125, -0.375, 2.0]
+    b = [5.5, 2.25, -1.5, 0.75]
+    a_fmt, b_fmt = (5, 4), (6, 3)
+    a_arr = APyFloatArray.from_float(a, *a_fmt)
+    b_arr = APyFloatArray.from_float(b, *b_fmt)
+    exp_bits, man_bits, quantization = acc
+    with APyFloatAccumulatorContext(
+        exp_bits=exp_bits, man_bits=man_bits, quantization=quantization
+    ):
+        reference = _convolve_reference(a, b, a_fmt, b_fmt, mode)
+        for res in (convolve(a_arr, b_arr, mode), convolve(b_arr, a_arr, mode)):
+            assert res.exp_bits == 6
+            assert res.man_bits == 4
+            assert len(res) == len(reference)
+            for r, ref in zip(res, reference):
+                assert r.is_identical(ref)
+
+
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+def test_convolve_exact_accumulation(mode):
+    a = [1.25, -2.5e3, 3.75, 0.0625, -4.0, 7.5e-3, 1.125]
+    b = [5.5, 2.25e2, -1.5]
+    a_fmt, b_fmt = (8, 7), (6, 10)
+    a_arr = APyFloatArray.from_float(a, *a_fmt)
+    b_arr = APyFloatArray.from_float(b, *b_fmt)
+    with APyFloatAccumulatorContext(exact=True):
+        reference = _convolve_reference(a, b, a_fmt, b_fmt, mode)
+        res = convolve(a_arr, b_arr, mode)
+    assert len(res) == len(reference)
+    for r, ref in zip(res, reference):
+        assert r.is_identical(ref)
+
+    # Formats without a bounded exact accumulator raise
+    wide = APyFloatArray.from_float([1.0, 2.0], exp_bits=15, man_bits=40)
+    with APyFloatAccumulatorContext(exact=True):
+        with pytest.raises(ValueError, match="exact accumulation requires"):
+            convolve(wide, wide)
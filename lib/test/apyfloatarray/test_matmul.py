@@ -605,3 +605,205 @@ def test_matrix_mul_acc_context_mixed_bias_overflow():
                 man_bits=2,
             )
         )
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "exp_bits,man_bits",
+    [(4, 3), (5, 10), (8, 7), (8, 23), (11, 52), (20, 50), (30, 61)],
+)
+def test_matmul_rhs_columns(exp_bits, man_bits):
+    # The columns of a 2-D `rhs` are gathered before the inner products. The result
+    # must match the products with each column on its own.
+    max_exp = (1 << exp_bits) - 1
+    max_man = (1 << man_bits) - 1
+    A = APyFloatArray(
+        [[0, 1, 0], [1, 0, 1]],
+        [[1, max_exp - 1, 2], [3, 1, max_exp - 2]],
+        [[max_man, 0, 1], [2, max_man // 3, 0]],
+        exp_bits=exp_bits,
+        man_bits=man_bits,
+    )
+    signs = [[1, 0, 0, 1], [0, 0, 1, 1], [1, 1, 0, 0]]
+    exps = [[1, 2, 3, max_exp - 1], [0, 1, 2, 3], [max_exp - 3, 2, 1, 0]]
+    mans = [[0, max_man, 5, 1], [max_man, 0, 0, 7], [3, 0, max_man // 5, 0]]
+    B = APyFloatArray(signs, exps, mans, exp_bits=exp_bits, man_bits=man_bits)
+    res = A @ B
+    for col in range(4):
+        B_col = APyFloatArray(
+            [row[col] for row in signs],
+            [row[col] for row in exps],
+            [row[col] for row in mans],
+            exp_bits=exp_bits,
+            man_bits=man_bits,
+        )
+        res_col = A @ B_col
+        for row in range(2):
+            assert res[row][col].is_identical(res_col[row])
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.JAM,
+    ],
+)
+@pytest.mark.parametrize("accumulator", [None, (6, 12)])
+def test_matmul_fused_matches_sequential(mode, accumulator):
+    # The fused inner products must match a sequential sum of quantized products
+    import random
+
+    random.seed(39)
+    A = APyFloatArray.from_float(
+        [[random.uniform(-4, 4) for _ in range(21)] for _ in range(7)],
+        exp_bits=5,
+        man_bits=7,
+    )
+    B = APyFloatArray.from_float(
+        [[random.uniform(-4, 4) for _ in range(5)] for _ in range(21)],
+        exp_bits=5,
+        man_bits=7,
+    )
+    if accumulator is None:
+        with APyFloatQuantizationContext(mode):
+            res = A @ B
+        acc_exp_bits, acc_man_bits = 5, 7
+    else:
+        acc_exp_bits, acc_man_bits = accumulator
+        with APyFloatAccumulatorContext(
+            exp_bits=acc_exp_bits, man_bits=acc_man_bits, quantization=mode
+        ):
+            res = A @ B
+
+    with APyFloatQuantizationContext(mode):
+        for row in range(7):
+            for col in range(5):
+                acc = APyFloat(0, 0, 0, acc_exp_bits, acc_man_bits)
+                for k in range(21):
+                    a = A[row][k].cast(acc_exp_bits, acc_man_bits)
+                    b = B[k][col].cast(acc_exp_bits, acc_man_bits)
+                    acc = acc + b * a
+                assert res[row][col].is_identical(acc.cast(5, 7))
+
+
+@pytest.mark.float_array
+def test_matmul_fused_large():
+    # Large enough to be computed in several blocks of columns, on several threads
+    A = APyFloatArray.from_float(
+        [[(3 * i + 5 * j) % 17 - 8.5 for j in range(600)] for i in range(24)],
+        exp_bits=8,
+        man_bits=10,
+    )
+    B_values = [[(7 * i + j) % 13 - 6.25 for j in range(40)] for i in range(600)]
+    B = APyFloatArray.from_float(B_values, exp_bits=8, man_bits=10)
+    res = A @ B
+    for col in range(40):
+        B_col = APyFloatArray.from_float(
+            [row[col] for row in B_values], exp_bits=8, man_bits=10
+        )
+        res_col = A @ B_col
+        for row in range(24):
+            assert res[row][col].is_identical(res_col[row])
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.JAM_UNBIASED,
+    ],
+)
+def test_matmul_exact_accumulation(mode):
+    import random
+
+    random.seed(40)
+    A_values = [[random.uniform(-4, 4) for _ in range(21)] for _ in range(7)]
+    B_values = [[random.uniform(-4, 4) for _ in range(5)] for _ in range(21)]
+    A = APyFloatArray.from_float(A_values, exp_bits=5, man_bits=7)
+    B = APyFloatArray.from_float(B_values, exp_bits=5, man_bits=7)
+    A_row = APyFloatArray.from_float(A_values[0], exp_bits=5, man_bits=7)
+    B_col = APyFloatArray.from_float(
+        [row[0] for row in B_values], exp_bits=5, man_bits=7
+    )
+    with APyFloatAccumulatorContext(exact=True, quantization=mode):
+        res = A @ B
+        vec = A_row @ B_col
+
+    # The partial sums are exact in a wide format, so the reference is quantized once
+    for row in range(7):
+        for col in range(5):
+            acc = APyFloat(0, 0, 0, 20, 60)
+            for k in range(21):
+                acc = acc + A[row][k].cast(20, 60) * B[k][col].cast(20, 60)
+            ref = acc.cast(5, 7, quantization=mode)
+            assert res[row][col].is_identical(ref)
+    assert vec.is_identical(res[0][0])
+
+
+@pytest.mark.float_array
+def test_matmul_exact_accumulation_special():
+    # Exact accumulation does not lose the small term to the large ones
+    a = APyFloatArray.from_float([1024, 1, -1024], exp_bits=5, man_bits=3)
+    b = APyFloatArray.from_float([1, 1, 1], exp_bits=5, man_bits=3)
+    assert (a @ b).is_identical(APyFloat.from_float(0, exp_bits=5, man_bits=3))
+    with APyFloatAccumulatorContext(exact=True):
+        assert (a @ b).is_identical(APyFloat.from_float(1, exp_bits=5, man_bits=3))
+
+    # Overflow, infinities, and NaN
+    a = APyFloatArray.from_float([60000, 60000, -1], exp_bits=5, man_bits=10)
+    b = APyFloatArray.from_float([1, 1, 60000], exp_bits=5, man_bits=10)
+    with APyFloatAccumulatorContext(exact=True):
+        assert (a @ b).is_identical(APyFloat.from_float(60000, 5, 10))
+        a = APyFloatArray.from_float([60000, 60000], exp_bits=5, man_bits=10)
+        b = APyFloatArray.from_float([1, 1], exp_bits=5, man_bits=10)
+        assert (a @ b).is_identical(APyFloat.from_float(float("inf"), 5, 10))
+        c = APyFloatArray.from_float([float("inf"), 1], exp_bits=5, man_bits=10)
+        assert (c @ c).is_identical(APyFloat.from_float(float("inf"), 5, 10))
+        d = APyFloatArray.from_float([float("inf"), 0], exp_bits=5, man_bits=10)
+        e = APyFloatArray.from_float([0, float("inf")], exp_bits=5, man_bits=10)
+        assert (d @ e).is_nan
+
+    # Formats without a bounded exact accumulator, and accumulator formats, raise
+    x = APyFloatArray.from_float([1, 2], exp_bits=15, man_bits=10)
+    with APyFloatAccumulatorContext(exact=True):
+        with pytest.raises(ValueError, match="exact accumulation requires"):
+            _ = x @ x
+    with pytest.raises(ValueError, match="can not be specified"):
+        APyFloatAccumulatorContext(exp_bits=5, man_bits=10, exact=True)
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("mode", [QuantizationMode.TIES_EVEN, QuantizationMode.TO_POS])
+@pytest.mark.parametrize("shape", [(4, 9, 3), (16, 64, 16)])
+def test_matmul_small_formats_table(mode, shape):
+    # The products of formats of at most eight bits are looked up in a table, if there
+    # are enough of them
+    import random
+
+    random.seed(41)
+    rows, inner, cols = shape
+    A = APyFloatArray.from_float(
+        [[random.uniform(-4, 4) for _ in range(inner)] for _ in range(rows)],
+        exp_bits=4,
+        man_bits=3,
+    )
+    B = APyFloatArray.from_float(
+        [[random.uniform(-4, 4) for _ in range(cols)] for _ in range(inner)],
+        exp_bits=4,
+        man_bits=3,
+    )
+    with APyFloatQuantizationContext(mode):
+        res = A @ B
+        for row in range(rows):
+            for col in range(cols):
+                acc = APyFloat(0, 0, 0, 4, 3)
+                for k in range(inner):
+                    acc = acc + B[k][col] * A[row][k]
+                assert res[row][col].is_identical(acc)
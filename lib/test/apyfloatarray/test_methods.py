@@ -1,5 +1,10 @@
 import pytest
-from apytypes import APyFloatArray, APyFloat, QuantizationMode
+from apytypes import (
+    APyFloat,
+    APyFloatArray,
+    APyFloatQuantizationContext,
+    QuantizationMode,
+)
 
 
 @pytest.mark.float_array
@@ -237,6 +242,80 @@ def test_cast():
     assert fp_array.cast(man_bits=5).is_identical(ans)
 
 
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_NEG,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.TIES_AWAY,
+        QuantizationMode.JAM,
+        QuantizationMode.RND_CONV_ODD,
+    ],
+)
+@pytest.mark.parametrize(
+    "src, dst",
+    [
+        ((8, 23), (5, 10)),
+        ((8, 23), (8, 7)),
+        ((11, 52), (8, 23)),
+        ((10, 15), (4, 3)),
+        ((5, 10), (8, 2)),
+    ],
+)
+def test_cast_matches_scalar(mode, src, dst):
+    # Normal, subnormal, and special values of the source format
+    exp_bits, man_bits = src
+    exps = {0, 1, 2, 2 ** (exp_bits - 1), 2**exp_bits - 2}
+    # Exponents around the subnormal range of the destination format
+    bias_delta = 2 ** (exp_bits - 1) - 2 ** (dst[0] - 1)
+    offsets = (-1, 0, 1, 3, dst[1], dst[1] + 1)
+    exps |= {bias_delta - k for k in offsets if bias_delta > k}
+    values = [
+        APyFloat(sign, exp, man, exp_bits, man_bits)
+        for sign in (0, 1)
+        for exp in exps
+        for man in (0, 1, 3, 2 ** (man_bits - 1) + 1, 2**man_bits - 1)
+    ]
+    values += [APyFloat(0, 2**exp_bits - 1, 0, exp_bits, man_bits)]
+    values += [APyFloat(1, 2**exp_bits - 1, 5, exp_bits, man_bits)]
+    arr = APyFloatArray(
+        [v.sign for v in values],
+        [v.exp for v in values],
+        [v.man for v in values],
+        exp_bits,
+        man_bits,
+    )
+    res = arr.cast(*dst, quantization=mode)
+    for r, v in zip(res, values):
+        assert r.is_identical(v.cast(*dst, quantization=mode))
+
+    # Widening back to the source format
+    res = res.cast(*src)
+    for r, v in zip(res, values):
+        assert r.is_identical(v.cast(*dst, quantization=mode).cast(*src))
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("dst", [(5, 10), (8, 7)])
+@pytest.mark.parametrize("mode", [QuantizationMode.TIES_EVEN, QuantizationMode.TO_ZERO])
+def test_cast_large_array(dst, mode):
+    # Large enough to be cast in chunks on several threads. Values above 65504
+    # overflow in binary16.
+    import random
+
+    random.seed(38)
+    n = 2**18 + 3
+    arr = APyFloatArray.from_float(
+        [random.uniform(-1e5, 1e5) for _ in range(n)], exp_bits=8, man_bits=23
+    )
+    res = arr.cast(*dst, quantization=mode)
+    for i in [*range(0, n, 997), n - 1]:
+        assert res[i].is_identical(arr[i].cast(*dst, quantization=mode))
+
+
 @pytest.mark.float_array
 def test_python_sum():
     fx_array = APyFloatArray.from_float([1, 2, 3, 4, 5, 6], exp_bits=10, man_bits=10)
@@ -985,6 +1064,54 @@ def test_nancumprod():
     )
 
 
+@pytest.mark.parametrize("man_bits", [10, 60])
+@pytest.mark.parametrize("func", ["cumsum", "nancumsum", "cumprod", "nancumprod"])
+def test_cumulative_matches_scalar(func, man_bits):
+    # The scanning kernels (and the scalar fallback for 60 mantissa bits) give the
+    # same result as scalar arithmetic along each lane
+    rows, cols = 23, 19
+    values = [
+        [0.75 + ((r * 7 + c * 3) % 11) / 16 for c in range(cols)] for r in range(rows)
+    ]
+    values[3][5] = values[11][0] = float("nan")
+    a = APyFloatArray.from_float(values, exp_bits=8, man_bits=man_bits)
+    is_prod = func.endswith("prod")
+    identity = APyFloat.from_float(float(is_prod), exp_bits=8, man_bits=man_bits)
+
+    def scan(lane):
+        res = []
+        for x in lane:
+            if func.startswith("nan") and x.is_nan:
+                x = identity
+            if not res:
+                res.append(x if is_prod else identity + x)
+            else:
+                res.append(res[-1] * x if is_prod else res[-1] + x)
+        return res
+
+    for quantization in (QuantizationMode.TIES_EVEN, QuantizationMode.TO_NEG):
+        with APyFloatQuantizationContext(quantization):
+            flat = scan([a[r][c] for r in range(rows) for c in range(cols)])
+            res = getattr(a, func)()
+            assert all(res[i].is_identical(flat[i]) for i in range(rows * cols))
+
+            columns = [scan([a[r][c] for r in range(rows)]) for c in range(cols)]
+            res = getattr(a, func)(0)
+            assert all(
+                res[r][c].is_identical(columns[c][r])
+                for r in range(rows)
+                for c in range(cols)
+            )
+
+            lanes = [scan([a[r][c] for c in range(cols)]) for r in range(rows)]
+            res = getattr(a, func)(1)
+            assert all(
+                res[r][c].is_identical(lanes[r][c])
+                for r in range(rows)
+                for c in range(cols)
+            )
+
+
 @pytest.mark.parametrize("max_func", ["max", "nanmax"])
 def test_max(max_func):
     a = APyFloatArray.from_float([[0, 1], [2, 3]], exp_bits=10, man_bits=10)
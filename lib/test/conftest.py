@@ -1,3 +1,7 @@
+from fractions import Fraction
+
+import pytest
+
 import apytypes
 
 
@@ -12,3 +16,110 @@ def pytest_collection_finish(session):
         print(f" * NumPy version: {np.__version__}")
     except ImportError:
         print(" * No NumPy support detected")
+
+
+class ExactFloat:
+    """
+    Reference floating-point arithmetic that does not use the APyTypes kernels. The
+    exact result of an operation is computed using :class:`fractions.Fraction` and
+    quantized once to the format of the APyTypes result `like`, which is only used for
+    its format.
+
+    Only the quantization modes that are a function of the exact result are supported.
+    """
+
+    def __init__(self, mode):
+        QM = apytypes.QuantizationMode
+        self._round_up = {
+            QM.RND_CONV: lambda q, r, half, sign: r > half or (r == half and q % 2),
+            QM.TRN: lambda q, r, half, sign: sign and r != 0,
+            QM.TRN_INF: lambda q, r, half, sign: not sign and r != 0,
+            QM.TRN_ZERO: lambda q, r, half, sign: False,
+        }[mode]
+        self._overflow_to_inf = {
+            QM.RND_CONV: lambda sign: True,
+            QM.TRN: lambda sign: sign,
+            QM.TRN_INF: lambda sign: not sign,
+            QM.TRN_ZERO: lambda sign: False,
+        }[mode]
+        self._zero_sum_sign = mode == QM.TRN
+
+    @staticmethod
+    def value(x):
+        """Exact value of a finite :class:`APyFloat`."""
+        man = x.man if x.exp == 0 else x.man + (1 << x.man_bits)
+        return man * Fraction(2) ** (max(x.exp, 1) - x.bias - x.man_bits)
+
+    @staticmethod
+    def _special(sign, like, man):
+        exp = (1 << like.exp_bits) - 1
+        return apytypes.APyFloat(
+            sign, exp, man, like.exp_bits, like.man_bits, like.bias
+        )
+
+    def quantize(self, value, sign, like):
+        """Quantize the magnitude `value`, with sign `sign`, to the format of `like`."""
+        exp_bits, man_bits, bias = like.exp_bits, like.man_bits, like.bias
+        if value == 0:
+            return apytypes.APyFloat(sign, 0, 0, exp_bits, man_bits, bias)
+
+        # Biased exponent, which is zero for subnormal results, and quantization step
+        e = value.numerator.bit_length() - value.denominator.bit_length()
+        if Fraction(2) ** e > value:
+            e -= 1
+        exp = max(e + bias, 0)
+        step = Fraction(2) ** (max(exp, 1) - bias - man_bits)
+        q, r = divmod(value, step)
+        q += bool(self._round_up(q, r, step / 2, sign))
+
+        # Carry into the exponent
+        if q >> (man_bits + (exp != 0)):
+            exp += 1
+            q >>= exp != 1
+        man = q & ((1 << man_bits) - 1)
+
+        if exp >= (1 << exp_bits) - 1:
+            if self._overflow_to_inf(sign):
+                return self._special(sign, like, 0)
+            exp, man = (1 << exp_bits) - 2, (1 << man_bits) - 1
+        return apytypes.APyFloat(sign, exp, man, exp_bits, man_bits, bias)
+
+    def add(self, x, y, like):
+        if x.is_nan or y.is_nan or (x.is_inf and y.is_inf and x.sign != y.sign):
+            return self._special(0, like, 1)
+        if x.is_inf or y.is_inf:
+            return self._special(x.sign if x.is_inf else y.sign, like, 0)
+        value = (-1) ** x.sign * self.value(x) + (-1) ** y.sign * self.value(y)
+        if value == 0:
+            sign = x.sign if x.sign == y.sign else self._zero_sum_sign
+            return self.quantize(value, sign, like)
+        return self.quantize(abs(value), value < 0, like)
+
+    def mul(self, x, y, like):
+        sign = x.sign != y.sign
+        if x.is_nan or y.is_nan or (x.is_inf and y.is_zero or x.is_zero and y.is_inf):
+            return self._special(0, like, 1)
+        if x.is_inf or y.is_inf:
+            return self._special(sign, like, 0)
+        return self.quantize(self.value(x) * self.value(y), sign, like)
+
+    def div(self, x, y, like):
+        sign = x.sign != y.sign
+        if x.is_nan or y.is_nan or (x.is_inf and y.is_inf or x.is_zero and y.is_zero):
+            return self._special(0, like, 1)
+        if x.is_inf or y.is_zero:
+            return self._special(sign, like, 0)
+        if y.is_inf:
+            return self.quantize(0, sign, like)
+        return self.quantize(self.value(x) / self.value(y), sign, like)
+
+    @staticmethod
+    def matches(res, ref):
+        """Check an APyTypes result against a reference result."""
+        return res.is_nan if ref.is_nan else res.is_identical(ref)
+
+
+@pytest.fixture
+def exact_float():
+    """Factory of :class:`ExactFloat` reference arithmetic for a quantization mode."""
+    return ExactFloat
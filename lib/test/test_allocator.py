@@ -0,0 +1,36 @@
+import apytypes
+from apytypes import APyFixedArray
+
+
+def test_allocator_stats_keys():
+    stats = apytypes._get_allocator_stats()
+    assert set(stats) == {"hits", "misses", "oversized", "cached", "released"}
+    assert all(isinstance(v, int) and v >= 0 for v in stats.values())
+
+
+def test_allocator_reuses_small_buffers():
+    a = APyFixedArray.from_float([1.0, 2.0, 3.0], int_bits=10, frac_bits=10)
+    apytypes._reset_allocator_stats()
+    for _ in range(100):
+        b = a + a
+        del b
+    stats = apytypes._get_allocator_stats()
+    assert stats["hits"] > 0
+    assert stats["cached"] > 0
+
+
+def test_allocator_large_buffers_not_pooled():
+    apytypes._reset_allocator_stats()
+    a = APyFixedArray([0] * 20000, bits=500, int_bits=250)
+    assert a.shape == (20000,)
+    assert apytypes._get_allocator_stats()["oversized"] > 0
+
+
+def test_allocator_results_unchanged():
+    a = APyFixedArray([1, 2, 3], bits=100, int_bits=50)
+    b = APyFixedArray([4, 5, 6], bits=100, int_bits=50)
+    for _ in range(10):
+        assert (a * b).is_identical(
+            APyFixedArray([4, 10, 18], bits=200, int_bits=100)
+        )
+        assert (a @ b).is_identical(APyFixedArray([32], bits=202, int_bits=102))
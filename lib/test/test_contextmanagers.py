@@ -4,6 +4,7 @@ from apytypes import (
     OverflowMode,
     APyFixed,
     APyFixedArray,
+    APyFloatArray,
     APyFloatAccumulatorContext,
     APyFixedAccumulatorContext,
     APyFloatQuantizationContext,
@@ -339,3 +340,119 @@ class TestQuantizationContext:
         with pytest.raises(ValueError, match="Seed"):
             with APyFloatQuantizationContext(QuantizationMode.TO_POS, 123):
                 pass
+
+
+class TestThreadLocalContext:
+    """
+    Contexts entered on one thread must not affect other threads.
+    """
+
+    @staticmethod
+    def _run_in_thread(fn):
+        from concurrent.futures import ThreadPoolExecutor
+
+        with ThreadPoolExecutor(max_workers=1) as pool:
+            return pool.submit(fn).result()
+
+    def test_quantization_mode_is_thread_local(self):
+        set_float_quantization_mode(QuantizationMode.TO_POS)
+        # A new thread starts with the default mode
+        assert (
+            self._run_in_thread(get_float_quantization_mode)
+            == QuantizationMode.RND_CONV
+        )
+
+        def set_in_thread():
+            set_float_quantization_mode(QuantizationMode.TO_NEG)
+            return get_float_quantization_mode()
+
+        assert self._run_in_thread(set_in_thread) == QuantizationMode.TO_NEG
+        assert get_float_quantization_mode() == QuantizationMode.TO_POS
+        set_float_quantization_mode(QuantizationMode.RND_CONV)
+
+    def test_seed_is_thread_local(self):
+        set_float_quantization_seed(123)
+
+        def set_in_thread():
+            set_float_quantization_seed(456)
+            return get_float_quantization_seed()
+
+        assert self._run_in_thread(set_in_thread) == 456
+        assert get_float_quantization_seed() == 123
+
+    def test_cast_context_is_thread_local(self):
+        a = APyFixed.from_float(1.25, int_bits=3, frac_bits=2)
+
+        def cast():
+            return a.cast(int_bits=3, frac_bits=1)
+
+        with APyFixedCastContext(quantization=QuantizationMode.TRN_INF):
+            # Other threads still use the default TRN
+            assert self._run_in_thread(cast).is_identical(
+                APyFixed(2, bits=4, int_bits=3)
+            )
+            assert cast().is_identical(APyFixed(3, bits=4, int_bits=3))
+
+    def test_accumulator_context_is_thread_local(self):
+        a = APyFixedArray.from_float([0.75, 0.75], int_bits=2, frac_bits=2)
+
+        def inner_product():
+            return a @ a
+
+        reference = inner_product()
+        with APyFixedAccumulatorContext(int_bits=2, frac_bits=1):
+            assert self._run_in_thread(inner_product).is_identical(reference)
+            assert not inner_product().is_identical(reference)
+
+    def test_parallel_contexts(self):
+        import threading
+
+        barrier = threading.Barrier(4)
+        modes = [
+            QuantizationMode.TO_POS,
+            QuantizationMode.TO_NEG,
+            QuantizationMode.TO_ZERO,
+            QuantizationMode.TIES_EVEN,
+        ]
+
+        def worker(mode):
+            with APyFloatQuantizationContext(mode):
+                barrier.wait()
+                return get_float_quantization_mode()
+
+        from concurrent.futures import ThreadPoolExecutor
+
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            assert list(pool.map(worker, modes)) == modes
+
+    def test_context_entered_on_other_thread(self):
+        set_float_quantization_mode(QuantizationMode.TO_POS)
+        context = APyFloatQuantizationContext(QuantizationMode.TO_NEG)
+
+        def enter_in_thread():
+            with context:
+                inside = get_float_quantization_mode()
+            # Restores the state of the entering thread, not the constructing one
+            return inside, get_float_quantization_mode()
+
+        assert self._run_in_thread(enter_in_thread) == (
+            QuantizationMode.TO_NEG,
+            QuantizationMode.RND_CONV,
+        )
+        assert get_float_quantization_mode() == QuantizationMode.TO_POS
+        set_float_quantization_mode(QuantizationMode.RND_CONV)
+
+    def test_float_accumulator_context_entered_on_other_thread(self):
+        a = APyFloatArray.from_float([1.0, 2.0**-4], exp_bits=5, man_bits=4)
+        b = APyFloatArray.from_float([1.0, 1.0], exp_bits=5, man_bits=4)
+        # The unspecified accumulator quantization is that of the entering thread
+        set_float_quantization_mode(QuantizationMode.TO_POS)
+        context = APyFloatAccumulatorContext(exp_bits=5, man_bits=2)
+        set_float_quantization_mode(QuantizationMode.RND_CONV)
+
+        def inner_product():
+            with context:
+                return a @ b
+
+        # Rounds to 1.25 with TO_POS
+        assert float(self._run_in_thread(inner_product)) == 1.0
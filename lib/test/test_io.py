@@ -0,0 +1,133 @@
+import io
+
+import pytest
+
+import apytypes
+from apytypes import APyFixedArray, APyFloatArray
+
+np = pytest.importorskip("numpy")
+
+
+@pytest.mark.parametrize("lazy", [False, True])
+@pytest.mark.parametrize("bits", [10, 64, 100, 250])
+def test_save_load_fixed(tmp_path, lazy, bits):
+    a = APyFixedArray.from_float(
+        [[1.0, -2.5, 3.25], [-4.0, 0.0, -0.75]], bits=bits, int_bits=bits // 2
+    )
+    apytypes.save(tmp_path / "a.apy", a)
+    b = apytypes.load(tmp_path / "a.apy", lazy=lazy)
+    if lazy:
+        assert isinstance(b, apytypes.LazyArray)
+        assert (b.shape, b.bits, b.int_bits) == (a.shape, a.bits, a.int_bits)
+        b = b.to_array()
+    assert isinstance(b, APyFixedArray)
+    assert b.is_identical(a)
+
+
+@pytest.mark.parametrize("lazy", [False, True])
+@pytest.mark.parametrize("man_bits", [3, 60])
+def test_save_load_float(tmp_path, lazy, man_bits):
+    a = APyFloatArray(
+        [[0, 1, 1], [0, 0, 1]],
+        [[3, 7, 0], [15, 1, 4]],
+        [[1, 0, 5], [0, 7, 2]],
+        exp_bits=4,
+        man_bits=man_bits,
+        bias=5,
+    )
+    apytypes.save(str(tmp_path / "a.apy"), a)
+    b = apytypes.load(str(tmp_path / "a.apy"), lazy=lazy)
+    if lazy:
+        assert isinstance(b, apytypes.LazyArray)
+        b = b.to_array()
+    assert isinstance(b, APyFloatArray)
+    assert b.is_identical(a)
+
+
+def test_save_load_file_object():
+    a = APyFixedArray([1, 2, 3, 4], bits=20, int_bits=10).reshape((2, 2))
+    f = io.BytesIO()
+    f.write(b"prefix")
+    apytypes.save(f, a)
+    f.seek(len(b"prefix"))
+    assert apytypes.load(f, lazy=False).is_identical(a)
+
+
+def test_save_load_header_alignment(tmp_path):
+    a = APyFloatArray.from_float([1.0, 2.0, -3.0], exp_bits=8, man_bits=23)
+    apytypes.save(tmp_path / "a.apy", a)
+    raw = (tmp_path / "a.apy").read_bytes()
+    assert raw[:8] == b"APYTYPES"
+    assert len(raw) == 64 + 4 * 3
+    assert raw[64:] == np.array([1.0, 2.0, -3.0], dtype="<f4").tobytes()
+
+
+@pytest.mark.parametrize(
+    "a",
+    [
+        APyFixedArray([[1, 2], [3, 4], [5, 6]], bits=100, int_bits=50),
+        APyFloatArray.from_float([[1, 2], [3, 4], [5, 6]], exp_bits=5, man_bits=10),
+        APyFloatArray.from_float([[1, 2], [3, 4], [5, 6]], exp_bits=11, man_bits=60),
+    ],
+)
+def test_lazy_array(tmp_path, a):
+    apytypes.save(tmp_path / "a.apy", a)
+    view = apytypes.load(tmp_path / "a.apy", lazy=True)
+    assert len(view) == 3
+    assert view.ndim == 2
+    assert repr(view).startswith("LazyArray(shape=(3, 2), ")
+
+    ref = a.to_numpy()
+    assert view[1:].shape == (2, 2)
+    assert (view[1:].to_numpy() == ref[1:]).all()
+    assert (view[::2].to_numpy() == ref[::2]).all()
+    assert (view[-1].to_numpy() == ref[-1]).all()
+    assert view[3:].shape == (0, 2)
+    assert view.to_array().is_identical(a)
+    with pytest.raises(IndexError):
+        view[3]
+    with pytest.raises(TypeError, match="only int and slice"):
+        view[0, 1]
+
+    # Blocks are copied out of the file one at a time
+    blocks = list(apytypes.stream(view, block_size=2))
+    assert [block.shape for block in blocks] == [(2, 2), (1, 2)]
+    assert (blocks[1].to_numpy() == ref[2:]).all()
+
+
+def test_lazy_array_scalar_index(tmp_path):
+    a = APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    apytypes.save(tmp_path / "a.apy", a)
+    view = apytypes.load(tmp_path / "a.apy", lazy=True)
+    assert view[np.int64(1)].is_identical(a[1])
+
+
+def test_limb_roundtrip():
+    a = APyFixedArray([0, 1, 2**99], bits=100, int_bits=30)
+    b = APyFixedArray._from_limbs(a._limb_view(), bits=100, int_bits=30)
+    assert b.is_identical(a)
+    assert a._limb_view().shape[:-1] == a.shape
+    assert a._limb_view().itemsize == apytypes._apytypes._LIMB_SIZE_BYTES
+    assert not a._limb_view().flags.writeable
+
+    with pytest.raises(ValueError):
+        APyFixedArray._from_limbs(np.zeros((3, 1), dtype=np.uint64), 100, 30)
+
+
+def test_load_errors(tmp_path):
+    (tmp_path / "bad.apy").write_bytes(b"NOTAPYTY" + bytes(56))
+    with pytest.raises(ValueError, match="not an APyTypes array file"):
+        apytypes.load(tmp_path / "bad.apy")
+
+    with pytest.raises(TypeError):
+        apytypes.save(tmp_path / "bad.apy", [1, 2, 3])
+
+    with pytest.raises(ValueError, match="field out of range"):
+        APyFloatArray._from_fields(
+            np.zeros(2, dtype=np.uint8),
+            np.array([0, 16], dtype=np.uint32),
+            np.zeros(2, dtype=np.uint64),
+            4,
+            3,
+            7,
+        )
@@ -0,0 +1,42 @@
+import pickle
+
+import pytest
+
+from apytypes import APyFixedArray, APyFloatArray
+
+pytest.importorskip("numpy")
+
+
+@pytest.mark.parametrize("protocol", range(2, pickle.HIGHEST_PROTOCOL + 1))
+@pytest.mark.parametrize("bits", [7, 64, 200])
+def test_pickle_fixed(protocol, bits):
+    a = APyFixedArray.from_float(
+        [[1.5, -2.0, 0.25], [-0.125, 3.0, -7.75]], bits=bits, int_bits=bits // 2
+    )
+    b = pickle.loads(pickle.dumps(a, protocol=protocol))
+    assert isinstance(b, APyFixedArray)
+    assert b.is_identical(a)
+
+
+@pytest.mark.parametrize("protocol", range(2, pickle.HIGHEST_PROTOCOL + 1))
+def test_pickle_float(protocol):
+    a = APyFloatArray([[0, 1], [1, 0]], [[3, 0], [15, 7]], [[7, 1], [0, 2]], 4, 3, 6)
+    b = pickle.loads(pickle.dumps(a, protocol=protocol))
+    assert isinstance(b, APyFloatArray)
+    assert b.is_identical(a)
+
+
+@pytest.mark.skipif(pickle.HIGHEST_PROTOCOL < 5, reason="requires pickle protocol 5")
+def test_pickle_out_of_band():
+    a = APyFixedArray(list(range(1000)), bits=150, int_bits=50)
+    buffers = []
+    data = pickle.dumps(a, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    assert len(data) < 1000
+    assert pickle.loads(data, buffers=buffers).is_identical(a)
+
+    f = APyFloatArray.from_float(list(range(1000)), exp_bits=8, man_bits=23)
+    buffers = []
+    data = pickle.dumps(f, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 3
+    assert pickle.loads(data, buffers=buffers).is_identical(f)
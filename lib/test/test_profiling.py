@@ -0,0 +1,76 @@
+import json
+
+import apytypes
+from apytypes import APyFixedArray, APyFloatArray, profiling
+
+
+def test_profiling_disabled_by_default():
+    profiling.disable()
+    profiling.reset()
+    a = APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    _ = a + a
+    assert not profiling.is_enabled()
+    assert profiling.stats() == {}
+
+
+def test_profiling_fixed_paths():
+    a = APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    b = APyFixedArray([1, 2, 3], bits=200, int_bits=100)
+    with profiling.profile():
+        _ = a + a
+        _ = b + b
+        _ = a * a
+    assert not profiling.is_enabled()
+
+    stats = profiling.stats()
+    assert stats["fixed.add_sub.single_limb_simd"]["calls"] == 1
+    assert stats["fixed.add_sub.single_limb_simd"]["elements"] == 3
+    assert stats["fixed.add_sub.equal_limbs_mpn"]["calls"] == 1
+    assert stats["fixed.mul.single_limb_simd"]["calls"] == 1
+    for counters in stats.values():
+        assert set(counters) == {"calls", "elements", "bytes_allocated", "ns"}
+
+
+def test_profiling_broadcast_and_bytes():
+    a = APyFixedArray([[1, 2, 3]] * 4, bits=10, int_bits=5)
+    b = APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    with profiling.profile():
+        _ = a + b
+    stats = profiling.stats()
+    assert stats["fixed.broadcast"]["calls"] == 2
+    assert stats["fixed.broadcast"]["elements"] == 24
+    assert stats["fixed.broadcast"]["bytes_allocated"] > 0
+
+
+def test_profiling_float_paths():
+    a = APyFloatArray.from_float([1.0, 2.0], exp_bits=5, man_bits=10)
+    b = APyFloatArray.from_float([1.0, 2.0], exp_bits=11, man_bits=52)
+    with profiling.profile():
+        _ = a * a
+        _ = b * b
+    stats = profiling.stats()
+    assert stats["float.mul.fast"]["elements"] == 2
+    assert stats["float.mul.wide"]["elements"] == 2
+
+
+def test_profiling_chrome_trace(tmp_path):
+    a = APyFixedArray([1, 2, 3], bits=10, int_bits=5)
+    with profiling.profile(trace=True):
+        for _ in range(3):
+            _ = a + a
+    path = tmp_path / "trace.json"
+    profiling.dump_chrome_trace(path)
+    with open(path) as f:
+        trace = json.load(f)
+    events = [
+        e
+        for e in trace["traceEvents"]
+        if e["name"] == "fixed.add_sub.single_limb_simd"
+    ]
+    assert len(events) == 3
+    assert all(e["ph"] == "X" and e["dur"] >= 0 for e in events)
+    assert events[0]["args"]["elements"] == 3
+
+    profiling.reset()
+    assert profiling.stats() == {}
+    assert apytypes.profiling is profiling
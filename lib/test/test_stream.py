@@ -0,0 +1,77 @@
+import pytest
+
+import apytypes
+from apytypes import APyFixedArray, APyFloatArray, StreamingFIR
+
+np = pytest.importorskip("numpy")
+
+
+def _concat(blocks):
+    return np.concatenate([b.to_numpy() for b in blocks])
+
+
+@pytest.mark.parametrize("prefetch", [0, 1, 3])
+@pytest.mark.parametrize("block_size", [1, 4, 7, 100])
+def test_stream_fir_fixed(prefetch, block_size):
+    x = APyFixedArray.from_float(
+        [0.5, -1.0, 2.25, 3.0, -0.75, 1.5, 0.0, -2.0, 1.25, 0.5], int_bits=4, frac_bits=2
+    )
+    h = APyFixedArray.from_float([0.25, -0.5, 1.0], int_bits=2, frac_bits=2)
+    ref = apytypes.convolve(x, h)
+    blocks = list(
+        apytypes.stream(x, StreamingFIR(h), block_size=block_size, prefetch=prefetch)
+    )
+    assert len(blocks) == -(-10 // block_size)
+    assert np.array_equal(_concat(blocks), ref.to_numpy()[:10])
+
+
+def test_stream_fir_float():
+    x = APyFloatArray.from_float([1.0, 2.0, -3.0, 0.5, 4.0], exp_bits=8, man_bits=10)
+    h = APyFloatArray.from_float([1.0, 0.5], exp_bits=8, man_bits=10)
+    blocks = apytypes.stream(x, StreamingFIR(h), block_size=2)
+    assert np.array_equal(_concat(blocks), [1.0, 2.5, -2.0, -1.0, 4.25])
+
+
+def test_stream_numpy_memmap(tmp_path):
+    x = np.linspace(-1, 1, 50)
+    np.save(tmp_path / "x.npy", x)
+    source = np.load(tmp_path / "x.npy", mmap_mode="r")
+    blocks = apytypes.stream(
+        source,
+        lambda b: APyFixedArray.from_float(b, int_bits=2, frac_bits=10),
+        lambda b: b.cast(int_bits=2, frac_bits=4),
+        block_size=16,
+    )
+    ref = APyFixedArray.from_float(x, int_bits=2, frac_bits=10).cast(
+        int_bits=2, frac_bits=4
+    )
+    assert np.array_equal(_concat(blocks), ref.to_numpy())
+
+
+def test_stream_generator_and_errors():
+    def gen():
+        for i in range(3):
+            yield APyFixedArray([i, i + 1], bits=8, int_bits=8)
+        raise KeyError("source failed")
+
+    results = []
+    with pytest.raises(KeyError, match="source failed"):
+        for block in apytypes.stream(gen(), lambda b: b + b, prefetch=2):
+            results.append(block)
+    assert len(results) == 3
+
+    # Arguments are validated by the call, not when the first block is pulled
+    with pytest.raises(ValueError, match="block_size must be positive"):
+        apytypes.stream([], block_size=0)
+    with pytest.raises(ValueError, match="prefetch must be non-negative"):
+        apytypes.stream([], prefetch=-1)
+    with pytest.raises(TypeError, match="is not callable"):
+        apytypes.stream([], 1)
+    with pytest.raises(ValueError):
+        StreamingFIR(APyFixedArray([[1]], bits=4, int_bits=4))
+
+    # Multi-dimensional blocks are rejected instead of being filtered incorrectly
+    fir = StreamingFIR(APyFixedArray([1, 1], bits=4, int_bits=4))
+    x = APyFixedArray([[1, 2], [3, 4]], bits=8, int_bits=8)
+    with pytest.raises(ValueError, match=r"one-dimensional, got a block of shape"):
+        list(apytypes.stream(x, fir, block_size=1))
@@ -0,0 +1,103 @@
+import sys
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+from apytypes import APyFixedArray, APyFloatArray
+
+# Large enough for the kernels to release the GIL
+N = 20000
+
+
+def _run_parallel(fn, n_threads=4):
+    with ThreadPoolExecutor(max_workers=n_threads) as pool:
+        return list(pool.map(lambda _: fn(), range(n_threads)))
+
+
+@pytest.mark.parametrize("bits", [20, 100])
+def test_fixed_kernels_in_threads(bits):
+    a = APyFixedArray(list(range(N)), bits=bits, int_bits=bits // 2)
+    b = APyFixedArray(list(range(N, 0, -1)), bits=bits, int_bits=bits // 2)
+    m = APyFixedArray([list(range(100))] * 100, bits=bits, int_bits=bits // 2)
+
+    def work():
+        return (
+            a + b,
+            a - b,
+            a * b,
+            m @ m,
+            a.cast(int_bits=bits // 2, frac_bits=bits // 2 - 4),
+            a.sum(),
+            a.cumsum(),
+            a.to_numpy(),
+        )
+
+    reference = work()
+    for result in _run_parallel(work):
+        for res, ref in zip(result[:-1], reference[:-1]):
+            assert res.is_identical(ref)
+        assert (result[-1] == reference[-1]).all()
+
+
+def test_float_kernels_in_threads():
+    np = pytest.importorskip("numpy")
+    x = np.linspace(-10, 10, N)
+    a = APyFloatArray.from_float(x, exp_bits=8, man_bits=20)
+    b = APyFloatArray.from_float(x[::-1], exp_bits=8, man_bits=20)
+    m = APyFloatArray.from_float(np.ones((100, 100)), exp_bits=8, man_bits=20)
+
+    def work():
+        return (
+            a + b,
+            a * b,
+            a / b,
+            m @ m,
+            a.cast(exp_bits=5, man_bits=10),
+            APyFloatArray.from_array(x, exp_bits=8, man_bits=20),
+        )
+
+    reference = work()
+    for result in _run_parallel(work):
+        for res, ref in zip(result, reference):
+            assert res.is_identical(ref)
+
+
+def test_contexts_apply_with_gil_released():
+    from apytypes import APyFloatQuantizationContext, QuantizationMode
+
+    a = APyFloatArray.from_float([1.0] * N, exp_bits=8, man_bits=20)
+    b = APyFloatArray.from_float([2**-22] * N, exp_bits=8, man_bits=20)
+
+    def add(mode):
+        with APyFloatQuantizationContext(mode):
+            return a + b
+
+    with ThreadPoolExecutor(max_workers=2) as pool:
+        up, down = pool.map(add, [QuantizationMode.TO_POS, QuantizationMode.TO_NEG])
+    assert not up.is_identical(down)
+    assert down.is_identical(a)
+
+
+@pytest.mark.skipif(
+    not hasattr(sys, "_is_gil_enabled"), reason="requires Python 3.13 or later"
+)
+def test_free_threaded_module_keeps_gil_disabled():
+    import os
+    import subprocess
+    import sysconfig
+
+    if not sysconfig.get_config_var("Py_GIL_DISABLED"):
+        pytest.skip("requires a free-threaded Python build")
+
+    # Import in a fresh interpreter, where nothing else can have re-enabled the GIL and
+    # the GIL is not forced off by the environment
+    env = {k: v for k, v in os.environ.items() if k != "PYTHON_GIL"}
+    code = "import sys, apytypes._apytypes; print(sys._is_gil_enabled())"
+    result = subprocess.run(
+        [sys.executable, "-W", "error::RuntimeWarning", "-c", code],
+        env=env,
+        capture_output=True,
+        text=True,
+        check=True,
+    )
+    assert result.stdout.strip() == "False"
@@ -12,13 +12,13 @@
 
 #include <algorithm>  // std::reverse
 #include <functional> // std::multiplies
-#include <memory>     // std::allocator
 #include <numeric>    // std::accumulate
 #include <vector>     // std::vector
 
+#include "apytypes_allocator.h"
 #include "apytypes_util.h"
 
-template <typename T, typename Allocator = std::allocator<T>> class APyBuffer {
+template <typename T, typename Allocator = AlignedPoolAllocator<T>> class APyBuffer {
 
     //! APyBuffers are to be inherited from. All fields and constructors are protected.
 protected:
@@ -28,6 +28,7 @@ namespace nb = nanobind;
 #include "apyfixed.h"
 #include "apyfixed_util.h"
 #include "apyfloat.h"
+#include "apytypes_allocator.h"
 #include "apytypes_common.h"
 #include "apytypes_util.h"
 #include "ieee754.h"
@@ -161,6 +162,20 @@ APyFixed APyFixed::operator*(const APyFixed& rhs) const
         return result; // early exit
     }
 
+    // Single-limb operands specialization, the result fits in two limbs
+    if (unsigned(std::max(_bits, rhs._bits)) <= _LIMB_SIZE_BITS) {
+        const bool is_negative = mp_limb_signed_t(_data[0] ^ rhs._data[0]) < 0;
+        const mp_limb_t abs_lhs = limb_abs(_data[0]);
+        const mp_limb_t abs_rhs = limb_abs(rhs._data[0]);
+        result._data[1] = mpn_mul_1(&result._data[0], &abs_lhs, 1, abs_rhs);
+        if (is_negative) {
+            limb_vector_negate(
+                result._data.begin(), result._data.end(), result._data.begin()
+            );
+        }
+        return result; // early exit
+    }
+
     ScratchVector<mp_limb_t> abs_op1(_data.size());
     ScratchVector<mp_limb_t> abs_op2(rhs._data.size());
     limb_vector_abs(_data.begin(), _data.end(), abs_op1.begin());
@@ -297,31 +312,55 @@ APyFixed& APyFixed::operator>>=(const int shift_val)
     return *this;
 }
 
-bool APyFixed::operator==(const APyFixed& rhs) const { return (*this - rhs).is_zero(); }
+bool APyFixed::_is_single_limb_aligned(const APyFixed& rhs) const noexcept
+{
+    const int max_int_bits = std::max(int_bits(), rhs.int_bits());
+    const int max_frac_bits = std::max(frac_bits(), rhs.frac_bits());
+    return unsigned(max_int_bits + max_frac_bits) <= _LIMB_SIZE_BITS;
+}
+
+std::pair<mp_limb_signed_t, mp_limb_signed_t>
+APyFixed::_single_limb_aligned(const APyFixed& rhs) const noexcept
+{
+    assert(_is_single_limb_aligned(rhs));
+    const int max_frac_bits = std::max(frac_bits(), rhs.frac_bits());
+    return { mp_limb_signed_t(_data[0] << (max_frac_bits - frac_bits())),
+             mp_limb_signed_t(rhs._data[0] << (max_frac_bits - rhs.frac_bits())) };
+}
+
+bool APyFixed::operator==(const APyFixed& rhs) const
+{
+    if (_is_single_limb_aligned(rhs)) {
+        auto [lhs_limb, rhs_limb] = _single_limb_aligned(rhs);
+        return lhs_limb == rhs_limb;
+    }
+    return (*this - rhs).is_zero();
+}
 
 bool APyFixed::operator!=(const APyFixed& rhs) const { return !(*this == rhs); }
 
 bool APyFixed::operator<(const APyFixed& rhs) const
 {
+    if (_is_single_limb_aligned(rhs)) {
+        auto [lhs_limb, rhs_limb] = _single_limb_aligned(rhs);
+        return lhs_limb < rhs_limb;
+    }
     return (*this - rhs).is_negative();
 }
 
 bool APyFixed::operator<=(const APyFixed& rhs) const
 {
+    if (_is_single_limb_aligned(rhs)) {
+        auto [lhs_limb, rhs_limb] = _single_limb_aligned(rhs);
+        return lhs_limb <= rhs_limb;
+    }
     auto diff = *this - rhs;
     return diff.is_negative() || diff.is_zero();
 }
 
-bool APyFixed::operator>(const APyFixed& rhs) const
-{
-    return (rhs - *this).is_negative();
-}
+bool APyFixed::operator>(const APyFixed& rhs) const { return rhs < *this; }
 
-bool APyFixed::operator>=(const APyFixed& rhs) const
-{
-    auto diff = rhs - *this;
-    return diff.is_negative() || diff.is_zero();
-}
+bool APyFixed::operator>=(const APyFixed& rhs) const { return rhs <= *this; }
 
 bool APyFixed::operator==(const nb::int_& rhs) const
 {
@@ -491,41 +530,9 @@ mp_limb_t APyFixed::increment_lsb() noexcept
 
 std::string APyFixed::to_string_dec() const
 {
-    // Construct a string from the absolute value of number, and conditionally append a
-    // minus sign to the string if negative
-    APyFixed abs_val = abs();
-
-    // Convert this number to BCD with the double-dabble algorithm
-    std::vector<mp_limb_t> bcd_limb_list
-        = double_dabble(static_cast<std::vector<mp_limb_t>>(abs_val._data));
-    std::size_t bcd_limb_list_start_size = bcd_limb_list.size();
-
-    // Divide BCD limb list by two, one time per fractional bit (if any)
-    long decimal_point = 0;
-    for (int i = 0; i < frac_bits(); i++) {
-        bcd_limb_vec_div2(bcd_limb_list);
-        decimal_point += bcd_limb_list.size() > bcd_limb_list_start_size ? 1 : 0;
-    }
-    long rjust = ((_LIMB_SIZE_BITS / 4) - decimal_point) % (_LIMB_SIZE_BITS / 4);
-
-    // Multiply BCD list by two, one time per for each missing fractional bit (if any)
-    for (int i = 0; i < -frac_bits(); i++) {
-        bcd_limb_vec_mul2(bcd_limb_list);
-    }
-
-    // Convert BCD limb list to regular BCD list (`std::vector<uint8_t>`)
-    auto bcd_list = to_nibble_list(bcd_limb_list, decimal_point + rjust + 1);
-
-    // Convert BCDs to ASCII
-    std::string result = is_negative() ? "-" : "";
-    for (long i = bcd_list.size() - 1; i >= rjust; i--) {
-        result.push_back(bcd_list[i] + 0x30);
-        if (decimal_point && i == rjust + long(decimal_point)) {
-            result.push_back('.');
-        }
-    }
-
-    return result;
+    return fixed_point_to_string_dec(
+        _data.cbegin(), _data.cend(), frac_bits(), thread_dec_power_table()
+    );
 }
 
 std::string APyFixed::to_string_hex() const
@@ -826,18 +833,17 @@ nb::int_ APyFixed::to_bits() const
 
 std::string APyFixed::bit_pattern_to_string_dec() const
 {
-    std::stringstream ss {};
-
     ScratchVector<mp_limb_t> data = _data;
     if (bits() % _LIMB_SIZE_BITS) {
         mp_limb_t and_mask = (mp_limb_t(1) << (bits() % _LIMB_SIZE_BITS)) - 1;
         data.back() &= and_mask;
     }
 
-    // Double-dabble for binary-to-BCD conversion
-    ss << bcds_to_string(double_dabble(static_cast<std::vector<mp_limb_t>>(data)));
-
-    return ss.str();
+    std::string result;
+    limb_vector_to_dec_digits(
+        &data[0], data.size(), 1, thread_dec_power_table(), result
+    );
+    return result;
 }
 
 std::string APyFixed::repr() const
@@ -1047,6 +1053,17 @@ APyFixed APyFixed::cast(
     const auto quantization_mode = quantization.value_or(cast_option.quantization);
     const auto overflow_mode = overflow.value_or(cast_option.overflow);
 
+    // Single-limb specialization
+    if (unsigned(std::max(new_bits, _bits)) <= _LIMB_SIZE_BITS) {
+        APyFixed result(new_bits, new_int_bits);
+        const mp_limb_t quantized = quantize_single_limb(
+            _data[0], _bits, _int_bits, new_bits, new_int_bits, quantization_mode
+        );
+        result._data[0]
+            = overflow_single_limb(quantized, new_bits, new_int_bits, overflow_mode);
+        return result; // early exit
+    }
+
     // Result that temporarily can hold all the necessary bits
     APyFixed result(std::max(new_bits, _bits), new_int_bits);
     _cast(
@@ -1070,6 +1087,15 @@ APyFixed::cast_no_overflow(int bits, int int_bits, QuantizationMode quantization
     int new_bits = bits;
     int new_int_bits = int_bits;
 
+    // Single-limb specialization
+    if (unsigned(std::max(new_bits, _bits)) <= _LIMB_SIZE_BITS) {
+        APyFixed result(new_bits, new_int_bits);
+        result._data[0] = quantize_single_limb(
+            _data[0], _bits, _int_bits, new_bits, new_int_bits, quantization
+        );
+        return result; // early exit
+    }
+
     // Result that temporarily can hold all the necessary bits
     APyFixed result(std::max(new_bits, _bits), std::max(new_int_bits, _int_bits));
     _cast_no_overflow(
@@ -1168,3 +1194,12 @@ template void APyFixed::_cast(
     QuantizationMode,
     OverflowMode
 ) const;
+
+template void APyFixed::_cast(
+    APyLimbVector::iterator,
+    APyLimbVector::iterator,
+    int,
+    int,
+    QuantizationMode,
+    OverflowMode
+) const;
@@ -17,6 +17,7 @@ namespace nb = nanobind;
 #include <optional> // std::optional, std::nullopt
 #include <ostream>  // std::ostream
 #include <string>   // std::string
+#include <utility>  // std::pair
 #include <vector>   // std::vector
 
 // GMP should be included after all other includes
@@ -71,6 +72,12 @@ public:
     //! Construct a copy from `other`.
     APyFixed(const APyFixed& other);
 
+    //! Construct from `other` by taking over its limb data. Lets nanobind adopt
+    //! returned scalars without reallocating their limbs.
+    APyFixed(APyFixed&& other) noexcept = default;
+
+    APyFixed& operator=(const APyFixed& other) = default;
+
     //! Main Python-exposed `APyFixed` constructor
     explicit APyFixed(
         const nb::int_& python_long_int_bit_pattern,
@@ -147,6 +154,16 @@ public:
      *                          Binary comparison operators                            *
      * ****************************************************************************** */
 
+private:
+    //! Test if `*this` and `rhs`, aligned to their common binary point, both fit in a
+    //! single limb
+    bool _is_single_limb_aligned(const APyFixed& rhs) const noexcept;
+
+    //! Return the limbs of `*this` and `rhs` aligned to their common binary point.
+    //! Undefined behaviour if not `_is_single_limb_aligned(rhs)`.
+    std::pair<mp_limb_signed_t, mp_limb_signed_t>
+    _single_limb_aligned(const APyFixed& rhs) const noexcept;
+
 public:
     bool operator==(const APyFixed& rhs) const;
     bool operator!=(const APyFixed& rhs) const;
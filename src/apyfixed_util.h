@@ -6,7 +6,10 @@
 #include "apytypes_simd.h"
 #include "apytypes_util.h"
 
+#include <algorithm>  // std::min
 #include <functional> // std::bind, std::function, std::placeholders
+#include <string>     // std::string
+#include <vector>     // std::vector
 
 // GMP should be included after all other includes
 #include "../extern/mini-gmp/mini-gmp.h"
@@ -20,6 +23,79 @@ mp_limb_t get_data_from_double(double value, int bits, int frac_bits, int shift_
 //! Fast integer power by squaring.
 APyFixed ipow(APyFixed base, unsigned int n);
 
+/* ********************************************************************************** *
+ * *                    Fixed-point decimal string conversion                       * *
+ * ********************************************************************************** */
+
+//! Largest exponent `e` for which `5^e` fits in a limb
+static constexpr std::size_t _LIMB_POW5_EXP = _LIMB_SIZE_BITS == 64 ? 27 : 13;
+
+//! Convert the two's complement fixed-point number in limb vector [`cbegin_it`,
+//! `cend_it`), with `frac_bits` fractional bits, to an exact decimal string. The
+//! fractional part `F / 2^d`, with `F` odd, is printed as the `d` digits of
+//! `F * 5^d`.
+template <class RANDOM_ACCESS_ITERATOR_IN>
+[[maybe_unused, nodiscard]] static APY_INLINE std::string fixed_point_to_string_dec(
+    RANDOM_ACCESS_ITERATOR_IN cbegin_it,
+    RANDOM_ACCESS_ITERATOR_IN cend_it,
+    int frac_bits,
+    DecimalPowerTable& table
+)
+{
+    std::size_t n = std::distance(cbegin_it, cend_it);
+    std::vector<mp_limb_t> abs_val(n);
+    bool is_negative = limb_vector_abs(cbegin_it, cend_it, abs_val.begin());
+    std::string result = is_negative ? "-" : "";
+
+    if (frac_bits <= 0) {
+        // Integer-valued number, scale by `2^-frac_bits`
+        if (frac_bits < 0) {
+            abs_val.resize(n + bits_to_limbs(-frac_bits), 0);
+            limb_vector_lsl(abs_val.begin(), abs_val.end(), -frac_bits);
+        }
+        limb_vector_to_dec_digits(&abs_val[0], abs_val.size(), 1, table, result);
+        return result;
+    }
+
+    // Extract the fractional bits before converting the integer part
+    std::size_t frac_limbs = std::min(n, bits_to_limbs(frac_bits));
+    std::vector<mp_limb_t> fraction(abs_val.begin(), abs_val.begin() + frac_limbs);
+    if (frac_limbs == bits_to_limbs(frac_bits) && frac_bits % _LIMB_SIZE_BITS) {
+        fraction.back() &= (mp_limb_t(1) << (frac_bits % _LIMB_SIZE_BITS)) - 1;
+    }
+    limb_vector_lsr(abs_val.begin(), abs_val.end(), frac_bits);
+    limb_vector_to_dec_digits(&abs_val[0], n, 1, table, result);
+    if (limb_vector_is_zero(fraction.cbegin(), fraction.cend())) {
+        return result;
+    }
+
+    // Strip trailing zero bits of the fraction, leaving `frac_digits` significant bits
+    std::size_t trailing_zeros = mpn_scan1(&fraction[0], 0);
+    limb_vector_lsr(fraction.begin(), fraction.end(), trailing_zeros);
+    std::size_t frac_digits = std::size_t(frac_bits) - trailing_zeros;
+
+    // Multiply by `5^frac_digits`, using the largest powers of five fitting in a limb.
+    // Since `log2(5) < 7/3`, the product fits in the resized vector.
+    std::size_t size = fraction.size();
+    fraction.resize(size + bits_to_limbs(7 * frac_digits / 3 + 1));
+    for (std::size_t left = frac_digits; left;) {
+        std::size_t exp = std::min(left, _LIMB_POW5_EXP);
+        mp_limb_t pow5 = 1;
+        for (std::size_t i = 0; i < exp; i++) {
+            pow5 *= 5;
+        }
+        mp_limb_t carry = mpn_mul_1(&fraction[0], &fraction[0], size, pow5);
+        if (carry) {
+            fraction[size++] = carry;
+        }
+        left -= exp;
+    }
+
+    result.push_back('.');
+    limb_vector_to_dec_digits(&fraction[0], size, frac_digits, table, result);
+    return result;
+}
+
 /* ********************************************************************************** *
  * *    Fixed-point iterator based in-place quantization with multi-limb support    * *
  * ********************************************************************************** */
@@ -585,6 +661,192 @@ static void overflow(
     }
 }
 
+/* ********************************************************************************** *
+ * *           Single-limb fixed-point in-place quantization and overflowing        * *
+ * ********************************************************************************** */
+
+//! Arithmetic right shift of a single limb, where shifts of `_LIMB_SIZE_BITS` or more
+//! leave only the sign
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t
+limb_asr(mp_limb_t limb, unsigned shift_amnt)
+{
+    shift_amnt = std::min(shift_amnt, unsigned(_LIMB_SIZE_BITS - 1));
+    return mp_limb_t(mp_limb_signed_t(limb) >> shift_amnt);
+}
+
+//! Logical left shift of a single limb, where shifts of `_LIMB_SIZE_BITS` or more
+//! return zero
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t
+limb_lsl(mp_limb_t limb, unsigned shift_amnt)
+{
+    return shift_amnt < _LIMB_SIZE_BITS ? limb << shift_amnt : 0;
+}
+
+//! Two's complement absolute value of a single limb
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t limb_abs(mp_limb_t limb)
+{
+    return mp_limb_signed_t(limb) < 0 ? -limb : limb;
+}
+
+//! Reduce the first `n` bits of a single limb over bitwise `or`
+[[maybe_unused, nodiscard]] static APY_INLINE bool
+limb_or_reduce(mp_limb_t limb, unsigned n)
+{
+    return n < _LIMB_SIZE_BITS ? limb & ((mp_limb_t(1) << n) - 1) : limb != 0;
+}
+
+//! Add a power-of-two (2 ^ `n`) onto a single limb, ignoring terms outside of the limb
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t
+limb_add_pow2(mp_limb_t limb, unsigned n)
+{
+    return n < _LIMB_SIZE_BITS ? limb + (mp_limb_t(1) << n) : limb;
+}
+
+/*!
+ * Quantize a single-limb fixed-point number `limb` with `bits` and `int_bits` to
+ * `new_bits` and `new_int_bits`. Equivalent to `quantize()` on a limb vector of length
+ * one, i.e., only valid if both `bits` and `new_bits` fit in a single limb.
+ */
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t quantize_single_limb(
+    mp_limb_t limb,
+    int bits,
+    int int_bits,
+    int new_bits,
+    int new_int_bits,
+    QuantizationMode quantization
+)
+{
+    assert(unsigned(std::max(bits, new_bits)) <= _LIMB_SIZE_BITS);
+    if (quantization > QuantizationMode::JAM_UNBIASED) {
+        // Not supported by fixed-point quantization, throws
+        quantize(&limb, &limb + 1, bits, int_bits, new_bits, new_int_bits, quantization);
+        return limb;
+    }
+
+    const int left_shift_amnt = (new_bits - new_int_bits) - (bits - int_bits);
+    if (left_shift_amnt >= 0) {
+        limb = limb_lsl(limb, left_shift_amnt);
+        return quantization == QuantizationMode::JAM ? limb | 1 : limb;
+    }
+
+    const unsigned start_idx = -left_shift_amnt;
+    const bool is_negative = mp_limb_signed_t(limb) < 0;
+    switch (quantization) {
+    case QuantizationMode::TRN:
+        return limb_asr(limb, start_idx);
+    case QuantizationMode::JAM:
+        return limb_asr(limb, start_idx) | 1;
+    case QuantizationMode::TRN_INF:
+    case QuantizationMode::TRN_AWAY:
+        if (is_negative && quantization == QuantizationMode::TRN_AWAY) {
+            return limb_asr(limb, start_idx);
+        }
+        if (start_idx < unsigned(bits)) {
+            if (limb_or_reduce(limb, start_idx)) {
+                limb = limb_add_pow2(limb, start_idx);
+            }
+            return limb_asr(limb, start_idx);
+        }
+        return is_negative ? 0 : limb_or_reduce(limb, bits);
+    case QuantizationMode::TRN_ZERO:
+        if (!is_negative) {
+            return limb_asr(limb, start_idx);
+        }
+        if (start_idx < unsigned(bits)) {
+            if (limb_or_reduce(limb, start_idx)) {
+                limb = limb_add_pow2(limb, start_idx);
+            }
+            return limb_asr(limb, start_idx);
+        }
+        return 0;
+    case QuantizationMode::TRN_MAG:
+        if (!is_negative) {
+            return limb_asr(limb, start_idx);
+        }
+        if (start_idx < unsigned(bits)) {
+            return limb_asr(limb_add_pow2(limb, start_idx), start_idx);
+        }
+        return 0;
+    case QuantizationMode::RND:
+    case QuantizationMode::RND_ZERO:
+    case QuantizationMode::RND_INF:
+    case QuantizationMode::RND_MIN_INF:
+        if (start_idx <= unsigned(bits)) {
+            bool add_half = quantization == QuantizationMode::RND
+                || (quantization == QuantizationMode::RND_ZERO && is_negative)
+                || (quantization == QuantizationMode::RND_INF && !is_negative)
+                || limb_or_reduce(limb, start_idx - 1);
+            if (add_half) {
+                limb = limb_add_pow2(limb, start_idx - 1);
+            }
+            return limb_asr(limb, start_idx);
+        }
+        return 0;
+    case QuantizationMode::RND_CONV:
+        if (start_idx < unsigned(bits)) {
+            if (((limb >> start_idx) & 1) || limb_or_reduce(limb, start_idx - 1)) {
+                limb = limb_add_pow2(limb, start_idx - 1);
+            }
+            return limb_asr(limb, start_idx);
+        }
+        return 0;
+    case QuantizationMode::RND_CONV_ODD:
+        if (start_idx < unsigned(bits)) {
+            if (!((limb >> start_idx) & 1) || limb_or_reduce(limb, start_idx - 1)) {
+                limb = limb_add_pow2(limb, start_idx - 1);
+            }
+            return limb_asr(limb, start_idx);
+        }
+        if (start_idx == unsigned(bits)) {
+            return is_negative && !limb_or_reduce(limb, start_idx - 1) ? -1 : 0;
+        }
+        return 0;
+    case QuantizationMode::JAM_UNBIASED:
+        if (start_idx < unsigned(bits)) {
+            if (limb_or_reduce(limb, start_idx)) {
+                limb |= mp_limb_t(1) << start_idx;
+            }
+            return limb_asr(limb, start_idx);
+        }
+        if (is_negative) {
+            return limb_or_reduce(limb, bits) ? mp_limb_t(-1) : mp_limb_t(-2);
+        }
+        return limb_or_reduce(limb, bits);
+    default:
+        return limb;
+    }
+}
+
+/*!
+ * Overflow a single-limb fixed-point number `limb` to `new_bits` and `new_int_bits`.
+ * Equivalent to `overflow()` on a limb vector of length one, i.e., only valid if
+ * `new_bits` fits in a single limb.
+ */
+[[maybe_unused, nodiscard]] static APY_INLINE mp_limb_t overflow_single_limb(
+    mp_limb_t limb, int new_bits, int new_int_bits, OverflowMode overflow_mode
+)
+{
+    assert(unsigned(new_bits) <= _LIMB_SIZE_BITS);
+    // All bits from the sign bit and up
+    const mp_limb_t sign_mask = ~((mp_limb_t(1) << (new_bits - 1)) - 1);
+    const bool is_negative = mp_limb_signed_t(limb) < 0;
+    switch (overflow_mode) {
+    case OverflowMode::WRAP:
+        return twos_complement_overflow(limb, new_bits);
+    case OverflowMode::SAT:
+        if (is_negative) {
+            return (~limb & sign_mask) ? sign_mask : limb;
+        }
+        return (limb & sign_mask) ? ~sign_mask : limb;
+    case OverflowMode::NUMERIC_STD:
+        return is_negative ? limb | sign_mask : limb & ~sign_mask;
+    default:
+        // Unknown overflow mode, throws
+        overflow(&limb, &limb + 1, new_bits, new_int_bits, overflow_mode);
+        return limb;
+    }
+}
+
 /* ********************************************************************************** *
  * *     Fixed-point iterator based arithmetic functions with multi-limb support    * *
  * ********************************************************************************** */
@@ -13,11 +13,9 @@ namespace nb = nanobind;
 #include <algorithm> // std::copy, std::max, std::transform, etc...
 #include <cstddef>   // std::size_t
 #include <cstdint>   // std::int16, std::int32, std::int64, etc...
-#include <ios>       // std::dec, std::hex
 #include <iostream>
 #include <optional>  // std::optional
 #include <set>       // std::set
-#include <sstream>   // std::stringstream
 #include <stdexcept> // std::length_error
 #include <string>    // std::string
 #include <vector>    // std::vector, std::swap
@@ -28,6 +26,7 @@ namespace nb = nanobind;
 #include "apyfixedarray.h"
 #include "apyfixedarray_iterator.h"
 #include "apytypes_common.h"
+#include "apytypes_profiling.h"
 #include "apytypes_simd.h"
 #include "apytypes_util.h"
 #include "array_utils.h"
@@ -101,6 +100,26 @@ APyFixedArray::APyFixedArray(
 {
 }
 
+APyFixedArray::APyFixedArray(
+    const std::vector<std::size_t>& shape,
+    int bits,
+    int int_bits,
+    APyLimbVector data
+)
+    : APyFixedArray(shape, bits, int_bits)
+{
+    if (data.size() != _data.size()) {
+        throw std::length_error(fmt::format(
+            "APyFixedArray: expected {} data limbs, got {}", _data.size(), data.size()
+        ));
+    }
+    _data = std::move(data);
+    for (std::size_t i = 0; i < _nitems; i++) {
+        auto it = _data.begin() + i * _itemsize;
+        _overflow_twos_complement(it, it + _itemsize, _bits, _int_bits);
+    }
+}
+
 APyFixedArray::APyFixedArray(
     const std::vector<std::size_t>& shape,
     std::optional<int> int_bits,
@@ -121,6 +140,8 @@ template <class ripple_carry_op, class simd_op, class simd_shift_op>
 inline APyFixedArray APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedArray& rhs
 ) const
 {
+    APyGILRelease gil_release(_nitems);
+
     // Increase word length of result by one
     const int res_int_bits = std::max(rhs.int_bits(), int_bits()) + 1;
     const int res_frac_bits = std::max(rhs.frac_bits(), frac_bits());
@@ -131,6 +152,7 @@ inline APyFixedArray APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedAr
 
     // Special case #1: Operands and result fit in single limb
     if (unsigned(res_bits) <= _LIMB_SIZE_BITS) {
+        APY_PROFILE_SCOPE("fixed.add_sub.single_limb_simd", _nitems);
         if (frac_bits() == rhs.frac_bits()) {
             // Operands have equally many fractional bits.
             simd_op {}(
@@ -156,6 +178,7 @@ inline APyFixedArray APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedAr
 
     // Special case #2: Operands and result have equally many limbs
     if (result._itemsize == _itemsize && result._itemsize == rhs._itemsize) {
+        APY_PROFILE_SCOPE("fixed.add_sub.equal_limbs_mpn", _nitems);
         const mp_limb_t* src1_ptr;
         const mp_limb_t* src2_ptr;
         if (frac_bits() == rhs.frac_bits()) {
@@ -185,6 +208,7 @@ inline APyFixedArray APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedAr
     }
 
     // Most general case: Works in any situation, but is slowest
+    APY_PROFILE_SCOPE("fixed.add_sub.general_mpn", _nitems);
     APyFixedArray imm(_shape, res_bits, res_int_bits);
     _cast_correct_wl(result._data.begin(), res_bits, res_int_bits);
     rhs._cast_correct_wl(imm._data.begin(), res_bits, res_int_bits);
@@ -204,6 +228,8 @@ inline APyFixedArray APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedAr
 template <class ripple_carry_op, class simd_op_const, class simd_shift_op_const>
 inline APyFixedArray APyFixedArray::_apyfixed_base_add_sub(const APyFixed& rhs) const
 {
+    APyGILRelease gil_release(_nitems);
+
     // Increase word length of result by one
     const int res_int_bits = std::max(rhs.int_bits(), int_bits()) + 1;
     const int res_frac_bits = std::max(rhs.frac_bits(), frac_bits());
@@ -214,6 +240,7 @@ inline APyFixedArray APyFixedArray::_apyfixed_base_add_sub(const APyFixed& rhs)
 
     // Special case #1: Operands and result fit in single limb
     if (unsigned(res_bits) <= _LIMB_SIZE_BITS) {
+        APY_PROFILE_SCOPE("fixed.add_sub_scalar.single_limb_simd", _nitems);
         if (frac_bits() == rhs.frac_bits()) {
             // Operands have equally many fractional bits.
             simd_op_const {}(
@@ -234,6 +261,7 @@ inline APyFixedArray APyFixedArray::_apyfixed_base_add_sub(const APyFixed& rhs)
     }
 
     // Most general case: Works in any situation, but is slowest
+    APY_PROFILE_SCOPE("fixed.add_sub_scalar.general_mpn", _nitems);
     APyFixed imm(res_bits, res_int_bits);
     auto rhs_shift_amount = unsigned(res_frac_bits - rhs.frac_bits());
     _cast_correct_wl(result._data.begin(), res_bits, res_int_bits);
@@ -310,6 +338,8 @@ APyFixedArray APyFixedArray::operator-(const APyFixed& rhs) const
 // Scalar - Array
 APyFixedArray APyFixedArray::rsub(const APyFixed& lhs) const
 {
+    APyGILRelease gil_release(_nitems);
+
     // Increase word length of result by one
     const int res_int_bits = std::max(lhs.int_bits(), int_bits()) + 1;
     const int res_frac_bits = std::max(lhs.frac_bits(), frac_bits());
@@ -357,6 +387,7 @@ APyFixedArray APyFixedArray::operator*(const APyFixedArray& rhs) const
         return broadcast_to(broadcast_shape) * rhs.broadcast_to(broadcast_shape);
     }
 
+    APyGILRelease gil_release(_nitems);
     const int res_int_bits = int_bits() + rhs.int_bits();
     const int res_frac_bits = frac_bits() + rhs.frac_bits();
     const int res_bits = res_int_bits + res_frac_bits;
@@ -365,6 +396,7 @@ APyFixedArray APyFixedArray::operator*(const APyFixedArray& rhs) const
     APyFixedArray result(_shape, res_bits, res_int_bits);
 
     if (unsigned(res_bits) <= _LIMB_SIZE_BITS) {
+        APY_PROFILE_SCOPE("fixed.mul.single_limb_simd", _nitems);
         simd::vector_mul(
             std::begin(_data),        // src1
             std::begin(rhs._data),    // src2
@@ -374,9 +406,10 @@ APyFixedArray APyFixedArray::operator*(const APyFixedArray& rhs) const
     } else {
         // `_checked_hadamard_product` requires: "The destination has to have space for
         // `s1n` + `s2n` limbs, even if the product’s most significant limb is zero."
-        std::vector<mp_limb_t> prod_tmp(_itemsize + rhs._itemsize);
-        std::vector<mp_limb_t> op1_abs(_itemsize);
-        std::vector<mp_limb_t> op2_abs(rhs._itemsize);
+        APY_PROFILE_SCOPE("fixed.mul.general_mpn", _nitems);
+        APyLimbVector prod_tmp(_itemsize + rhs._itemsize);
+        APyLimbVector op1_abs(_itemsize);
+        APyLimbVector op2_abs(rhs._itemsize);
         _checked_hadamard_product(
             rhs,                  // rhs
             result._data.begin(), // dst
@@ -391,6 +424,7 @@ APyFixedArray APyFixedArray::operator*(const APyFixedArray& rhs) const
 
 APyFixedArray APyFixedArray::operator*(const APyFixed& rhs) const
 {
+    APyGILRelease gil_release(_nitems);
     const int res_int_bits = int_bits() + rhs.int_bits();
     const int res_frac_bits = frac_bits() + rhs.frac_bits();
     const int res_bits = res_int_bits + res_frac_bits;
@@ -400,6 +434,7 @@ APyFixedArray APyFixedArray::operator*(const APyFixed& rhs) const
 
     // Special case #1: The resulting number of bits fit in a single limb
     if (unsigned(res_bits) <= _LIMB_SIZE_BITS) {
+        APY_PROFILE_SCOPE("fixed.mul_scalar.single_limb_simd", _nitems);
         simd::vector_mul_const(
             std::begin(_data),        // src1
             rhs._data[0],             // src2
@@ -410,17 +445,18 @@ APyFixedArray APyFixedArray::operator*(const APyFixed& rhs) const
     }
 
     // General case: This always works but is slower than the special cases.
+    APY_PROFILE_SCOPE("fixed.mul_scalar.general_mpn", _nitems);
     auto op2_begin = rhs._data.begin();
     auto op2_end = rhs._data.begin() + rhs.vector_size();
     bool sign2 = mp_limb_signed_t(*(op2_end - 1)) < 0;
-    std::vector<mp_limb_t> op2_abs(rhs.vector_size());
+    APyLimbVector op2_abs(rhs.vector_size());
     limb_vector_abs(op2_begin, op2_end, op2_abs.begin());
 
     // Perform multiplication for each element in the tensor. `mpn_mul` requires:
     // "The destination has to have space for `s1n` + `s2n` limbs, even if the product’s
     // most significant limbs are zero."
-    std::vector<mp_limb_t> res_tmp_vec(_itemsize + rhs.vector_size(), 0);
-    std::vector<mp_limb_t> op1_abs(_itemsize);
+    APyLimbVector res_tmp_vec(_itemsize + rhs.vector_size(), 0);
+    APyLimbVector op1_abs(_itemsize);
     auto op1_begin = _data.begin();
     for (std::size_t i = 0; i < _nitems; i++) {
         // Current working operands
@@ -477,6 +513,7 @@ APyFixedArray APyFixedArray::operator/(const APyFixedArray& rhs) const
         return broadcast_to(broadcast_shape) / rhs.broadcast_to(broadcast_shape);
     }
 
+    APyGILRelease gil_release(_nitems);
     const int res_int_bits = int_bits() + rhs.frac_bits() + 1;
     const int res_frac_bits = frac_bits() + rhs.int_bits();
     const int res_bits = res_int_bits + res_frac_bits;
@@ -547,6 +584,7 @@ APyFixedArray APyFixedArray::operator/(const APyFixedArray& rhs) const
 
 APyFixedArray APyFixedArray::operator/(const APyFixed& rhs) const
 {
+    APyGILRelease gil_release(_nitems);
     const int res_int_bits = int_bits() + rhs.frac_bits() + 1;
     const int res_frac_bits = frac_bits() + rhs.int_bits();
     const int res_bits = res_int_bits + res_frac_bits;
@@ -609,6 +647,7 @@ APyFixedArray APyFixedArray::operator/(const APyFixed& rhs) const
 
 APyFixedArray APyFixedArray::rdiv(const APyFixed& rhs) const
 {
+    APyGILRelease gil_release(_nitems);
     const int res_int_bits = rhs.int_bits() + frac_bits() + 1;
     const int res_frac_bits = rhs.frac_bits() + int_bits();
     const int res_bits = res_int_bits + res_frac_bits;
@@ -709,6 +748,8 @@ APyFixedArray& APyFixedArray::operator>>=(const int shift_val)
 
 APyFixedArray APyFixedArray::matmul(const APyFixedArray& rhs) const
 {
+    APyGILRelease gil_release(_nitems * (rhs.ndim() > 1 ? rhs._shape[1] : 1));
+
     if (ndim() == 1 && rhs.ndim() == 1) {
         if (_shape[0] == rhs._shape[0]) {
             // Dimensionality for a standard scalar inner product checks out. Perform
@@ -823,6 +864,7 @@ APyFixedArray APyFixedArray::broadcast_to(const std::vector<std::size_t> shape)
         );
     }
 
+    APY_PROFILE_SCOPE("fixed.broadcast", fold_shape(shape));
     APyFixedArray result(shape, bits(), int_bits());
     broadcast_data_copy(_data.begin(), result._data.begin(), _shape, shape, _itemsize);
     return result;
@@ -881,68 +923,6 @@ APyFixedArray::squeeze(std::optional<std::variant<nb::int_, nb::tuple>> axis) co
     return result;
 }
 
-APyFixedArray APyFixedArray::cumulative_prod_sum_function(
-    void (*pos_func)(
-        std::size_t,
-        std::size_t,
-        std::size_t,
-        APyFixedArray&,
-        APyFixedArray&,
-        std::size_t
-    ),
-    int (*int_bit_increase)(std::size_t, std::size_t),
-    int (*frac_bit_increase)(std::size_t, std::size_t),
-    std::optional<nb::int_> axis
-) const
-{
-    // determine input value
-    // if no input is received _shape.size() will be used
-    std::size_t _axis = _shape.size();
-    if (axis.has_value()) {
-        _axis = std::size_t(axis.value());
-        if (_axis >= _shape.size()) {
-            throw nb::index_error(
-                "specified axis outside number of dimensions in the APyFixedArray"
-            );
-        }
-    }
-
-    // initialize variables used for the summation or multiplication
-    // and determine the new shape
-    std::size_t elements = _nitems;
-    std::size_t res_nitems = _nitems;
-    std::vector<std::size_t> shape = { _nitems };
-    if (_axis < _shape.size()) {
-        elements = _shape.at(_axis);
-        shape = _shape;
-    }
-
-    // calculate new bits
-    const int res_int_bits = int_bits() + int_bit_increase(elements, int_bits());
-    const int res_frac_bits = frac_bits() + frac_bit_increase(elements, frac_bits());
-    const int res_bits = res_int_bits + res_frac_bits;
-
-    // temporary vector and source vector.
-    // the source vector will also contain the result after the summation or
-    // multiplication are performed
-    APyFixedArray temp(_shape, res_bits, res_int_bits);
-    APyFixedArray source(_shape, bits(), int_bits());
-    std::copy_n(_data.begin(), _data.size(), source._data.begin());
-
-    // get the stride
-    std::size_t stride = 1;
-    if (_axis < _shape.size()) {
-        stride = strides_from_shape(_shape)[_axis];
-    }
-    // perform the summation or multiplication and place result in 'result'
-    for (std::size_t i = 0; i < temp._nitems; i++) {
-        pos_func(i, stride, elements, source, temp, frac_bits());
-    }
-    // copy the elements into a new array to get the correct shape
-    APyFixedArray result2(shape, res_bits, res_int_bits);
-    std::copy_n(temp._data.begin(), res_nitems * temp._itemsize, result2._data.begin());
-    return result2;
-}
 std::variant<APyFixedArray, APyFixed> APyFixedArray::prod_sum_function(
     void (*pos_func)(
         std::size_t,
@@ -975,6 +955,8 @@ std::variant<APyFixedArray, APyFixed> APyFixedArray::prod_sum_function(
         axes_set.insert(_shape.size());
     }
 
+    APyGILRelease gil_release(_nitems);
+
     // determine new shape
     std::vector<std::size_t> shape = _shape;
     std::size_t cnt = 0;
@@ -1075,32 +1057,50 @@ APyFixedArray::nansum(std::optional<std::variant<nb::tuple, nb::int_>> axis) con
 
 APyFixedArray APyFixedArray::cumsum(std::optional<nb::int_> axis) const
 {
-    auto int_bit_increase = [](std::size_t elements, std::size_t bits) {
-        return int(bit_width(elements - 1));
-    };
-    auto frac_bit_increase = [](std::size_t elements, std::size_t bits) { return 0; };
-    auto pos_func = [](std::size_t i,
-                       std::size_t sec_length,
-                       std::size_t elements,
-                       APyFixedArray& src,
-                       APyFixedArray& dst,
-                       std::size_t frac_bits) {
-        // calculate new position
-        std::size_t pos = i - sec_length;
-        if (i % (sec_length * elements) < sec_length) {
-            pos = i;
+    auto [res_shape, sections, elements, stride]
+        = get_cumulative_geometry(_shape, axis, "APyFixedArray");
+    const int res_int_bits = int_bits() + int(bit_width(elements - 1));
+    const int res_bits = res_int_bits + frac_bits();
+
+    APyGILRelease gil_release(_nitems);
+
+    // The sums are computed in place, starting from the sign-extended elements
+    APyFixedArray result(res_shape, res_bits, res_int_bits);
+    _cast_correct_wl(result._data.begin(), res_bits, res_int_bits);
+
+    const std::size_t limbs = result._itemsize;
+    const std::size_t section_limbs = elements * stride * limbs;
+    if (limbs == 1) {
+        // Specialization #1: single limb, vectorized prefix sums of the lanes
+        APY_PROFILE_SCOPE("fixed.cumsum.single_limb_simd", _nitems);
+        auto scan_block
+            = [&](std::size_t section, std::size_t lane_begin, std::size_t lane_end) {
+                  simd::vector_prefix_sum(
+                      result._data.begin() + section * section_limbs + lane_begin,
+                      elements,
+                      stride,
+                      lane_end - lane_begin
+                  );
+              };
+        cumulative_for_each_block(sections, stride, _nitems, scan_block);
+        return result;
+    }
+
+    // General case, ripple-carry addition of the limbs
+    APY_PROFILE_SCOPE("fixed.cumsum.mpn", _nitems);
+    auto scan_block = [&](std::size_t section,
+                          std::size_t lane_begin,
+                          std::size_t lane_end) {
+        mp_limb_t* section_begin = &result._data[section * section_limbs];
+        for (std::size_t row = 1; row < elements; row++) {
+            for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+                mp_limb_t* curr = section_begin + (row * stride + lane) * limbs;
+                mpn_add_n(curr, curr, curr - stride * limbs, limbs);
+            }
         }
-        // Perform ripple-carry operation on the limbs
-        mpn_add_n_functor<> {}(
-            &dst._data.at(i * src._itemsize),   // dst
-            &dst._data.at(pos * src._itemsize), // src1
-            &src._data.at(i * src._itemsize),   // src2
-            src._itemsize                       // limb vector length
-        );
     };
-    return cumulative_prod_sum_function(
-        pos_func, int_bit_increase, frac_bit_increase, axis
-    );
+    cumulative_for_each_block(sections, stride, _nitems * limbs, scan_block);
+    return result;
 }
 
 APyFixedArray APyFixedArray::nancumsum(std::optional<nb::int_> axis) const
@@ -1148,12 +1148,12 @@ APyFixedArray::prod(std::optional<std::variant<nb::tuple, nb::int_>> axis) const
         bool sign2 = mp_limb_signed_t(*(op2_end - 1)) < 0;
         bool result_sign = sign1 ^ sign2;
         // Retrieve the absolute value of both operands, as required by GMP
-        std::vector<mp_limb_t> op1_abs(i_sz_1);
-        std::vector<mp_limb_t> op2_abs(i_sz_2);
+        APyLimbVector op1_abs(i_sz_1);
+        APyLimbVector op2_abs(i_sz_2);
         limb_vector_abs(op1_begin, op1_end, op1_abs.begin());
         limb_vector_abs(op2_begin, op2_end, op2_abs.begin());
 
-        std::vector<mp_limb_t> tmp(i_sz_1 + i_sz_2, 0);
+        APyLimbVector tmp(i_sz_1 + i_sz_2, 0);
 
         // Perform the multiplication
         mpn_mul(
@@ -1176,77 +1176,103 @@ APyFixedArray::prod(std::optional<std::variant<nb::tuple, nb::int_>> axis) const
 
 APyFixedArray APyFixedArray::cumprod(std::optional<nb::int_> axis) const
 {
-    auto int_bit_increase = [](std::size_t elements, std::size_t int_bits) {
-        return int((elements - 1) * int_bits);
-    };
-    auto frac_bit_increase = [](std::size_t elements, std::size_t frac_bits) {
-        return int((elements - 1) * frac_bits);
-    };
-    auto pos_func = [](std::size_t i,
-                       std::size_t stride,
-                       std::size_t elems,
-                       APyFixedArray& src,
-                       APyFixedArray& dst,
-                       std::size_t frac_bits) {
-        std::size_t i_sz_1 = src._itemsize;
-        std::size_t i_sz_2 = dst._itemsize;
-        std::size_t pos = i - stride;
-        // handle the case where the current number is the first in a multiplication
-        // chain. when this is the case we need to shift it to the left to offset the
-        // increase in fraction bits later on
-        if (i % (stride * elems) < stride) {
-            pos = i;
-            dst._data.at(i * i_sz_2) = 1;
-            limb_vector_lsl(
-                dst._data.begin() + i * i_sz_2,
-                dst._data.begin() + (i + 1) * i_sz_2,
-                frac_bits * (elems - 1)
-            );
-        }
-        auto op1_begin = src._data.begin() + i * i_sz_1;
-        auto op2_begin = dst._data.begin() + pos * i_sz_2;
-        auto op1_end = op1_begin + i_sz_1;
-        auto op2_end = op2_begin + i_sz_2;
+    auto [res_shape, sections, elements, stride]
+        = get_cumulative_geometry(_shape, axis, "APyFixedArray");
+    const int res_int_bits = int_bits() * int(elements);
+    const int res_frac_bits = frac_bits() * int(elements);
+    const int res_bits = res_int_bits + res_frac_bits;
 
-        // Evaluate resulting sign
-        bool sign1 = mp_limb_signed_t(*(op1_end - 1)) < 0;
-        bool sign2 = mp_limb_signed_t(*(op2_end - 1)) < 0;
-        bool result_sign = sign1 ^ sign2;
-        // Retrieve the absolute value of both operands, as required by GMP
-        std::vector<mp_limb_t> op1_abs(i_sz_1);
-        std::vector<mp_limb_t> op2_abs(i_sz_2);
-        limb_vector_abs(op1_begin, op1_end, op1_abs.begin());
-        limb_vector_abs(op2_begin, op2_end, op2_abs.begin());
+    APyGILRelease gil_release(_nitems);
 
-        std::vector<mp_limb_t> tmp(i_sz_1 + i_sz_2, 0);
+    // The running product of the `row`-th element of a lane has `frac_bits() * (row +
+    // 1)` fractional bits. It is scaled to the `res_frac_bits` of the result.
+    auto scale_shift = [&](std::size_t row) {
+        return frac_bits() * int(elements - 1 - row);
+    };
 
-        // Perform the multiplication
-        mpn_mul(
-            &tmp.at(0),     // dst
-            &op1_abs.at(0), // src1
-            op1_abs.size(), // src1 limb vector length
-            &op2_abs.at(0), // src2
-            op2_abs.size()  // src2 limb vector length
-        );
+    APyFixedArray result(res_shape, res_bits, res_int_bits);
+    const std::size_t limbs = result._itemsize;
+    const std::size_t section_items = elements * stride;
+    if (limbs == 1) {
+        // Specialization #1: single limb, the running products are native integers
+        APY_PROFILE_SCOPE("fixed.cumprod.single_limb", _nitems);
+        auto scan_block = [&](std::size_t section,
+                              std::size_t lane_begin,
+                              std::size_t lane_end) {
+            for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+                mp_limb_t prod = 1;
+                for (std::size_t row = 0; row < elements; row++) {
+                    const std::size_t i = section * section_items + row * stride + lane;
+                    prod *= _data[i];
+                    const int shift = scale_shift(row);
+                    mp_limb_t res = 0;
+                    if (shift < 0) {
+                        res = mp_limb_signed_t(prod)
+                            >> std::min(-shift, int(_LIMB_SIZE_BITS) - 1);
+                    } else if (shift < int(_LIMB_SIZE_BITS)) {
+                        res = prod << shift;
+                    }
+                    _overflow_twos_complement(&res, &res + 1, res_bits, res_int_bits);
+                    result._data[i] = res;
+                }
+            }
+        };
+        cumulative_for_each_block(sections, stride, _nitems, scan_block);
+        return result;
+    }
 
-        // if we are inside a multiplication chain we have overcompensated on the first
-        // number, so now we need to counteract that. This part can be optimized.
-        if (i % (stride * elems) >= stride) {
-            limb_vector_lsr(tmp.begin(), tmp.begin() + i_sz_2, frac_bits);
-        }
+    // General case, the running products are limb vectors
+    APY_PROFILE_SCOPE("fixed.cumprod.mpn", _nitems);
+    auto scan_block = [&](std::size_t section,
+                          std::size_t lane_begin,
+                          std::size_t lane_end) {
+        ScratchVector<mp_limb_t, 8> prod(limbs);
+        ScratchVector<mp_limb_t, 8> prod_abs(limbs);
+        ScratchVector<mp_limb_t, 8> x_abs(_itemsize);
+        ScratchVector<mp_limb_t, 16> tmp(limbs + _itemsize);
+        for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+            for (std::size_t row = 0; row < elements; row++) {
+                const std::size_t i = section * section_items + row * stride + lane;
+                auto x_begin = _data.begin() + i * _itemsize;
+                auto x_end = x_begin + _itemsize;
+                if (row == 0) {
+                    // Sign-extend the first element of the lane
+                    const bool is_negative = limb_vector_is_negative(x_begin, x_end);
+                    std::copy(x_begin, x_end, prod.begin());
+                    std::fill(
+                        prod.begin() + _itemsize,
+                        prod.end(),
+                        is_negative ? mp_limb_t(-1) : mp_limb_t(0)
+                    );
+                } else {
+                    const bool sign
+                        = limb_vector_abs(prod.begin(), prod.end(), prod_abs.begin())
+                        ^ limb_vector_abs(x_begin, x_end, x_abs.begin());
+                    mpn_mul(&tmp[0], &prod_abs[0], limbs, &x_abs[0], _itemsize);
+                    if (sign) {
+                        limb_vector_negate(
+                            tmp.begin(), tmp.begin() + limbs, prod.begin()
+                        );
+                    } else {
+                        std::copy_n(tmp.begin(), limbs, prod.begin());
+                    }
+                }
 
-        if (result_sign) {
-            limb_vector_negate(
-                tmp.begin(), tmp.begin() + i_sz_2, dst._data.begin() + i * i_sz_2
-            );
-        } else {
-            // Copy into resulting vector
-            std::copy_n(tmp.begin(), i_sz_2, dst._data.begin() + i * i_sz_2);
+                auto res_begin = result._data.begin() + i * limbs;
+                auto res_end = res_begin + limbs;
+                std::copy(prod.begin(), prod.end(), res_begin);
+                const int shift = scale_shift(row);
+                if (shift < 0) {
+                    limb_vector_asr(res_begin, res_end, -shift);
+                } else {
+                    limb_vector_lsl(res_begin, res_end, shift);
+                }
+                _overflow_twos_complement(res_begin, res_end, res_bits, res_int_bits);
+            }
         }
     };
-    return cumulative_prod_sum_function(
-        pos_func, int_bit_increase, frac_bit_increase, axis
-    );
+    cumulative_for_each_block(sections, stride, _nitems * limbs * limbs, scan_block);
+    return result;
 }
 
 std::variant<APyFixedArray, APyFixed>
@@ -1280,6 +1306,8 @@ APyFixedArray::convolve(const APyFixedArray& other, const std::string& mode) con
         throw nanobind::value_error(msg.c_str());
     }
 
+    APyGILRelease gil_release(_shape[0] * other._shape[0]);
+
     // Find the shorter array of `*this` and `other` based on length.
     bool swap = _shape[0] < other._shape[0];
 
@@ -1299,7 +1327,7 @@ APyFixedArray::convolve(const APyFixedArray& other, const std::string& mode) con
     const int prod_bits = a->bits() + b->bits();
     const int prod_int_bits = a->int_bits() + b->int_bits();
     std::optional<APyFixedAccumulatorOption> acc_mode = get_accumulator_mode_fixed();
-    auto dot = inner_product_func_from_acc_mode<std::vector<mp_limb_t>>(
+    auto dot = inner_product_func_from_acc_mode<APyLimbVector>(
         prod_bits, prod_int_bits, acc_mode
     );
 
@@ -1407,8 +1435,8 @@ std::variant<APyFixedArray, APyFixed> APyFixedArray::max_min_helper_function(
 
     std::size_t elements = _nitems;
     std::vector<std::size_t> res_shape;
-    std::vector<mp_limb_t> source_data = _data;
-    std::vector<mp_limb_t> temp_data(_data.size(), 0);
+    APyLimbVector source_data = _data;
+    APyLimbVector temp_data(_data.size(), 0);
     std::vector<std::size_t> strides = strides_from_shape(_shape);
     APyFixed lhs_scalar(_bits, _int_bits);
     APyFixed rhs_scalar(_bits, _int_bits);
@@ -1460,12 +1488,13 @@ std::variant<APyFixedArray, APyFixed> APyFixedArray::max_min_helper_function(
 
 std::string APyFixedArray::repr() const
 {
-    std::stringstream ss {};
-    ss << "APyFixedArray([";
+    std::string result = "APyFixedArray([";
     if (_shape[0]) {
-        // Setup hex printing which will properly display the BCD characters
-        ss << std::hex;
-
+        // Format all bit patterns into one string, sharing the decimal power table and
+        // the scratch limb vector between the elements
+        std::size_t n_elements = _data.size() / _itemsize;
+        result.reserve(result.size() + n_elements * (bits() * 31 / 100 + 3) + 64);
+        DecimalPowerTable& table = thread_dec_power_table();
         std::vector<mp_limb_t> data(_itemsize, 0);
         for (std::size_t offset = 0; offset < _data.size(); offset += _itemsize) {
             std::copy_n(_data.begin() + offset, _itemsize, data.begin());
@@ -1476,19 +1505,15 @@ std::string APyFixedArray::repr() const
                 data.back() &= and_mask;
             }
 
-            // Double-dabble for binary-to-BCD conversion
-            ss << bcds_to_string(double_dabble(data));
-            ss << ", ";
+            limb_vector_to_dec_digits(&data[0], _itemsize, 1, table, result);
+            result += ", ";
         }
-
-        ss.seekp(-2, ss.cur);
+        result.resize(result.size() - 2);
     }
-    ss << "], shape=";
-    ss << tuple_string_from_vec(_shape);
-    ss << ", "
-       << "bits=" << std::dec << bits() << ", "
-       << "int_bits=" << std::dec << int_bits() << ")";
-    return ss.str();
+    result += "], shape=" + tuple_string_from_vec(_shape);
+    result += ", bits=" + std::to_string(bits());
+    result += ", int_bits=" + std::to_string(int_bits()) + ")";
+    return result;
 }
 
 APyFixedArray APyFixedArray::reshape(nb::tuple new_shape) const
@@ -1617,12 +1642,17 @@ nb::ndarray<nb::numpy, double> APyFixedArray::to_numpy() const
     // Dynamically allocate data to be passed to python
     double* result_data = new double[size];
 
-    APyFixed type_caster(bits(), int_bits());
-    for (std::size_t i = 0; i < size; i++) {
-        std::copy_n(
-            std::begin(_data) + i * _itemsize, _itemsize, std::begin(type_caster._data)
-        );
-        result_data[i] = double(type_caster);
+    {
+        APyGILRelease gil_release(size);
+        APyFixed type_caster(bits(), int_bits());
+        for (std::size_t i = 0; i < size; i++) {
+            std::copy_n(
+                std::begin(_data) + i * _itemsize,
+                _itemsize,
+                std::begin(type_caster._data)
+            );
+            result_data[i] = double(type_caster);
+        }
     }
 
     // Delete 'data' when the 'owner' capsule expires
@@ -1631,6 +1661,15 @@ nb::ndarray<nb::numpy, double> APyFixedArray::to_numpy() const
     return nb::ndarray<nb::numpy, double>(result_data, _ndim, &_shape[0], owner);
 }
 
+nb::ndarray<nb::numpy, const mp_limb_t> APyFixedArray::_limb_view() const
+{
+    std::vector<std::size_t> limb_shape = _shape;
+    limb_shape.push_back(_itemsize);
+    return nb::ndarray<nb::numpy, const mp_limb_t>(
+        _data.data(), _ndim + 1, &limb_shape[0]
+    );
+}
+
 bool APyFixedArray::is_identical(const APyFixedArray& other) const
 {
     bool same_shape = _shape == other._shape;
@@ -1654,6 +1693,9 @@ APyFixedArray APyFixedArray::cast(
     const auto quantization_mode = quantization.value_or(cast_option.quantization);
     const auto overflow_mode = overflow.value_or(cast_option.overflow);
 
+    APyGILRelease gil_release(_nitems);
+    APY_PROFILE_SCOPE("fixed.cast", _nitems);
+
     // The new result array (`bit_specifier_sanitize()` called in constructor)
     std::size_t result_limbs = bits_to_limbs(new_bits);
     std::size_t pad_limbs = bits_to_limbs(std::max(new_bits, _bits)) - result_limbs;
@@ -1758,7 +1800,130 @@ APyFixedArray APyFixedArray::from_array(
     }
 
     APyFixedArray result(shape, int_bits, frac_bits, bits);
-    result._set_values_from_ndarray(ndarray);
+    {
+        APyGILRelease gil_release(result._nitems);
+        result._set_values_from_ndarray(ndarray);
+    }
+    return result;
+}
+
+APyFixedArray APyFixedArray::_from_limbs(
+    const nb::ndarray<const mp_limb_t, nb::c_contig>& limbs, int bits, int int_bits
+)
+{
+    // Sanitize the bit-specifiers
+    bits = bits_from_optional(bits, int_bits, std::nullopt);
+
+    std::size_t ndim = limbs.ndim();
+    if (ndim < 2 || limbs.shape(ndim - 1) != bits_to_limbs(bits)) {
+        throw nb::value_error(fmt::format(
+            "APyFixedArray._from_limbs(): expected ndarray with ndim >= 2 and {} limbs "
+            "along the last axis",
+            bits_to_limbs(bits)
+        )
+                                  .c_str());
+    }
+    std::vector<std::size_t> shape(ndim - 1, 0);
+    for (std::size_t i = 0; i < ndim - 1; i++) {
+        shape[i] = limbs.shape(i);
+    }
+
+    APyFixedArray result(shape, bits, int_bits);
+    std::copy_n(limbs.data(), result._data.size(), result._data.begin());
+
+    // Make sure that each element is properly sign-extended
+    result._sign_extend();
+    return result;
+}
+
+APyFixedArray APyFixedArray::from_bits(
+    const nb::object& bit_patterns,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<int> bits
+)
+{
+    int res_bits = bits_from_optional(bits, int_bits, frac_bits);
+    std::size_t words = (std::size_t(res_bits) + 63) / 64;
+
+    // Bytes-like object of little-endian words. Checked before the ndarray path, as
+    // nanobind would otherwise import it as a one-dimensional `uint8` ndarray.
+    PyObject* obj = bit_patterns.ptr();
+    if (PyBytes_Check(obj) || PyByteArray_Check(obj) || PyMemoryView_Check(obj)) {
+        Py_buffer view;
+        if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS) != 0) {
+            // E.g., a non-contiguous or released memoryview
+            throw nb::python_error();
+        }
+        std::size_t n_bytes = view.len;
+        if (n_bytes % (8 * words)) {
+            PyBuffer_Release(&view);
+            throw nb::value_error(fmt::format(
+                "APyFixedArray.from_bits(): buffer length {} is not a multiple of the "
+                "{} bytes per element",
+                n_bytes,
+                8 * words
+            )
+                                      .c_str());
+        }
+
+        std::vector<std::size_t> shape = { n_bytes / (8 * words) };
+        APyFixedArray result(shape, int_bits, frac_bits, bits);
+        {
+            APyGILRelease gil_release(result._nitems);
+            const auto* src = static_cast<const unsigned char*>(view.buf);
+            result._set_bits_from_words(words, [src](std::size_t k) {
+                std::uint64_t word = 0;
+                for (unsigned i = 0; i < 8; i++) {
+                    word |= std::uint64_t(src[8 * k + i]) << (8 * i);
+                }
+                return word;
+            });
+        }
+        PyBuffer_Release(&view);
+        return result;
+    }
+
+    if (!nb::isinstance<nb::ndarray<>>(bit_patterns)) {
+        throw nb::type_error(
+            "APyFixedArray.from_bits(): expected an integer ndarray or a bytes-like "
+            "object"
+        );
+    }
+
+    // Integer ndarray, with a trailing axis of words for formats wider than 64 bits
+    auto ndarray = nb::cast<nb::ndarray<nb::c_contig>>(bit_patterns);
+    std::size_t ndim = ndarray.ndim();
+    if (words > 1) {
+        bool is_64_bit = ndarray.dtype() == nb::dtype<std::uint64_t>()
+            || ndarray.dtype() == nb::dtype<std::int64_t>();
+        if (!is_64_bit || ndim < 2 || ndarray.shape(ndim - 1) != words) {
+            throw nb::value_error(fmt::format(
+                "APyFixedArray.from_bits(): expected uint64 or int64 ndarray with "
+                "ndim >= 2 and {} words along the last axis",
+                words
+            )
+                                      .c_str());
+        }
+        ndim--;
+    } else if (ndim == 0) {
+        throw nb::value_error(
+            "APyFixedArray.from_bits(): NDArray with ndim == 0 not supported"
+        );
+    }
+
+    std::vector<std::size_t> shape(ndim, 0);
+    for (std::size_t i = 0; i < ndim; i++) {
+        shape[i] = ndarray.shape(i);
+    }
+    APyFixedArray result(shape, int_bits, frac_bits, bits);
+    APyGILRelease gil_release(result._nitems);
+    if (words == 1) {
+        result._set_bits_from_ndarray(ndarray);
+    } else {
+        const auto* src = static_cast<const std::uint64_t*>(ndarray.data());
+        result._set_bits_from_words(words, [src](std::size_t k) { return src[k]; });
+    }
     return result;
 }
 
@@ -1769,10 +1934,10 @@ APyFixedArray APyFixedArray::from_array(
 template <typename RANDOM_ACCESS_ITERATOR>
 void APyFixedArray::_checked_hadamard_product(
     const APyFixedArray& rhs,
-    RANDOM_ACCESS_ITERATOR res_out,       // output iterator
-    std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-    std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-    std::vector<mp_limb_t>& op2_scratch   // scratch: absolute value operand 2
+    RANDOM_ACCESS_ITERATOR res_out, // output iterator
+    APyLimbVector& prod_scratch,    // scratch: product result
+    APyLimbVector& op1_scratch,     // scratch: absolute value operand 1
+    APyLimbVector& op2_scratch      // scratch: absolute value operand 2
 ) const
 {
     std::size_t res_bits = bits() + rhs.bits();
@@ -1850,9 +2015,9 @@ APyFixedArray APyFixedArray::_checked_inner_product(
             return result;
         } else { /* unsigned(res_bits) > _LIMB_SIZE_BITS */
             // Scratch memories used for inner product
-            std::vector<mp_limb_t> prod_scratch(_itemsize + rhs._itemsize);
-            std::vector<mp_limb_t> op1_scratch(_itemsize);
-            std::vector<mp_limb_t> op2_scratch(rhs._itemsize);
+            APyLimbVector prod_scratch(_itemsize + rhs._itemsize);
+            APyLimbVector op1_scratch(_itemsize);
+            APyLimbVector op2_scratch(rhs._itemsize);
             APyFixedArray hadamard_scratch(
                 _shape, bits() + rhs.bits(), int_bits() + rhs.int_bits()
             );
@@ -1864,9 +2029,9 @@ APyFixedArray APyFixedArray::_checked_inner_product(
     } else { /* mode.has_value() */
 
         // Scratch memories used for inner product
-        std::vector<mp_limb_t> prod_scratch(_itemsize + rhs._itemsize);
-        std::vector<mp_limb_t> op1_scratch(_itemsize);
-        std::vector<mp_limb_t> op2_scratch(rhs._itemsize);
+        APyLimbVector prod_scratch(_itemsize + rhs._itemsize);
+        APyLimbVector op1_scratch(_itemsize);
+        APyLimbVector op2_scratch(rhs._itemsize);
         APyFixedArray hadamard_scratch(
             _shape, bits() + rhs.bits(), int_bits() + rhs.int_bits()
         );
@@ -1881,12 +2046,12 @@ APyFixedArray APyFixedArray::_checked_inner_product(
 }
 
 void APyFixedArray::_checked_inner_product_full(
-    const APyFixedArray& rhs,             // rhs
-    APyFixedArray& result,                // result
-    APyFixedArray& hadamard_scratch,      // scratch: hadamard product
-    std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-    std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-    std::vector<mp_limb_t>& op2_scratch   // scratch: absolute value operand 2
+    const APyFixedArray& rhs,        // rhs
+    APyFixedArray& result,           // result
+    APyFixedArray& hadamard_scratch, // scratch: hadamard product
+    APyLimbVector& prod_scratch,     // scratch: product result
+    APyLimbVector& op1_scratch,      // scratch: absolute value operand 1
+    APyLimbVector& op2_scratch       // scratch: absolute value operand 2
 ) const
 {
     // Hadamard product of `*this` and `rhs`
@@ -1910,9 +2075,9 @@ void APyFixedArray::_checked_inner_product_acc(
     const APyFixedArray& rhs,             // rhs
     APyFixedArray& result,                // result
     APyFixedArray& hadamard_scratch,      // scratch: hadamard product
-    std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-    std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-    std::vector<mp_limb_t>& op2_scratch,  // scratch: absolute value operand 2
+    APyLimbVector& prod_scratch,          // scratch: product result
+    APyLimbVector& op1_scratch,           // scratch: absolute value operand 1
+    APyLimbVector& op2_scratch,           // scratch: absolute value operand 2
     const APyFixedAccumulatorOption& mode // accumulation mode
 ) const
 {
@@ -1962,6 +2127,7 @@ APyFixedArray APyFixedArray::_checked_2d_matmul(
      */
     if (!mode.has_value()) {
         if (res_bits <= _LIMB_SIZE_BITS) {
+            APY_PROFILE_SCOPE("fixed.matmul.single_limb_simd", result._nitems);
             for (std::size_t x = 0; x < res_cols; x++) {
                 // Copy column from `rhs` and use as the current working column. As
                 // reading columns from `rhs` is cache-inefficient, we like to do this
@@ -1985,16 +2151,16 @@ APyFixedArray APyFixedArray::_checked_2d_matmul(
      * General case: This always works but is slower than the special cases.
      */
     // Scratch memories for avoiding memory re-allocation
-    std::vector<mp_limb_t> prod_scratch(_itemsize + rhs._itemsize);
-    std::vector<mp_limb_t> op1_abs(_itemsize);
-    std::vector<mp_limb_t> op2_abs(rhs._itemsize);
+    APyLimbVector prod_scratch(_itemsize + rhs._itemsize);
+    APyLimbVector op1_abs(_itemsize);
+    APyLimbVector op2_abs(rhs._itemsize);
     APyFixedArray current_res({ 1 }, res_bits, res_int_bits);
     APyFixedArray current_row({ _shape[1] }, bits(), int_bits());
     APyFixedArray hadamard_tmp(
         { rhs._shape[0] }, bits() + rhs.bits(), int_bits() + rhs.int_bits()
     );
     if (!mode.has_value()) {
-
+        APY_PROFILE_SCOPE("fixed.matmul.general_mpn", result._nitems);
         for (std::size_t x = 0; x < res_cols; x++) {
             // Copy column from `rhs` and use as the current working column. As
             // reading columns from `rhs` is cache-inefficient, we like to do this
@@ -2037,7 +2203,7 @@ APyFixedArray APyFixedArray::_checked_2d_matmul(
         return result;
 
     } else { /* mode.has_value() */
-
+        APY_PROFILE_SCOPE("fixed.matmul.accumulator", result._nitems);
         result._itemsize = bits_to_limbs(mode->bits);
         for (std::size_t x = 0; x < res_cols; x++) {
             // Copy column from `rhs` and use as the current working column. As
@@ -2225,6 +2391,37 @@ void APyFixedArray::_cast(
     }
 }
 
+template <typename WORD_LOADER>
+void APyFixedArray::_set_bits_from_words(std::size_t words, WORD_LOADER load_word)
+{
+    if constexpr (_LIMB_SIZE_BITS == 64) {
+        // One limb per word
+        for (std::size_t i = 0; i < _data.size(); i++) {
+            _data[i] = load_word(i);
+        }
+    } else { /* _LIMB_SIZE_BITS == 32 */
+        for (std::size_t i = 0; i < _nitems; i++) {
+            for (std::size_t j = 0; j < _itemsize; j++) {
+                std::uint64_t word = load_word(i * words + j / 2);
+                _data[i * _itemsize + j] = mp_limb_t(j % 2 ? word >> 32 : word);
+            }
+        }
+    }
+    _sign_extend();
+}
+
+void APyFixedArray::_sign_extend()
+{
+    if (_bits % _LIMB_SIZE_BITS && _nitems) {
+        simd::vector_sign_extend(
+            _data.begin() + _itemsize - 1, // most significant limb of first element
+            _bits % _LIMB_SIZE_BITS,       // bits
+            _itemsize,                     // stride
+            _nitems                        // count
+        );
+    }
+}
+
 void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray)
 {
 #define CHECK_AND_SET_BITS_FROM_NPTYPE(__TYPE__)                                       \
@@ -2247,6 +2444,7 @@ void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndar
                     );                                                                 \
                 }                                                                      \
             }                                                                          \
+            _sign_extend();                                                            \
             return; /* Conversion completed, exit `_set_bits_from_ndarray()` */        \
         }                                                                              \
     } while (0)
@@ -12,6 +12,7 @@ namespace nb = nanobind;
 
 #include "apybuffer.h"
 #include "apyfixed.h"
+#include "apytypes_allocator.h"
 #include "apytypes_common.h"
 #include "apytypes_util.h"
 
@@ -82,6 +83,16 @@ public:
         const std::vector<std::size_t>& shape, int bits, int int_bits
     );
 
+    //! Constructor: specify shape, word-length, and the two's complement data of all
+    //! elements, `bits_to_limbs(bits)` limbs per element. Each element is wrapped to
+    //! `bits` bits.
+    explicit APyFixedArray(
+        const std::vector<std::size_t>& shape,
+        int bits,
+        int int_bits,
+        APyLimbVector data
+    );
+
     //! Constructor: specify only shape and word-length. Zero data on construction.
     explicit APyFixedArray(
         const std::vector<std::size_t>& shape,
@@ -118,21 +129,6 @@ private:
         std::optional<std::variant<nb::tuple, nb::int_>> axis = std::nullopt
     ) const;
 
-    //! Internal function for the cumprod,cumsum,nancumprod and nancumsum functions
-    APyFixedArray cumulative_prod_sum_function(
-        void (*pos_func)(
-            std::size_t,
-            std::size_t,
-            std::size_t,
-            APyFixedArray&,
-            APyFixedArray&,
-            std::size_t
-        ),
-        int (*int_bit_increase)(std::size_t, std::size_t),
-        int (*frac_bit_increase)(std::size_t, std::size_t),
-        std::optional<nb::int_> axis = std::nullopt
-    ) const;
-
     std::variant<APyFixedArray, APyFixed> max_min_helper_function(
         bool (*comp_func)(APyFixed&, APyFixed&),
         std::optional<std::variant<nb::tuple, nb::int_>> axis = std::nullopt
@@ -263,6 +259,10 @@ public:
     //! Convert to a NumPy array
     nb::ndarray<nb::numpy, double> to_numpy() const;
 
+    //! Zero-copy, read-only NumPy view of the underlying limbs, with shape
+    //! `(*shape, itemsize)`. The view must not outlive `*this`.
+    nb::ndarray<nb::numpy, const mp_limb_t> _limb_view() const;
+
     //! Length of the array
     size_t size() const noexcept;
 
@@ -318,6 +318,23 @@ public:
         std::optional<int> bits = std::nullopt
     );
 
+    //! Create an `APyFixedArray` tensor object from raw two's complement bit patterns,
+    //! given either as an integer ndarray, with a trailing axis of 64-bit words for
+    //! formats wider than 64 bits, or as a bytes-like object of little-endian 64-bit
+    //! words
+    static APyFixedArray from_bits(
+        const nb::object& bit_patterns,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    );
+
+    //! Create an `APyFixedArray` tensor object from an ndarray of limbs, where the
+    //! last axis holds the limbs of each element (least significant limb first)
+    static APyFixedArray _from_limbs(
+        const nb::ndarray<const mp_limb_t, nb::c_contig>& limbs, int bits, int int_bits
+    );
+
 private:
     /* ****************************************************************************** *
      * *                          Private member functions                          * *
@@ -353,12 +370,12 @@ private:
      * undefined behaviour.
      */
     void _checked_inner_product_full(
-        const APyFixedArray& rhs,             // rhs
-        APyFixedArray& result,                // result
-        APyFixedArray& hadamard_scratch,      // scratch: hadamard product
-        std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-        std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-        std::vector<mp_limb_t>& op2_scratch   // scratch: absolute value operand 2
+        const APyFixedArray& rhs,        // rhs
+        APyFixedArray& result,           // result
+        APyFixedArray& hadamard_scratch, // scratch: hadamard product
+        APyLimbVector& prod_scratch,     // scratch: product result
+        APyLimbVector& op1_scratch,      // scratch: absolute value operand 1
+        APyLimbVector& op2_scratch       // scratch: absolute value operand 2
     ) const;
 
     /*!
@@ -371,9 +388,9 @@ private:
         const APyFixedArray& rhs,             // rhs
         APyFixedArray& result,                // result
         APyFixedArray& hadamard_scratch,      // scratch: hadamard product
-        std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-        std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-        std::vector<mp_limb_t>& op2_scratch,  // scratch: absolute value operand 2
+        APyLimbVector& prod_scratch,          // scratch: product result
+        APyLimbVector& op1_scratch,           // scratch: absolute value operand 1
+        APyLimbVector& op2_scratch,           // scratch: absolute value operand 2
         const APyFixedAccumulatorOption& mode // accumulation mode
     ) const;
 
@@ -388,11 +405,11 @@ private:
      */
     template <typename RANDOM_ACCESS_ITERATOR>
     void _checked_hadamard_product(
-        const APyFixedArray& rhs,             // rhs
-        RANDOM_ACCESS_ITERATOR res_out,       // output iterator
-        std::vector<mp_limb_t>& prod_scratch, // scratch: product result
-        std::vector<mp_limb_t>& op1_scratch,  // scratch: absolute value operand 1
-        std::vector<mp_limb_t>& op2_scratch   // scratch: absolute value operand 2
+        const APyFixedArray& rhs,       // rhs
+        RANDOM_ACCESS_ITERATOR res_out, // output iterator
+        APyLimbVector& prod_scratch,    // scratch: product result
+        APyLimbVector& op1_scratch,     // scratch: absolute value operand 1
+        APyLimbVector& op2_scratch      // scratch: absolute value operand 2
     ) const;
 
     /*!
@@ -429,6 +446,18 @@ private:
      */
     void _set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray);
 
+    /*!
+     * Set the underlying bit values of `*this` from 64-bit words, least significant
+     * word first, with `words` words per element. The `k`-th word is retrieved with
+     * `load_word(k)`.
+     */
+    template <typename WORD_LOADER>
+    void _set_bits_from_words(std::size_t words, WORD_LOADER load_word);
+
+    //! Two's complement sign-extend every element from `_bits` bits, in a single pass
+    //! over the most significant limbs
+    void _sign_extend();
+
     /*!
      * Set the values of `*this` from a NDArray object of floats/integers. This member
      * function assumes that the shape of `*this` and `ndarray` are equal. The elements
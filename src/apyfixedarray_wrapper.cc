@@ -1083,6 +1083,101 @@ void bind_fixed_array(nb::module_& m)
             :class:`APyFixedArray`
             )pbdoc"
         )
+        .def_static(
+            "from_bits",
+            &APyFixedArray::from_bits,
+            nb::arg("bit_patterns"),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("bits") = nb::none(),
+            R"pbdoc(
+            Create an :class:`APyFixedArray` object from raw two's complement bit patterns.
+
+            This is the bulk counterpart of :class:`APyFixedArray` initialized from a sequence
+            of Python :class:`int`, suited for loading e.g. memory dumps. Bits above the
+            fixed-point word length are ignored and each element is sign-extended. Exactly two
+            of the three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must be set.
+
+            Parameters
+            ----------
+            bit_patterns : ndarray or bytes-like
+                Bit patterns to initialize from. Either a NumPy integer array or a bytes-like
+                object. For formats of at most 64 bits, each ndarray element holds one bit
+                pattern, and the array shape is the ndarray shape. For wider formats, the
+                ndarray must be of dtype `uint64` or `int64`, with a trailing axis of
+                `ceil(bits / 64)` words, least significant word first, and the array shape is
+                the ndarray shape without the trailing axis. A bytes-like object is read as
+                consecutive elements of `ceil(bits / 64)` little-endian 64-bit words, and
+                creates a one-dimensional array.
+            int_bits : int, optional
+                Number of integer bits in the created fixed-point tensor.
+            frac_bits : int, optional
+                Number of fractional bits in the created fixed-point tensor.
+            bits : int, optional
+                Total number of bits in the created fixed-point tensor.
+
+            Examples
+            --------
+
+            >>> from apytypes import APyFixedArray
+            >>> import numpy as np
+
+            Array `a`, with two 100-bit elements given as pairs of 64-bit words
+
+            >>> a = APyFixedArray.from_bits(
+            ...     np.array([[1, 0], [0, 1]], dtype=np.uint64),
+            ...     int_bits=100,
+            ...     frac_bits=0,
+            ... )
+            >>> a
+            APyFixedArray([1, 18446744073709551616], shape=(2,), bits=100, int_bits=100)
+
+            Array `b`, initialized from a bytes buffer
+
+            >>> b = APyFixedArray.from_bits(bytes([255] * 8), int_bits=4, frac_bits=0)
+            >>> b
+            APyFixedArray([15], shape=(1,), bits=4, int_bits=4)
+
+            Returns
+            -------
+            :class:`APyFixedArray`
+            )pbdoc"
+        )
+
+        /*
+         * Raw limb access (serialization)
+         */
+        .def(
+            "_limb_view",
+            &APyFixedArray::_limb_view,
+            nb::rv_policy::reference_internal,
+            R"pbdoc(
+            Zero-copy, read-only view of the underlying limbs of the array.
+
+            The returned :class:`numpy.ndarray` has shape `(*self.shape, n_limbs)`, with
+            the least significant limb of each element first. Each limb is
+            `apytypes._apytypes._LIMB_SIZE_BYTES` bytes wide.
+
+            Returns
+            -------
+            :class:`numpy.ndarray`
+            )pbdoc"
+        )
+        .def_static(
+            "_from_limbs",
+            &APyFixedArray::_from_limbs,
+            nb::arg("limbs"),
+            nb::arg("bits"),
+            nb::arg("int_bits"),
+            R"pbdoc(
+            Create an :class:`APyFixedArray` from an ndarray of limbs, as returned by
+            :func:`APyFixedArray._limb_view`.
+
+            Returns
+            -------
+            :class:`APyFixedArray`
+            )pbdoc"
+        )
 
         /*
          * Dunder methods
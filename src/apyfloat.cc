@@ -747,15 +747,27 @@ APyFixed APyFloat::to_fixed() const
 
 APyFloat APyFloat::operator+(const APyFloat& rhs) const
 {
+    const auto quantization = get_float_quantization_mode();
+    const bool is_same_type = same_type_as(rhs);
+    if (is_same_type && WideFloatAddKernel::is_applicable(man_bits, quantization)) {
+        // Same kernels as `APyFloatArray::operator+`
+        if (FloatAddKernel::is_applicable(man_bits, quantization)) {
+            const FloatAddKernel add(exp_bits, man_bits, quantization);
+            return APyFloat(add(get_data(), rhs.get_data()), exp_bits, man_bits, bias);
+        }
+        const WideFloatAddKernel add(exp_bits, man_bits, quantization);
+        return APyFloat(add(get_data(), rhs.get_data()), exp_bits, man_bits, bias);
+    }
+
     APyFloat res, x, y;
     // Handle the zero cases, other special cases are further down
-    if (same_type_as(rhs)) {
+    if (is_same_type) {
         // Sign is currently not handled correctly if both operands are zero
         if (is_zero()) {
             if (rhs.is_zero()) {
                 const bool new_sign = (sign == rhs.sign)
                     ? sign
-                    : get_float_quantization_mode() == QuantizationMode::TRN;
+                    : quantization == QuantizationMode::TRN;
                 return construct_zero(new_sign);
             }
             return rhs;
@@ -782,7 +794,7 @@ APyFloat APyFloat::operator+(const APyFloat& rhs) const
             std::swap(x, y);
         } else if (sign != rhs.sign && exp == rhs.exp && man == rhs.man) {
             // +0 for all quantization modes except TO_NEG
-            res.set_to_zero(get_float_quantization_mode() == QuantizationMode::TRN);
+            res.set_to_zero(quantization == QuantizationMode::TRN);
             return res;
         }
     } else {
@@ -796,7 +808,7 @@ APyFloat APyFloat::operator+(const APyFloat& rhs) const
             if (rhs.is_zero()) {
                 const bool new_sign = (sign == rhs.sign)
                     ? sign
-                    : get_float_quantization_mode() == QuantizationMode::TRN;
+                    : quantization == QuantizationMode::TRN;
                 res.set_to_zero(new_sign);
                 return res;
             }
@@ -824,14 +836,12 @@ APyFloat APyFloat::operator+(const APyFloat& rhs) const
             std::swap(x, y);
         } else if (sign != rhs.sign && x.true_exp() == y.true_exp() && x.man == y.man) {
             // +0 for all quantization modes except TO_NEG
-            res.set_to_zero(get_float_quantization_mode() == QuantizationMode::TRN);
+            res.set_to_zero(quantization == QuantizationMode::TRN);
             return res;
         }
     }
     res.sign = x.sign;
 
-    const auto quantization = get_float_quantization_mode();
-
     const auto x_true_exp = x.true_exp();
     // Tentative exponent
     std::int64_t new_exp = x_true_exp + res.bias;
@@ -982,16 +992,27 @@ APyFloat APyFloat::operator-() const
 APyFloat& APyFloat::operator+=(const APyFloat& rhs)
 {
     assert(same_type_as(rhs));
-    // Check that only the slow case is using this method
-    // If this fails, add a fast path
-    assert(man_bits + 5 > _MAN_T_SIZE_BITS);
+    const auto quantization = get_float_quantization_mode();
+    if (WideFloatAddKernel::is_applicable(man_bits, quantization)) {
+        // Same kernels as `APyFloat::operator+`
+        APyFloatData sum;
+        if (FloatAddKernel::is_applicable(man_bits, quantization)) {
+            const FloatAddKernel add(exp_bits, man_bits, quantization);
+            sum = add(get_data(), rhs.get_data());
+        } else {
+            const WideFloatAddKernel add(exp_bits, man_bits, quantization);
+            sum = add(get_data(), rhs.get_data());
+        }
+        sign = sum.sign;
+        exp = sum.exp;
+        man = sum.man;
+        return *this;
+    }
 
     // Handle the zero cases, other special cases are further down
     if (is_zero()) {
         if (rhs.is_zero()) {
-            sign = (sign == rhs.sign)
-                ? sign
-                : get_float_quantization_mode() == QuantizationMode::TRN;
+            sign = (sign == rhs.sign) ? sign : quantization == QuantizationMode::TRN;
             exp = 0;
             man = 0;
         } else {
@@ -1023,7 +1044,6 @@ APyFloat& APyFloat::operator+=(const APyFloat& rhs)
     const bool same_sign = sign == rhs.sign;
     const APyFloat* x = &*this;
     const APyFloat* y = &rhs;
-    const auto quantization = get_float_quantization_mode();
     // Compute sign and swap operands if need to make sure |x| >= |y|
     if (exp < rhs.exp || (exp == rhs.exp && man < rhs.man)) {
         sign = rhs.sign;
@@ -1046,7 +1066,7 @@ APyFloat& APyFloat::operator+=(const APyFloat& rhs)
     // Align mantissas based on exponent difference
     const unsigned exp_delta = exp - smaller_exp;
 
-    // Slower path only as fast path is not currently used
+    // Slower path, only used for weighted stochastic quantization
 
     // Two integer bits, sign bit and leading one
     const APyFixed apy_mx(2 + man_bits, 2, limb_vector_from_uint64_t({ mx }));
@@ -1114,18 +1134,25 @@ APyFloat APyFloat::operator*(const APyFloat& y) const
     const auto res_exp_bits = std::max(exp_bits, y.exp_bits);
     const auto res_man_bits = std::max(man_bits, y.man_bits);
     const auto res_bias = calc_bias(res_exp_bits, exp_bits, bias, y.exp_bits, y.bias);
-    APyFloat res(res_exp_bits, res_man_bits, res_bias);
-
-    // Perform the product
-    APyFloatData lhs { get_data() }, rhs { y.get_data() }, res_data {};
-    float_product(&lhs, &rhs, &res_data, *this, y);
 
-    // Return the result
-    res.exp = res_data.exp;
-    res.man = res_data.man;
-    res.sign = res_data.sign;
-
-    return res;
+    // Same kernels as `APyFloatArray::hadamard_multiplication`
+    return with_float_product_kernel(
+        exp_bits,
+        man_bits,
+        bias,
+        y.exp_bits,
+        y.man_bits,
+        y.bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        get_float_quantization_mode(),
+        [&](const auto& product) {
+            return APyFloat(
+                product(get_data(), y.get_data()), res_exp_bits, res_man_bits, res_bias
+            );
+        }
+    );
 }
 
 APyFloat APyFloat::operator/(const APyFloat& y) const
@@ -1133,96 +1160,23 @@ APyFloat APyFloat::operator/(const APyFloat& y) const
     const auto res_exp_bits = std::max(exp_bits, y.exp_bits);
     const auto res_man_bits = std::max(man_bits, y.man_bits);
     const auto res_bias = calc_bias(res_exp_bits, exp_bits, bias, y.exp_bits, y.bias);
-    APyFloat res(res_exp_bits, res_man_bits, res_bias);
-
-    // Calculate sign
-    res.sign = sign ^ y.sign;
-
-    // Handle special operands
-    if (is_nan() || y.is_nan() || (is_zero() && y.is_zero())
-        || (is_inf() && y.is_inf())) {
-        res.set_to_nan();
-        return res;
-    }
-
-    if (is_zero() || y.is_inf()) {
-        res.set_to_zero();
-        return res;
-    }
-
-    if (is_inf() || y.is_zero()) {
-        res.set_to_inf();
-        return res;
-    }
-
-    const auto quantization = get_float_quantization_mode();
 
-    // Normalize both inputs
-    const APyFloat norm_x = normalized();
-    const APyFloat norm_y = y.normalized();
-
-    std::int64_t new_exp = ((std::int64_t)norm_x.exp - (std::int64_t)norm_x.bias)
-        - ((std::int64_t)norm_y.exp - (std::int64_t)norm_y.bias)
-        + (std::int64_t)res.bias;
-
-    // Add leading one's
-    const man_t mx = norm_x.true_man();
-    const man_t my = norm_y.true_man();
-
-    // Guard bits for getting enough fractional bits out of fixed-point division
-    const auto guard_bits = 64;
-
-    // Two integer bits, sign bit and leading one
-    const APyFixed apy_mx(
-        2 + guard_bits + norm_x.man_bits, 2, limb_vector_from_uint64_t({ mx })
+    // Same kernel as `APyFloatArray::operator/`
+    const FloatQuotientKernel quotient(
+        exp_bits,
+        man_bits,
+        bias,
+        y.exp_bits,
+        y.man_bits,
+        y.bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        get_float_quantization_mode()
     );
-    const APyFixed apy_my(
-        2 + guard_bits + norm_y.man_bits, 2, limb_vector_from_uint64_t({ my })
+    return APyFloat(
+        quotient(get_data(), y.get_data()), res_exp_bits, res_man_bits, res_bias
     );
-    auto apy_man_res = apy_mx / apy_my;
-
-    // The result from the division will be in (1/2, 2) so normalization may be
-    // required
-    if (!apy_man_res.positive_greater_than_equal_pow2(0)) {
-        apy_man_res <<= 1;
-        new_exp--;
-    }
-
-    // Check limits
-    if (new_exp >= res.max_exponent()) {
-        if (do_infinity(quantization, res.sign)) {
-            res.exp = res.max_exponent();
-            res.man = 0;
-        } else {
-            res.exp = res.max_exponent() - 1;
-            res.man = res.man_mask();
-        }
-        return res;
-    }
-
-    // Handle subnormal case
-    if (new_exp <= 0) {
-        apy_man_res >>= std::abs(new_exp) + 1;
-        new_exp = 0;
-    }
-
-    // Quantize mantissa. This will never create carry.
-    quantize_apymantissa(apy_man_res, res.sign, res.man_bits, quantization);
-
-    // Remove leading one
-    if (apy_man_res.positive_greater_than_equal_pow2(0)) {
-        apy_man_res = apy_man_res - fx_one;
-
-        // If a leading one is present while the exponent is zero,
-        // then it 'acts like a carry' and creates a normal number
-        if (new_exp == 0) {
-            new_exp = 1;
-        }
-    }
-    apy_man_res <<= res.man_bits;
-    res.man = (man_t)(apy_man_res).to_double();
-    res.exp = new_exp;
-    return res;
 }
 
 /* ******************************************************************************
@@ -1323,6 +1277,57 @@ APyFloat APyFloat::pown(const APyFloat& x, int n)
         return res;
     }
 
+    if (max_man_bits <= 8 * sizeof(man2_t)) {
+        // Exact power of the mantissa in two words, with `frac_bits` fractional bits
+        man2_t pow_man = ipow(man2_t(mx), abs_n);
+        std::uint64_t frac_bits = abs_n * x.man_bits;
+
+        // Normalize mantissa
+        const std::uint64_t man_width = bit_width(pow_man);
+        if (man_width > frac_bits + 1) {
+            new_exp += man_width - frac_bits - 1;
+            frac_bits = man_width - 1;
+        }
+
+        if (new_exp <= 0) {
+            // Handle subnormal case
+            frac_bits += -new_exp + 1;
+            new_exp = 0;
+        } else {
+            // Remove leading one
+            pow_man = pow_man - (man2_t(1) << frac_bits);
+        }
+
+        // At least one bit is quantized away. Bits beyond the two words only
+        // contribute to the sticky bit.
+        if (frac_bits == x.man_bits) {
+            pow_man <<= 1;
+            frac_bits++;
+        }
+        std::uint64_t bits_to_quantize = frac_bits - x.man_bits;
+        if (bits_to_quantize >= 8 * sizeof(man2_t)) {
+            pow_man = man2_t(pow_man != 0);
+            bits_to_quantize = 8 * sizeof(man2_t) - 1;
+        }
+
+        // Quantize mantissa, saturating the exponent on overflow
+        exp_t res_exp = exp_t(std::min(new_exp, std::int64_t(x.max_exponent())));
+        quantize_mantissa(
+            pow_man,
+            res_exp,
+            x.max_exponent(),
+            bits_to_quantize,
+            new_sign,
+            man2_t(1) << x.man_bits,
+            bits_to_quantize - 1,
+            (man2_t(1) << (bits_to_quantize - 1)) - 1,
+            quantization
+        );
+        return APyFloat(
+            new_sign, res_exp, man_t(pow_man), x.exp_bits, x.man_bits, x.bias
+        );
+    }
+
     // Slow path
     const APyFixed apy_mx(2 + x.man_bits, 2, limb_vector_from_uint64_t({ mx }));
     APyFixed apy_res = ipow(apy_mx, abs_n);
@@ -1348,8 +1353,14 @@ APyFloat APyFloat::pown(const APyFloat& x, int n)
         apy_res >>= 1;
     }
 
+    // Overflow, to infinity or the largest finite number as in `quantize_mantissa`
     if (new_exp >= x.max_exponent()) {
-        return x.construct_inf();
+        if (do_infinity(quantization, new_sign)) {
+            return x.construct_inf(new_sign);
+        }
+        return APyFloat(
+            new_sign, x.max_exponent() - 1, x.man_mask(), x.exp_bits, x.man_bits, x.bias
+        );
     }
 
     if (apy_res.positive_greater_than_equal_pow2(0)) { // Remove leading one
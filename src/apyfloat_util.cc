@@ -1,6 +1,14 @@
 #include "apyfloat_util.h"
 #include <fmt/format.h>
 #include <math.h>
+
+#include <algorithm>   // std::min, std::max, std::min_element
+#include <functional>  // std::multiplies
+#include <map>         // std::map
+#include <memory>      // std::shared_ptr
+#include <mutex>       // std::mutex, std::lock_guard
+#include <tuple>       // std::tuple, std::make_tuple
+#include <type_traits> // std::integral_constant
 #include <nanobind/nanobind.h>
 
 namespace nb = nanobind;
@@ -28,6 +36,26 @@ man_t ipow(man_t base, unsigned int n)
     return result;
 }
 
+man2_t ipow(man2_t base, unsigned int n)
+{
+    man2_t result = 1;
+    for (;;) {
+        if (n & 1) {
+            result = result * base;
+        }
+
+        n >>= 1;
+
+        if (!n) {
+            break;
+        }
+
+        base = base * base;
+    }
+
+    return result;
+}
+
 exp_t calc_bias_general(
     int new_exp_bits, int exp_bits1, exp_t bias1, int exp_bits2, exp_t bias2
 )
@@ -101,3 +129,852 @@ void check_mantissa_format(int man_bits)
                                   .c_str());
     }
 }
+
+/* ********************************************************************************** *
+ * *                                  Array casting                                 * *
+ * ********************************************************************************** */
+
+//! Cast of a single element. The quantization mode is a template parameter, so that
+//! the quantization in the inlined `quantize_mantissa` is resolved at compile time.
+template <QuantizationMode QUANTIZATION>
+static APY_INLINE APyFloatData
+float_cast_element(const APyFloatData& x, const FloatCastConstants& c)
+{
+    // Handle special values first
+    if (x.exp == c.max_exp) {
+        return { x.sign, c.new_max_exp, man_t(x.man != 0) };
+    }
+    if (x.exp == 0 && x.man == 0) {
+        return { x.sign, 0, 0 };
+    }
+
+    // Initial value for exponent
+    std::int64_t new_exp = std::int64_t(x.exp) + (x.exp == 0) + c.bias_delta;
+
+    // Normalize the exponent and mantissa if converting from a subnormal
+    man_t prev_man = x.man;
+    if (x.exp == 0) {
+        const exp_t subn_adjustment = count_trailing_bits(x.man);
+        new_exp = new_exp - c.man_bits + subn_adjustment;
+        const man_t remainder = x.man % (1ULL << subn_adjustment);
+        prev_man = remainder << (c.man_bits - subn_adjustment);
+    }
+
+    // Check if the number will be converted to a subnormal
+    if (new_exp <= 0) {
+        if (new_exp < -static_cast<std::int64_t>(c.new_man_bits)) {
+            // Exponent too small after rounding
+            const man_t man = quantize_close_to_zero(x.sign, prev_man, QUANTIZATION);
+            return { x.sign, 0, man };
+        }
+        exp_t exp = 0;
+        man_t man = prev_man | c.leading_one;
+        const int man_bits_delta = 1 - new_exp + c.man_bits_delta;
+        if (man_bits_delta > 0) {
+            quantize_mantissa(
+                man,
+                exp,
+                c.new_max_exp,
+                man_bits_delta,
+                x.sign,
+                c.new_leading_one,
+                QUANTIZATION
+            );
+        } else {
+            man <<= -man_bits_delta;
+        }
+        return { x.sign, exp, man };
+    }
+
+    exp_t exp = exp_t(new_exp);
+    man_t man = prev_man;
+    if (c.man_bits_delta <= 0) {
+        // Only zeros are added
+        if (exp >= c.new_max_exp) {
+            if (do_infinity(QUANTIZATION, x.sign)) {
+                return { x.sign, c.new_max_exp, 0 };
+            } else {
+                return { x.sign, c.new_max_exp - 1, c.new_leading_one - 1 };
+            }
+        }
+        return { x.sign, exp, man << -c.man_bits_delta };
+    }
+    quantize_mantissa(
+        man,
+        exp,
+        c.new_max_exp,
+        c.man_bits_delta,
+        x.sign,
+        c.new_leading_one,
+        c.bits_dec,
+        c.sticky_constant,
+        QUANTIZATION
+    );
+    return { x.sign, exp, man };
+}
+
+//! Cast of `n` elements. Narrowing casts of normal numbers with a deterministic
+//! quantization mode are vectorized, see `simd::vector_float_cast`.
+template <QuantizationMode QUANTIZATION>
+static void float_cast_block(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    const FloatCastConstants& c
+)
+{
+    if constexpr (QUANTIZATION != QuantizationMode::STOCH_WEIGHTED
+                  && QUANTIZATION != QuantizationMode::STOCH_EQUAL) {
+        if (c.man_bits_delta > 0) {
+            const auto simd_constants = c.simd_constants(QUANTIZATION);
+            simd::FloatTile tile;
+            for (std::size_t begin = 0; begin < n; begin += simd::_FLOAT_TILE_SIZE) {
+                const std::size_t size = std::min(simd::_FLOAT_TILE_SIZE, n - begin);
+                tile.load(src + begin, size);
+                simd::vector_float_cast(tile, size, simd_constants);
+                for (std::size_t i = 0; i < size; i++) {
+                    dst[begin + i] = tile.fixup[i]
+                        ? float_cast_element<QUANTIZATION>(src[begin + i], c)
+                        : tile.result(i);
+                }
+            }
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < n; i++) {
+        dst[i] = float_cast_element<QUANTIZATION>(src[i], c);
+    }
+}
+
+//! Cast of `n` elements, distributed over threads (see `parallel_for`). The stochastic
+//! quantization modes draw from the random number generator of the calling thread, so
+//! they are cast on the calling thread only.
+template <QuantizationMode QUANTIZATION>
+static void float_cast_loop(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    const FloatCastConstants& c
+)
+{
+    if constexpr (QUANTIZATION == QuantizationMode::STOCH_WEIGHTED
+                  || QUANTIZATION == QuantizationMode::STOCH_EQUAL) {
+        float_cast_block<QUANTIZATION>(src, dst, n, c);
+    } else {
+        parallel_for(n, n, [&](std::size_t begin, std::size_t end) {
+            float_cast_block<QUANTIZATION>(src + begin, dst + begin, end - begin, c);
+        });
+    }
+}
+
+//! Call `fn` with `std::integral_constant<QuantizationMode, quantization>`, so that the
+//! cast loop it calls is specialized on the quantization mode
+template <typename FUNC>
+static void with_cast_quantization(QuantizationMode quantization, FUNC&& fn)
+{
+    using QM = QuantizationMode;
+    switch (quantization) {
+    case QM::RND_CONV:
+        return fn(std::integral_constant<QM, QM::RND_CONV>());
+    case QM::RND_CONV_ODD:
+        return fn(std::integral_constant<QM, QM::RND_CONV_ODD>());
+    case QM::TRN_INF:
+        return fn(std::integral_constant<QM, QM::TRN_INF>());
+    case QM::TRN:
+        return fn(std::integral_constant<QM, QM::TRN>());
+    case QM::TRN_AWAY:
+        return fn(std::integral_constant<QM, QM::TRN_AWAY>());
+    case QM::TRN_ZERO:
+        return fn(std::integral_constant<QM, QM::TRN_ZERO>());
+    case QM::TRN_MAG:
+        return fn(std::integral_constant<QM, QM::TRN_MAG>());
+    case QM::RND_INF:
+        return fn(std::integral_constant<QM, QM::RND_INF>());
+    case QM::RND_ZERO:
+        return fn(std::integral_constant<QM, QM::RND_ZERO>());
+    case QM::RND:
+        return fn(std::integral_constant<QM, QM::RND>());
+    case QM::RND_MIN_INF:
+        return fn(std::integral_constant<QM, QM::RND_MIN_INF>());
+    case QM::JAM:
+        return fn(std::integral_constant<QM, QM::JAM>());
+    case QM::JAM_UNBIASED:
+        return fn(std::integral_constant<QM, QM::JAM_UNBIASED>());
+    case QM::STOCH_WEIGHTED:
+        return fn(std::integral_constant<QM, QM::STOCH_WEIGHTED>());
+    case QM::STOCH_EQUAL:
+        return fn(std::integral_constant<QM, QM::STOCH_EQUAL>());
+    default:
+        throw NotImplementedException(
+            "Not implemented: float_cast() with "
+            "unknown (did you pass `int` as `QuantizationMode`?)"
+        );
+    }
+}
+
+void float_cast(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    std::uint8_t new_exp_bits,
+    std::uint8_t new_man_bits,
+    exp_t new_bias,
+    QuantizationMode quantization
+)
+{
+    const FloatCastConstants c(
+        exp_bits, man_bits, bias, new_exp_bits, new_man_bits, new_bias
+    );
+    with_cast_quantization(quantization, [&](auto q) {
+        float_cast_loop<decltype(q)::value>(src, dst, n, c);
+    });
+}
+
+void float_cast_no_quant(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    std::uint8_t new_exp_bits,
+    std::uint8_t new_man_bits,
+    exp_t new_bias
+)
+{
+    const exp_t max_exp = exp_t((1ULL << exp_bits) - 1);
+    const exp_t new_max_exp = exp_t((1ULL << new_exp_bits) - 1);
+    const std::int64_t bias_delta = std::int64_t(new_bias) - std::int64_t(bias);
+    const unsigned man_shift = new_man_bits - man_bits;
+    parallel_for(n, n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const APyFloatData x = src[i];
+            if (x.exp == max_exp) {
+                // NaN or Inf
+                dst[i] = { x.sign, new_max_exp, man_t(x.man != 0) };
+            } else if (x.exp != 0) {
+                // Normal
+                dst[i] = { x.sign, exp_t(x.exp + bias_delta), x.man << man_shift };
+            } else if (x.man == 0) {
+                // Zero
+                dst[i] = { x.sign, 0, 0 };
+            } else {
+                // Subnormal, normalize
+                const exp_t subn_adjustment = count_trailing_bits(x.man);
+                const std::int64_t new_exp
+                    = 1 + bias_delta - man_bits + subn_adjustment;
+                const man_t remainder = x.man % (1ULL << subn_adjustment);
+                const man_t new_man = remainder << (man_bits - subn_adjustment);
+                dst[i] = { x.sign, exp_t(new_exp), new_man << man_shift };
+            }
+        }
+    });
+}
+
+/* ********************************************************************************** *
+ * *                     Table-driven arithmetic of small formats                   * *
+ * ********************************************************************************** */
+
+bool FloatOpTable::is_applicable(
+    int x_exp_bits,
+    int x_man_bits,
+    int y_exp_bits,
+    int y_man_bits,
+    int res_exp_bits,
+    int res_man_bits,
+    QuantizationMode quantization,
+    std::size_t n
+)
+{
+    if (1 + x_exp_bits + x_man_bits > _FLOAT_TABLE_MAX_BITS
+        || 1 + y_exp_bits + y_man_bits > _FLOAT_TABLE_MAX_BITS
+        || 1 + res_exp_bits + res_man_bits > 16
+        || quantization == QuantizationMode::STOCH_WEIGHTED
+        || quantization == QuantizationMode::STOCH_EQUAL) {
+        return false;
+    }
+    const std::size_t n_entries = std::size_t(1)
+        << (2 + x_exp_bits + x_man_bits + y_exp_bits + y_man_bits);
+    return n * _FLOAT_TABLE_MIN_OPS_FRACTION >= n_entries;
+}
+
+FloatOpTable::FloatOpTable(
+    FloatTableOp op,
+    std::uint8_t x_exp_bits,
+    std::uint8_t x_man_bits,
+    exp_t x_bias,
+    std::uint8_t y_exp_bits,
+    std::uint8_t y_man_bits,
+    exp_t y_bias,
+    std::uint8_t res_exp_bits,
+    std::uint8_t res_man_bits,
+    exp_t res_bias,
+    QuantizationMode quantization
+)
+    : x_exp_bits { x_exp_bits }
+    , x_man_bits { x_man_bits }
+    , y_exp_bits { y_exp_bits }
+    , y_man_bits { y_man_bits }
+    , y_bits { std::uint8_t(1 + y_exp_bits + y_man_bits) }
+    , res_exp_bits { res_exp_bits }
+    , res_man_bits { res_man_bits }
+    , results(std::size_t(1) << (1 + x_exp_bits + x_man_bits + y_bits))
+{
+    assert(is_applicable(
+        x_exp_bits,
+        x_man_bits,
+        y_exp_bits,
+        y_man_bits,
+        res_exp_bits,
+        res_man_bits,
+        quantization,
+        results.size()
+    ));
+
+    const std::size_t x_count = std::size_t(1) << (1 + x_exp_bits + x_man_bits);
+    const std::size_t y_count = std::size_t(1) << y_bits;
+    auto set_result = [&](std::size_t i, std::size_t j, const APyFloatData& res) {
+        results[(i << y_bits) | j]
+            = pack_float_data<std::uint16_t>(res, res_exp_bits, res_man_bits);
+    };
+
+    if (op == FloatTableOp::MUL) {
+        // The product kernel supports any result format
+        const FloatProductKernel product(
+            x_exp_bits,
+            x_man_bits,
+            x_bias,
+            y_exp_bits,
+            y_man_bits,
+            y_bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        );
+        for (std::size_t i = 0; i < x_count; i++) {
+            const APyFloatData x = unpack_float_data(i, x_exp_bits, x_man_bits);
+            for (std::size_t j = 0; j < y_count; j++) {
+                const APyFloatData y = unpack_float_data(j, y_exp_bits, y_man_bits);
+                set_result(i, j, product(x, y));
+            }
+        }
+        return;
+    }
+
+    if (op == FloatTableOp::DIV) {
+        const FloatQuotientKernel quotient(
+            x_exp_bits,
+            x_man_bits,
+            x_bias,
+            y_exp_bits,
+            y_man_bits,
+            y_bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        );
+        for (std::size_t i = 0; i < x_count; i++) {
+            const APyFloatData x = unpack_float_data(i, x_exp_bits, x_man_bits);
+            for (std::size_t j = 0; j < y_count; j++) {
+                const APyFloatData y = unpack_float_data(j, y_exp_bits, y_man_bits);
+                set_result(i, j, quotient(x, y));
+            }
+        }
+        return;
+    }
+
+    // The scalar addition quantizes with the quantization mode of the calling thread.
+    // It is restored when done, also if an exception is thrown.
+    struct QuantizationModeRestorer {
+        const QuantizationMode previous = get_float_quantization_mode();
+        ~QuantizationModeRestorer() { set_float_quantization_mode(previous); }
+    } restorer;
+    set_float_quantization_mode(quantization);
+    APyFloat x(x_exp_bits, x_man_bits, x_bias);
+    APyFloat y(y_exp_bits, y_man_bits, y_bias);
+    for (std::size_t i = 0; i < x_count; i++) {
+        x.set_data(unpack_float_data(i, x_exp_bits, x_man_bits));
+        for (std::size_t j = 0; j < y_count; j++) {
+            y.set_data(unpack_float_data(j, y_exp_bits, y_man_bits));
+            const APyFloat res = x + y;
+            assert(res.get_exp_bits() == res_exp_bits);
+            assert(res.get_man_bits() == res_man_bits);
+            assert(res.get_bias() == res_bias);
+            set_result(i, j, res.get_data());
+        }
+    }
+}
+
+std::shared_ptr<const FloatOpTable> FloatOpTable::get(
+    FloatTableOp op,
+    std::uint8_t x_exp_bits,
+    std::uint8_t x_man_bits,
+    exp_t x_bias,
+    std::uint8_t y_exp_bits,
+    std::uint8_t y_man_bits,
+    exp_t y_bias,
+    std::uint8_t res_exp_bits,
+    std::uint8_t res_man_bits,
+    exp_t res_bias,
+    QuantizationMode quantization
+)
+{
+    using key_type = std::tuple<
+        FloatTableOp,
+        std::uint8_t,
+        std::uint8_t,
+        exp_t,
+        std::uint8_t,
+        std::uint8_t,
+        exp_t,
+        std::uint8_t,
+        std::uint8_t,
+        exp_t,
+        QuantizationMode>;
+    struct cache_entry {
+        std::shared_ptr<const FloatOpTable> table;
+        std::uint64_t last_use; // Value of `use_counter` at the last lookup
+    };
+    static std::mutex cache_mutex;
+    static std::map<key_type, cache_entry> cache;
+    static std::uint64_t use_counter = 0;
+
+    const key_type key = std::make_tuple(
+        op,
+        x_exp_bits,
+        x_man_bits,
+        x_bias,
+        y_exp_bits,
+        y_man_bits,
+        y_bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        quantization
+    );
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (auto it = cache.find(key); it != cache.end()) {
+            it->second.last_use = ++use_counter;
+            return it->second.table;
+        }
+    }
+
+    // The table is built without holding the lock. If another thread built the same
+    // table meanwhile, that table is used instead.
+    std::shared_ptr<const FloatOpTable> table(new FloatOpTable(
+        op,
+        x_exp_bits,
+        x_man_bits,
+        x_bias,
+        y_exp_bits,
+        y_man_bits,
+        y_bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        quantization
+    ));
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (auto it = cache.find(key); it != cache.end()) {
+        it->second.last_use = ++use_counter;
+        return it->second.table;
+    }
+    if (cache.size() >= _FLOAT_TABLE_CACHE_SIZE) {
+        // Evict the least recently used table. Tables still in use are kept alive by
+        // their users.
+        cache.erase(std::min_element(
+            cache.begin(),
+            cache.end(),
+            [](const auto& a, const auto& b) {
+                return a.second.last_use < b.second.last_use;
+            }
+        ));
+    }
+    cache.emplace(key, cache_entry { table, ++use_counter });
+    return table;
+}
+
+void FloatOpTable::operator()(
+    const APyFloatData* x, const APyFloatData* y, APyFloatData* dst, std::size_t n
+) const
+{
+    for (std::size_t i = 0; i < n; i++) {
+        dst[i] = (*this)(x[i], y[i]);
+    }
+}
+
+/* ********************************************************************************** *
+ * *                         Fused floating-point inner product                     * *
+ * ********************************************************************************** */
+
+FloatDotKernel::FloatDotKernel(
+    std::uint8_t x_exp_bits,
+    std::uint8_t x_man_bits,
+    exp_t x_bias,
+    std::uint8_t y_exp_bits,
+    std::uint8_t y_man_bits,
+    exp_t y_bias,
+    std::uint8_t res_exp_bits,
+    std::uint8_t res_man_bits,
+    exp_t res_bias,
+    QuantizationMode quantization,
+    std::size_t n_products,
+    bool quantize_operands
+)
+    : product(
+          quantize_operands ? res_exp_bits : x_exp_bits,
+          quantize_operands ? res_man_bits : x_man_bits,
+          quantize_operands ? res_bias : x_bias,
+          quantize_operands ? res_exp_bits : y_exp_bits,
+          quantize_operands ? res_man_bits : y_man_bits,
+          quantize_operands ? res_bias : y_bias,
+          res_exp_bits,
+          res_man_bits,
+          res_bias,
+          quantization
+      )
+    , sum(res_exp_bits, res_man_bits, quantization)
+    , simd_constants(product.simd_constants())
+    , quantization { quantization }
+{
+    if (quantize_operands) {
+        // Operands of other formats are quantized to the result format
+        if (x_exp_bits != res_exp_bits || x_man_bits != res_man_bits
+            || x_bias != res_bias) {
+            x_cast.emplace(
+                x_exp_bits, x_man_bits, x_bias, res_exp_bits, res_man_bits, res_bias
+            );
+        }
+        if (y_exp_bits != res_exp_bits || y_man_bits != res_man_bits
+            || y_bias != res_bias) {
+            y_cast.emplace(
+                y_exp_bits, y_man_bits, y_bias, res_exp_bits, res_man_bits, res_bias
+            );
+        }
+
+        // The products are of the quantized operands
+        x_exp_bits = y_exp_bits = res_exp_bits;
+        x_man_bits = y_man_bits = res_man_bits;
+        x_bias = y_bias = res_bias;
+    }
+    assert(is_applicable(x_man_bits, y_man_bits, res_man_bits, quantization));
+
+    // Native floating-point arithmetic gives the same products if both operands and
+    // the result are of the same standard format
+    native_format = native_float_format(x_exp_bits, x_man_bits, x_bias);
+    if (quantization != QuantizationMode::RND_CONV
+        || native_format != native_float_format(y_exp_bits, y_man_bits, y_bias)
+        || native_format != native_float_format(res_exp_bits, res_man_bits, res_bias)) {
+        native_format = NativeFloatFormat::NONE;
+    }
+
+    // Products of small formats are looked up in a table
+    if (FloatOpTable::is_applicable(
+            x_exp_bits,
+            x_man_bits,
+            y_exp_bits,
+            y_man_bits,
+            res_exp_bits,
+            res_man_bits,
+            quantization,
+            n_products
+        )) {
+        product_table = FloatOpTable::get(
+            FloatTableOp::MUL,
+            x_exp_bits,
+            x_man_bits,
+            x_bias,
+            y_exp_bits,
+            y_man_bits,
+            y_bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        );
+    }
+}
+
+bool FloatDotKernel::is_applicable(
+    int x_man_bits, int y_man_bits, int res_man_bits, QuantizationMode quantization
+)
+{
+    return simd::float_quantization_is_vectorizable(quantization)
+        && FloatProductKernel::is_applicable(x_man_bits, y_man_bits)
+        && FloatSumKernel::is_applicable(res_man_bits, quantization);
+}
+
+APyFloatData FloatDotKernel::operator()(
+    const APyFloatData* x, const APyFloatData* y, std::size_t n, simd::FloatTile& tile
+) const
+{
+    FloatSumKernel acc = sum;
+    acc.reset();
+
+    APyFloatData products[simd::_FLOAT_TILE_SIZE];
+    APyFloatData x_operands[simd::_FLOAT_TILE_SIZE], y_operands[simd::_FLOAT_TILE_SIZE];
+    for (std::size_t begin = 0; begin < n && !acc.is_nan();
+         begin += simd::_FLOAT_TILE_SIZE) {
+        const std::size_t size = std::min(simd::_FLOAT_TILE_SIZE, n - begin);
+        const APyFloatData* x_tile = x + begin;
+        const APyFloatData* y_tile = y + begin;
+
+        // Operands quantized to the result format
+        if (x_cast || y_cast) {
+            with_cast_quantization(quantization, [&](auto q) {
+                if (x_cast) {
+                    float_cast_block<decltype(q)::value>(
+                        x_tile, x_operands, size, *x_cast
+                    );
+                }
+                if (y_cast) {
+                    float_cast_block<decltype(q)::value>(
+                        y_tile, y_operands, size, *y_cast
+                    );
+                }
+            });
+            x_tile = x_cast ? x_operands : x_tile;
+            y_tile = y_cast ? y_operands : y_tile;
+        }
+
+        // Quantized products of the tile
+        if (product_table) {
+            (*product_table)(x_tile, y_tile, products, size);
+        } else if (native_format != NativeFloatFormat::NONE) {
+            native_float_binary_op(
+                native_format,
+                x_tile,
+                y_tile,
+                products,
+                size,
+                std::multiplies<>(),
+                [&](std::size_t i) { products[i] = product(x_tile[i], y_tile[i]); }
+            );
+        } else {
+            tile.load(x_tile, y_tile, size);
+            simd::vector_float_mul(tile, size, simd_constants);
+            for (std::size_t i = 0; i < size; i++) {
+                products[i] = tile.fixup[i] ? product(x_tile[i], y_tile[i])
+                                            : tile.result(i);
+            }
+        }
+
+        // Sequential accumulation
+        for (std::size_t i = 0; i < size; i++) {
+            acc.add(products[i]);
+        }
+    }
+    return acc.get();
+}
+
+/* ********************************************************************************** *
+ * *                          Exact floating-point inner product                    * *
+ * ********************************************************************************** */
+
+//! Number of limbs spanned by a `man_t` shifted less than one limb to the left
+static constexpr std::size_t _EXACT_TERM_LIMBS = _MAN_T_SIZE_BITS / _LIMB_SIZE_BITS + 1;
+
+//! Add (or subtract, if `negative`) `value * 2^shift` to the accumulator `acc`
+static APY_INLINE void exact_accumulate(
+    std::vector<mp_limb_t>& acc, man_t value, std::size_t shift, bool negative
+)
+{
+    const std::size_t limb_idx = shift / _LIMB_SIZE_BITS;
+    const unsigned limb_shift = shift % _LIMB_SIZE_BITS;
+    const man_t lo = value << limb_shift;
+    const man_t hi = limb_shift ? value >> (_MAN_T_SIZE_BITS - limb_shift) : 0;
+
+    mp_limb_t carry = 0; // Carry, or borrow if `negative`
+    for (std::size_t i = 0; i < _EXACT_TERM_LIMBS; i++) {
+        const std::size_t bit = i * _LIMB_SIZE_BITS;
+        const mp_limb_t term = mp_limb_t(
+            bit < _MAN_T_SIZE_BITS
+                ? (lo >> bit) | (bit ? hi << (_MAN_T_SIZE_BITS - bit) : 0)
+                : hi >> (bit - _MAN_T_SIZE_BITS)
+        );
+        mp_limb_t& limb = acc[limb_idx + i];
+        if (negative) {
+            const mp_limb_t diff = limb - term;
+            const mp_limb_t res = diff - carry;
+            carry = mp_limb_t(limb < term) | mp_limb_t(diff < carry);
+            limb = res;
+        } else {
+            const mp_limb_t sum = limb + term;
+            const mp_limb_t res = sum + carry;
+            carry = mp_limb_t(sum < term) | mp_limb_t(res < sum);
+            limb = res;
+        }
+    }
+
+    // Propagate the carry (borrow), which rarely reaches beyond a few limbs
+    for (std::size_t i = limb_idx + _EXACT_TERM_LIMBS; carry && i < acc.size(); i++) {
+        carry = negative ? acc[i]-- == 0 : ++acc[i] == 0;
+    }
+}
+
+//! Retrieve the `width` bits starting at bit `lo` of the limb vector `limbs`. Bits
+//! outside of the limb vector are zero.
+static man_t
+exact_extract_bits(const std::vector<mp_limb_t>& limbs, std::int64_t lo, unsigned width)
+{
+    const std::int64_t limb_bits = _LIMB_SIZE_BITS;
+    std::int64_t limb_idx = (lo >= 0 ? lo : lo - limb_bits + 1) / limb_bits;
+    const int offset = int(lo - limb_idx * limb_bits);
+
+    man_t res = 0;
+    for (std::size_t i = 0; i < _EXACT_TERM_LIMBS; i++, limb_idx++) {
+        if (limb_idx < 0 || limb_idx >= std::int64_t(limbs.size())) {
+            continue;
+        }
+        const man_t limb = limbs[limb_idx];
+        const int shift = int(i * _LIMB_SIZE_BITS) - offset;
+        if (shift < 0) {
+            res |= limb >> -shift;
+        } else if (shift < int(_MAN_T_SIZE_BITS)) {
+            res |= limb << shift;
+        }
+    }
+    return width < _MAN_T_SIZE_BITS ? res & ((man_t(1) << width) - 1) : res;
+}
+
+FloatExactDotKernel::FloatExactDotKernel(
+    std::uint8_t x_exp_bits,
+    std::uint8_t x_man_bits,
+    exp_t x_bias,
+    std::uint8_t y_exp_bits,
+    std::uint8_t y_man_bits,
+    exp_t y_bias,
+    std::uint8_t res_exp_bits,
+    std::uint8_t res_man_bits,
+    exp_t res_bias,
+    QuantizationMode quantization
+)
+    : x_man_bits { x_man_bits }
+    , y_man_bits { y_man_bits }
+    , res_man_bits { res_man_bits }
+    , x_max_exponent { exp_t((1ULL << x_exp_bits) - 1) }
+    , y_max_exponent { exp_t((1ULL << y_exp_bits) - 1) }
+    , res_max_exponent { exp_t((1ULL << res_exp_bits) - 1) }
+    , res_bias { res_bias }
+    , lsb_exp { 2 - std::int64_t(x_bias) - std::int64_t(y_bias) - x_man_bits
+                - y_man_bits }
+    , quantization { quantization }
+{
+    assert(is_applicable(x_exp_bits, x_man_bits, y_exp_bits, y_man_bits));
+
+    // A product of finite operands with biased exponents `ex` and `ey` (one for
+    // subnormals) is placed `ex + ey - 2` bits up in the accumulator. Room is left
+    // for the carries of 2^63 terms and the sign.
+    const std::size_t max_shift = std::size_t(std::max(x_max_exponent, exp_t(2)) - 2)
+        + std::size_t(std::max(y_max_exponent, exp_t(2)) - 2);
+    const std::size_t product_bits = x_man_bits + y_man_bits + 2;
+    acc_limbs = bits_to_limbs(max_shift + product_bits + 64) + _EXACT_TERM_LIMBS;
+}
+
+bool FloatExactDotKernel::is_applicable(
+    int x_exp_bits, int x_man_bits, int y_exp_bits, int y_man_bits
+)
+{
+    return x_exp_bits <= _EXACT_DOT_MAX_EXP_BITS
+        && y_exp_bits <= _EXACT_DOT_MAX_EXP_BITS
+        && FloatProductKernel::is_applicable(x_man_bits, y_man_bits);
+}
+
+APyFloatData FloatExactDotKernel::operator()(
+    const APyFloatData* x,
+    const APyFloatData* y,
+    std::size_t n,
+    std::vector<mp_limb_t>& acc
+) const
+{
+    acc.assign(acc_limbs, 0);
+    bool is_pos_inf = false, is_neg_inf = false;
+    for (std::size_t i = 0; i < n; i++) {
+        const bool sign = x[i].sign ^ y[i].sign;
+        const bool x_is_maxexp = x[i].exp == x_max_exponent;
+        const bool y_is_maxexp = y[i].exp == y_max_exponent;
+        if (x_is_maxexp || y_is_maxexp) {
+            const bool x_is_zero = x[i].exp == 0 && x[i].man == 0;
+            const bool y_is_zero = y[i].exp == 0 && y[i].man == 0;
+            if ((x_is_maxexp && (x[i].man != 0 || y_is_zero))
+                || (y_is_maxexp && (y[i].man != 0 || x_is_zero))) {
+                // NaN, or infinity times zero
+                return { false, res_max_exponent, man_t(1) };
+            }
+            (sign ? is_neg_inf : is_pos_inf) = true;
+            continue;
+        }
+
+        const man_t mx = (man_t(x[i].exp != 0) << x_man_bits) | x[i].man;
+        const man_t my = (man_t(y[i].exp != 0) << y_man_bits) | y[i].man;
+        const std::size_t shift = std::size_t(std::max(x[i].exp, exp_t(1)) - 1)
+            + std::size_t(std::max(y[i].exp, exp_t(1)) - 1);
+        if (const man_t product = mx * my) {
+            exact_accumulate(acc, product, shift, sign);
+        }
+    }
+
+    if (is_pos_inf && is_neg_inf) {
+        return { false, res_max_exponent, man_t(1) };
+    }
+    if (is_pos_inf || is_neg_inf) {
+        return { is_neg_inf, res_max_exponent, man_t(0) };
+    }
+    return quantize(acc);
+}
+
+APyFloatData FloatExactDotKernel::quantize(std::vector<mp_limb_t>& acc) const
+{
+    const bool sign = limb_vector_abs(acc.cbegin(), acc.cend(), acc.begin());
+
+    // Most significant set bit of the accumulator
+    std::size_t limbs = acc.size();
+    while (limbs && acc[limbs - 1] == 0) {
+        limbs--;
+    }
+    if (!limbs) {
+        return { false, exp_t(0), man_t(0) };
+    }
+    const std::int64_t msb = std::int64_t(
+        (limbs - 1) * _LIMB_SIZE_BITS + bit_width(acc[limbs - 1]) - 1
+    );
+
+    // Biased exponent and accumulator bit of the least significant mantissa bit. The
+    // mantissa of a subnormal result has a fixed position.
+    const std::int64_t exp = msb + lsb_exp + std::int64_t(res_bias);
+    const std::int64_t lsb = exp > 0
+        ? msb - res_man_bits
+        : 1 - std::int64_t(res_bias) - res_man_bits - lsb_exp;
+
+    // The mantissa, without the leading one, is quantized from a `man_t` with as many
+    // bits below it as fit, and with the bits further below or-ed into its LSB
+    const unsigned bits_to_quantize
+        = std::min(_MAN_T_SIZE_BITS - res_man_bits, _MAN_T_SIZE_BITS - 1);
+    const std::int64_t lo = lsb - bits_to_quantize;
+    man_t man = exact_extract_bits(acc, lo, res_man_bits + bits_to_quantize);
+    if (lo > 0) {
+        const std::size_t sticky_bits
+            = std::min(std::uint64_t(lo), std::uint64_t(acc.size() * _LIMB_SIZE_BITS));
+        man |= limb_vector_or_reduce(acc.cbegin(), acc.cend(), sticky_bits);
+    }
+
+    exp_t new_exp
+        = exp_t(std::clamp(exp, std::int64_t(0), std::int64_t(res_max_exponent)));
+    quantize_mantissa(
+        man,
+        new_exp,
+        res_max_exponent,
+        bits_to_quantize,
+        sign,
+        man_t(1) << res_man_bits,
+        quantization
+    );
+    return { sign, new_exp, man };
+}
@@ -5,6 +5,18 @@
 #include "apyfixed_util.h"
 #include "apyfloat.h"
 #include "apytypes_common.h"
+#include "apytypes_simd.h"
+#include "ieee754.h"
+
+#include <algorithm>   // std::min
+#include <cassert>     // assert
+#include <cmath>       // std::isnan, std::fpclassify
+#include <cstdint>     // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <memory>      // std::shared_ptr
+#include <optional>    // std::optional
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::swap
+#include <vector>      // std::vector
 
 /*!
  * Sizes of APyFloat datatypes
@@ -53,29 +65,234 @@ exp_t calc_bias_general(
     int new_exp_bits, int exp_bits1, exp_t bias1, int exp_bits2, exp_t bias2
 );
 
-//! Quantize mantissa
-APY_INLINE void quantize_mantissa(
-    man_t& man,
+/* ********************************************************************************** *
+ * *                         Two-word mantissa arithmetic                           * *
+ * ********************************************************************************** */
+
+/*!
+ * Unsigned two-word (128-bit) integer. Holds the intermediate mantissas of
+ * floating-point operations that do not fit in a single `man_t`, e.g., the product of
+ * two 52-bit mantissas with leading ones, or a quotient with guard bits. Only the
+ * operations needed by the floating-point kernels are provided, none of which
+ * allocate.
+ */
+struct man2_t {
+    std::uint64_t hi, lo;
+
+    constexpr man2_t() noexcept
+        : hi { 0 }
+        , lo { 0 }
+    {
+    }
+
+    constexpr man2_t(std::uint64_t value) noexcept
+        : hi { 0 }
+        , lo { value }
+    {
+    }
+
+    constexpr man2_t(std::uint64_t high, std::uint64_t low) noexcept
+        : hi { high }
+        , lo { low }
+    {
+    }
+
+    //! Least significant word
+    explicit constexpr operator std::uint64_t() const noexcept { return lo; }
+
+    //! Test if non-zero
+    explicit constexpr operator bool() const noexcept { return hi | lo; }
+};
+
+//! Full product of two words
+APY_INLINE man2_t multiply_words(std::uint64_t a, std::uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = (unsigned __int128)a * b;
+    return { std::uint64_t(product >> 64), std::uint64_t(product) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    const std::uint64_t low = _umul128(a, b, &high);
+    return { high, low };
+#else
+    // Schoolbook multiplication of the 32-bit halves
+    const std::uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t mid = (lo_lo >> 32) + (a_hi * b_lo & 0xFFFFFFFF) + a_lo * b_hi;
+    return { a_hi * b_hi + (a_hi * b_lo >> 32) + (mid >> 32),
+             (mid << 32) | (lo_lo & 0xFFFFFFFF) };
+#endif
+}
+
+//! Quotient and remainder of the two-word integer `high:low` divided by `den`. Only
+//! valid if `high < den < 2^63`, so that the quotient fits in a single word.
+APY_INLINE std::uint64_t divide_words(
+    std::uint64_t high, std::uint64_t low, std::uint64_t den, std::uint64_t& rem
+)
+{
+    assert(high < den && den >> 63 == 0);
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 num = ((unsigned __int128)high << 64) | low;
+    rem = std::uint64_t(num % den);
+    return std::uint64_t(num / den);
+#else
+    // Restoring division, one quotient bit at a time
+    std::uint64_t quotient = 0;
+    for (int i = 63; i >= 0; i--) {
+        high = (high << 1) | ((low >> i) & 1);
+        quotient <<= 1;
+        if (high >= den) {
+            high -= den;
+            quotient |= 1;
+        }
+    }
+    rem = high;
+    return quotient;
+#endif
+}
+
+APY_INLINE constexpr man2_t operator|(man2_t a, man2_t b)
+{
+    return { a.hi | b.hi, a.lo | b.lo };
+}
+
+APY_INLINE constexpr man2_t operator&(man2_t a, man2_t b)
+{
+    return { a.hi & b.hi, a.lo & b.lo };
+}
+
+APY_INLINE constexpr man2_t operator^(man2_t a, man2_t b)
+{
+    return { a.hi ^ b.hi, a.lo ^ b.lo };
+}
+
+APY_INLINE constexpr man2_t operator~(man2_t a) { return { ~a.hi, ~a.lo }; }
+
+APY_INLINE constexpr man2_t operator+(man2_t a, man2_t b)
+{
+    const std::uint64_t lo = a.lo + b.lo;
+    return { a.hi + b.hi + (lo < a.lo), lo };
+}
+
+APY_INLINE constexpr man2_t operator-(man2_t a, man2_t b)
+{
+    return { a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo };
+}
+
+//! Product modulo 2^128
+APY_INLINE man2_t operator*(man2_t a, man2_t b)
+{
+    man2_t product = multiply_words(a.lo, b.lo);
+    product.hi += a.hi * b.lo + a.lo * b.hi;
+    return product;
+}
+
+APY_INLINE constexpr man2_t operator<<(man2_t a, unsigned shift)
+{
+    if (shift == 0) {
+        return a;
+    } else if (shift < 64) {
+        return { (a.hi << shift) | (a.lo >> (64 - shift)), a.lo << shift };
+    } else if (shift < 128) {
+        return { a.lo << (shift - 64), 0 };
+    }
+    return {};
+}
+
+APY_INLINE constexpr man2_t operator>>(man2_t a, unsigned shift)
+{
+    if (shift == 0) {
+        return a;
+    } else if (shift < 64) {
+        return { a.hi >> shift, (a.lo >> shift) | (a.hi << (64 - shift)) };
+    } else if (shift < 128) {
+        return { 0, a.hi >> (shift - 64) };
+    }
+    return {};
+}
+
+APY_INLINE constexpr bool operator==(man2_t a, man2_t b)
+{
+    return a.hi == b.hi && a.lo == b.lo;
+}
+
+APY_INLINE constexpr bool operator!=(man2_t a, man2_t b) { return !(a == b); }
+
+APY_INLINE constexpr bool operator<(man2_t a, man2_t b)
+{
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+APY_INLINE constexpr man2_t& operator|=(man2_t& a, man2_t b) { return a = a | b; }
+APY_INLINE constexpr man2_t& operator&=(man2_t& a, man2_t b) { return a = a & b; }
+APY_INLINE constexpr man2_t& operator+=(man2_t& a, man2_t b) { return a = a + b; }
+APY_INLINE constexpr man2_t& operator<<=(man2_t& a, unsigned s) { return a = a << s; }
+APY_INLINE constexpr man2_t& operator>>=(man2_t& a, unsigned s) { return a = a >> s; }
+
+//! Compute the number of leading zeros in a two-word integer
+[[maybe_unused, nodiscard]] APY_INLINE std::size_t leading_zeros(man2_t n)
+{
+    return n.hi ? leading_zeros(n.hi) : 64 + leading_zeros(n.lo);
+}
+
+//! Compute bit-width (`ceil(log2(1 + n))`) of a two-word integer `n`
+[[maybe_unused, nodiscard]] APY_INLINE std::size_t bit_width(man2_t n)
+{
+    return 128 - leading_zeros(n);
+}
+
+//! Right-shift `n`, or-ing all bits shifted out into the least significant bit
+template <typename MAN> APY_INLINE MAN shift_right_sticky(MAN n, unsigned shift)
+{
+    constexpr unsigned MAN_BITS = 8 * sizeof(MAN);
+    if (shift == 0) {
+        return n;
+    } else if (shift >= MAN_BITS) {
+        return MAN(n != 0);
+    }
+    return (n >> shift) | MAN((n << (MAN_BITS - shift)) != 0);
+}
+
+//! Random bits for the stochastic quantization of a `man_t` or `man2_t` mantissa
+template <typename MAN> APY_INLINE MAN random_mantissa()
+{
+    if constexpr (std::is_same_v<MAN, man2_t>) {
+        const std::uint64_t high = random_number_float();
+        return man2_t(high, random_number_float());
+    } else {
+        return random_number_float();
+    }
+}
+
+/* ********************************************************************************** *
+ * *                             Mantissa quantization                              * *
+ * ********************************************************************************** */
+
+//! Quantize mantissa of type `man_t` or `man2_t`. Use `quantize_mantissa`.
+template <typename MAN>
+APY_INLINE void _quantize_mantissa(
+    MAN& man,
     exp_t& exp,
     exp_t max_exp,
     std::uint8_t bits_to_quantize,
     bool sign,
-    man_t man_msb_constant,
+    MAN man_msb_constant,
     std::uint8_t bits_to_quantize_dec,
-    man_t sticky_constant,
+    MAN sticky_constant,
     QuantizationMode quantization
 )
 {
     // Calculate quantization bit
-    man_t G, // Guard (bit after LSB)
-        T,   // Sticky bit, logical OR of all the bits after the guard bit
-        B;   // Quantization bit to add to LSB
+    MAN G, // Guard (bit after LSB)
+        T, // Sticky bit, logical OR of all the bits after the guard bit
+        B; // Quantization bit to add to LSB
 
     G = (man >> bits_to_quantize_dec) & 1;
     T = (man & sticky_constant) != 0;
 
     // Initial value for mantissa
-    man_t res_man = man >> bits_to_quantize;
+    MAN res_man = man >> bits_to_quantize;
 
     switch (quantization) {
     case QuantizationMode::RND_CONV: // TIES_EVEN
@@ -125,8 +342,9 @@ APY_INLINE void quantize_mantissa(
         }
         break;
     case QuantizationMode::STOCH_WEIGHTED: {
-        const man_t trailing_bits = man & ((1ULL << bits_to_quantize) - 1);
-        const man_t weight = random_number_float() & ((1ULL << bits_to_quantize) - 1);
+        const MAN trailing_mask = (MAN(1) << bits_to_quantize) - 1;
+        const MAN trailing_bits = man & trailing_mask;
+        const MAN weight = random_mantissa<MAN>() & trailing_mask;
         // Since the weight won't be greater than the discarded bits,
         // this will never round an already exact number.
         B = (trailing_bits + weight) >> bits_to_quantize;
@@ -161,6 +379,58 @@ APY_INLINE void quantize_mantissa(
     }
 }
 
+//! Quantize mantissa
+APY_INLINE void quantize_mantissa(
+    man_t& man,
+    exp_t& exp,
+    exp_t max_exp,
+    std::uint8_t bits_to_quantize,
+    bool sign,
+    man_t man_msb_constant,
+    std::uint8_t bits_to_quantize_dec,
+    man_t sticky_constant,
+    QuantizationMode quantization
+)
+{
+    _quantize_mantissa<man_t>(
+        man,
+        exp,
+        max_exp,
+        bits_to_quantize,
+        sign,
+        man_msb_constant,
+        bits_to_quantize_dec,
+        sticky_constant,
+        quantization
+    );
+}
+
+//! Quantize two-word mantissa
+APY_INLINE void quantize_mantissa(
+    man2_t& man,
+    exp_t& exp,
+    exp_t max_exp,
+    std::uint8_t bits_to_quantize,
+    bool sign,
+    man2_t man_msb_constant,
+    std::uint8_t bits_to_quantize_dec,
+    man2_t sticky_constant,
+    QuantizationMode quantization
+)
+{
+    _quantize_mantissa<man2_t>(
+        man,
+        exp,
+        max_exp,
+        bits_to_quantize,
+        sign,
+        man_msb_constant,
+        bits_to_quantize_dec,
+        sticky_constant,
+        quantization
+    );
+}
+
 //! Quantize mantissa
 APY_INLINE void quantize_mantissa(
     man_t& man,
@@ -210,6 +480,9 @@ quantize_close_to_zero(bool sign, man_t man, QuantizationMode quantization)
 //! Fast integer power by squaring.
 man_t ipow(man_t base, unsigned int n);
 
+//! Fast integer power by squaring, modulo 2^128.
+man2_t ipow(man2_t base, unsigned int n);
+
 //! Get the number of left shifts needed to make fx>=1.0
 APY_INLINE unsigned int leading_zeros_apyfixed(const APyFixed& fx)
 {
@@ -337,75 +610,463 @@ normalize(const APyFloatData& src, const APYFLOAT_TYPE& ref)
 }
 
 /* ********************************************************************************** *
- * *             Floating-point iterator-based arithmetic functions                 * *
+ * *                                  Array casting                                 * *
  * ********************************************************************************** */
 
-//! Iterator-based floating-point product
-template <
-    typename RANDOM_ACCESS_ITERATOR_IN,
-    typename RANDOM_ACCESS_ITERATOR_INOUT,
-    typename APYFLOAT_TYPE>
-void float_product(
-    RANDOM_ACCESS_ITERATOR_IN src1,
-    RANDOM_ACCESS_ITERATOR_IN src2,
-    RANDOM_ACCESS_ITERATOR_INOUT dst,
-    const APYFLOAT_TYPE& x, // Floating point src1
-    const APYFLOAT_TYPE& y  // Floating point src2
+//! Format constants of a floating-point cast, computed once per array
+struct FloatCastConstants {
+    std::uint8_t man_bits, new_man_bits;
+    exp_t max_exp, new_max_exp;
+    std::int64_t bias_delta;     // `new_bias - bias`
+    man_t leading_one, new_leading_one;
+    int man_bits_delta;          // `man_bits - new_man_bits`
+    std::uint8_t bits_dec;       // `man_bits_delta - 1`, if positive
+    man_t sticky_constant;       // Sticky-bit mask, if `man_bits_delta` is positive
+
+    FloatCastConstants(
+        std::uint8_t exp_bits,
+        std::uint8_t src_man_bits,
+        exp_t bias,
+        std::uint8_t new_exp_bits,
+        std::uint8_t dst_man_bits,
+        exp_t new_bias
+    )
+        : man_bits { src_man_bits }
+        , new_man_bits { dst_man_bits }
+        , max_exp { exp_t((1ULL << exp_bits) - 1) }
+        , new_max_exp { exp_t((1ULL << new_exp_bits) - 1) }
+        , bias_delta { std::int64_t(new_bias) - std::int64_t(bias) }
+        , leading_one { man_t(1) << src_man_bits }
+        , new_leading_one { man_t(1) << dst_man_bits }
+        , man_bits_delta { int(src_man_bits) - int(dst_man_bits) }
+        , bits_dec { std::uint8_t(man_bits_delta > 0 ? man_bits_delta - 1 : 0) }
+        , sticky_constant { man_bits_delta > 0 ? (man_t(1) << bits_dec) - 1 : 0 }
+    {
+    }
+
+    //! Constants of the vectorized narrowing cast, requires `man_bits_delta > 0`
+    simd::FloatCastConstants simd_constants(QuantizationMode quantization) const
+    {
+        return { max_exp,
+                 new_max_exp,
+                 bias_delta,
+                 new_man_bits,
+                 std::uint8_t(man_bits_delta),
+                 quantization };
+    }
+};
+
+/*!
+ * Cast the `n` floating-point numbers in `src`, of format `exp_bits`, `man_bits`, and
+ * `bias`, to the format `new_exp_bits`, `new_man_bits`, and `new_bias` and store the
+ * result in `dst`. Same result as `APyFloat::_checked_cast` of each element, but the
+ * format constants are computed once for all elements and the loop is specialized on
+ * the quantization mode. Narrowing casts with a deterministic quantization mode are
+ * vectorized, and all but the stochastic modes are distributed over threads.
+ */
+void float_cast(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    std::uint8_t new_exp_bits,
+    std::uint8_t new_man_bits,
+    exp_t new_bias,
+    QuantizationMode quantization
+);
+
+//! Cast the `n` floating-point numbers in `src` to a format with at least as many
+//! exponent and mantissa bits, distributed over threads. Same result as
+//! `APyFloat::cast_no_quant` of each element.
+void float_cast_no_quant(
+    const APyFloatData* src,
+    APyFloatData* dst,
+    std::size_t n,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    std::uint8_t new_exp_bits,
+    std::uint8_t new_man_bits,
+    exp_t new_bias
+);
+
+/* ********************************************************************************** *
+ * *                      Packed floating-point bit patterns                        * *
+ * ********************************************************************************** */
+
+//! Pack `src` into the IEEE-style bit pattern `[sign | exp | man]`. Requires
+//! `1 + exp_bits + man_bits` to fit in `T`.
+template <typename T>
+[[maybe_unused]] static APY_INLINE T
+pack_float_data(const APyFloatData& src, std::uint8_t exp_bits, std::uint8_t man_bits)
+{
+    const T sign = T(src.sign) << (exp_bits + man_bits);
+    return T(sign | (T(src.exp) << man_bits) | src.man);
+}
+
+//! Unpack the IEEE-style bit pattern `[sign | exp | man]` in `src`
+template <typename T>
+[[maybe_unused]] static APY_INLINE APyFloatData
+unpack_float_data(T src, std::uint8_t exp_bits, std::uint8_t man_bits)
+{
+    const std::uint64_t bits = src;
+    return { bool((bits >> (exp_bits + man_bits)) & 1),
+             exp_t((bits >> man_bits) & ((std::uint64_t(1) << exp_bits) - 1)),
+             man_t(bits & ((std::uint64_t(1) << man_bits) - 1)) };
+}
+
+/* ********************************************************************************** *
+ * *                            Native IEEE-754 formats                             * *
+ * ********************************************************************************** */
+
+//! Floating-point formats that can be computed with native hardware floating-point
+//! arithmetic. Binary16 and bfloat16 are computed with `float`, which is correctly
+//! rounded as the precision of `float` is at least twice that of the formats plus two.
+enum class NativeFloatFormat { NONE, BINARY16, BFLOAT16, BINARY32, BINARY64 };
+
+//! Retrieve the native format with `exp_bits`, `man_bits`, and `bias`, if any
+[[maybe_unused]] static APY_INLINE NativeFloatFormat
+native_float_format(std::uint8_t exp_bits, std::uint8_t man_bits, exp_t bias)
+{
+    if (exp_bits == 5 && man_bits == 10 && bias == 15) {
+        return NativeFloatFormat::BINARY16;
+    } else if (exp_bits == 8 && man_bits == 7 && bias == 127) {
+        return NativeFloatFormat::BFLOAT16;
+    } else if (exp_bits == 8 && man_bits == 23 && bias == 127) {
+        return NativeFloatFormat::BINARY32;
+    } else if (exp_bits == 11 && man_bits == 52 && bias == 1023) {
+        return NativeFloatFormat::BINARY64;
+    } else {
+        return NativeFloatFormat::NONE;
+    }
+}
+
+//! Codec between `APyFloatData` and the native type `type` used to compute a native
+//! format. Results for which `needs_fixup` is true must be computed by APyTypes.
+template <NativeFloatFormat FORMAT> struct NativeFloatCodec;
+
+template <> struct NativeFloatCodec<NativeFloatFormat::BINARY16> {
+    using type = float;
+    static APY_INLINE float decode(const APyFloatData& x)
+    {
+        return binary16_to_float(pack_float_data<std::uint16_t>(x, 5, 10));
+    }
+    static APY_INLINE APyFloatData encode(float x)
+    {
+        return unpack_float_data(float_to_binary16(x), 5, 10);
+    }
+    static APY_INLINE bool needs_fixup(float x) { return std::isnan(x); }
+};
+
+template <> struct NativeFloatCodec<NativeFloatFormat::BFLOAT16> {
+    using type = float;
+    static APY_INLINE float decode(const APyFloatData& x)
+    {
+        return bfloat16_to_float(pack_float_data<std::uint16_t>(x, 8, 7));
+    }
+    static APY_INLINE APyFloatData encode(float x)
+    {
+        return unpack_float_data(float_to_bfloat16(x), 8, 7);
+    }
+    //! Bfloat16 has the exponent range of `float`, so subnormal results have already
+    //! been rounded once by the hardware
+    static APY_INLINE bool needs_fixup(float x)
+    {
+        return std::isnan(x) || std::fpclassify(x) == FP_SUBNORMAL;
+    }
+};
+
+template <> struct NativeFloatCodec<NativeFloatFormat::BINARY32> {
+    using type = float;
+    static APY_INLINE float decode(const APyFloatData& x)
+    {
+        return type_pun_uint32_t_to_float(pack_float_data<std::uint32_t>(x, 8, 23));
+    }
+    static APY_INLINE APyFloatData encode(float x)
+    {
+        return unpack_float_data(type_pun_float_to_uint32_t(x), 8, 23);
+    }
+    static APY_INLINE bool needs_fixup(float x) { return std::isnan(x); }
+};
+
+template <> struct NativeFloatCodec<NativeFloatFormat::BINARY64> {
+    using type = double;
+    static APY_INLINE double decode(const APyFloatData& x)
+    {
+        return type_pun_uint64_t_to_double(pack_float_data<std::uint64_t>(x, 11, 52));
+    }
+    static APY_INLINE APyFloatData encode(double x)
+    {
+        return unpack_float_data(type_pun_double_to_uint64_t(x), 11, 52);
+    }
+    static APY_INLINE bool needs_fixup(double x) { return std::isnan(x); }
+};
+
+//! Number of elements decoded at a time by `native_float_binary_op`
+constexpr std::size_t _NATIVE_FLOAT_TILE_SIZE = 256;
+
+//! Compute `dst[i] = op(x[i], y[i])` for `n` elements of the native format `FORMAT`,
+//! with quantization mode `RND_CONV`. The operands are decoded a tile at a time, so
+//! that the arithmetic itself is a tight loop over native floating-point numbers.
+//! Elements whose results need a fixup are computed by `fixup(i)`.
+template <NativeFloatFormat FORMAT, typename OP, typename FIXUP>
+void native_float_binary_op(
+    const APyFloatData* x,
+    const APyFloatData* y,
+    APyFloatData* dst,
+    std::size_t n,
+    OP op,
+    FIXUP fixup
 )
 {
-    // Compute result bit specification
-    auto res_exp_bits = std::max(x.get_exp_bits(), y.get_exp_bits());
-    auto res_man_bits = std::max(x.get_man_bits(), y.get_man_bits());
-    auto res_bias = calc_bias(
-        res_exp_bits, x.get_exp_bits(), x.get_bias(), y.get_exp_bits(), y.get_bias()
+    using Codec = NativeFloatCodec<FORMAT>;
+    typename Codec::type a[_NATIVE_FLOAT_TILE_SIZE], b[_NATIVE_FLOAT_TILE_SIZE];
+    for (std::size_t begin = 0; begin < n; begin += _NATIVE_FLOAT_TILE_SIZE) {
+        const std::size_t size = std::min(_NATIVE_FLOAT_TILE_SIZE, n - begin);
+        for (std::size_t i = 0; i < size; i++) {
+            a[i] = Codec::decode(x[begin + i]);
+            b[i] = Codec::decode(y[begin + i]);
+        }
+        for (std::size_t i = 0; i < size; i++) {
+            a[i] = op(a[i], b[i]);
+        }
+        for (std::size_t i = 0; i < size; i++) {
+            if (Codec::needs_fixup(a[i])) {
+                fixup(begin + i);
+            } else {
+                dst[begin + i] = Codec::encode(a[i]);
+            }
+        }
+    }
+}
+
+//! Dispatch `native_float_binary_op` on `format`, which must not be `NONE`
+template <typename OP, typename FIXUP>
+void native_float_binary_op(
+    NativeFloatFormat format,
+    const APyFloatData* x,
+    const APyFloatData* y,
+    APyFloatData* dst,
+    std::size_t n,
+    OP op,
+    FIXUP fixup
+)
+{
+    switch (format) {
+    case NativeFloatFormat::BINARY16:
+        native_float_binary_op<NativeFloatFormat::BINARY16>(x, y, dst, n, op, fixup);
+        break;
+    case NativeFloatFormat::BFLOAT16:
+        native_float_binary_op<NativeFloatFormat::BFLOAT16>(x, y, dst, n, op, fixup);
+        break;
+    case NativeFloatFormat::BINARY32:
+        native_float_binary_op<NativeFloatFormat::BINARY32>(x, y, dst, n, op, fixup);
+        break;
+    case NativeFloatFormat::BINARY64:
+        native_float_binary_op<NativeFloatFormat::BINARY64>(x, y, dst, n, op, fixup);
+        break;
+    default:
+        assert(false && "native_float_binary_op(): not a native format");
+    }
+}
+
+/* ********************************************************************************** *
+ * *                     Table-driven arithmetic of small formats                   * *
+ * ********************************************************************************** */
+
+//! Maximum number of bits, `1 + exp_bits + man_bits`, of the operands of `FloatOpTable`
+constexpr int _FLOAT_TABLE_MAX_BITS = 8;
+
+//! Minimum number of operations per table entry, as a fraction `1 / N`, for which
+//! `FloatOpTable` is used. Building a table costs one scalar operation per entry.
+constexpr std::size_t _FLOAT_TABLE_MIN_OPS_FRACTION = 4;
+
+//! Maximum number of tables kept in the cache of `FloatOpTable::get`. The least
+//! recently used table is evicted first.
+constexpr std::size_t _FLOAT_TABLE_CACHE_SIZE = 64;
+
+//! Arithmetic operations of `FloatOpTable`. Subtraction is addition of the negation.
+enum class FloatTableOp { ADD, MUL, DIV };
+
+/*!
+ * Results of an arithmetic operation for every pair of operands of two formats with at
+ * most `_FLOAT_TABLE_MAX_BITS` bits each (e.g., the OCP FP8, FP6, and FP4 formats),
+ * indexed by the packed bit patterns of the operands (see `pack_float_data`). An
+ * operation on such formats is then a table lookup instead of the arithmetic of the
+ * scalar kernels. Tables are built on first use and cached (see `get`), and are only
+ * used for deterministic quantization modes and for enough operations to pay for
+ * building them.
+ */
+class FloatOpTable {
+public:
+    //! Test if a table should be used for `n` operations with the operand and result
+    //! formats, and the quantization mode
+    static bool is_applicable(
+        int x_exp_bits,
+        int x_man_bits,
+        int y_exp_bits,
+        int y_man_bits,
+        int res_exp_bits,
+        int res_man_bits,
+        QuantizationMode quantization,
+        std::size_t n
+    );
+
+    //! Retrieve the table of `op` for the operand and result formats, building it on
+    //! first use. The result format must be that of `APyFloat` arithmetic for
+    //! `FloatTableOp::ADD` and `FloatTableOp::DIV`. Thread-safe.
+    static std::shared_ptr<const FloatOpTable> get(
+        FloatTableOp op,
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization
     );
 
-    // Compute result sign
-    bool res_sign = src1->sign ^ src2->sign;
-    dst->sign = res_sign;
+    //! Result of the operation on `x` and `y`
+    APY_INLINE APyFloatData
+    operator()(const APyFloatData& x, const APyFloatData& y) const
+    {
+        const std::size_t idx
+            = (pack_float_data<std::size_t>(x, x_exp_bits, x_man_bits) << y_bits)
+            | pack_float_data<std::size_t>(y, y_exp_bits, y_man_bits);
+        return unpack_float_data(results[idx], res_exp_bits, res_man_bits);
+    }
 
-    // Handle special operands
-    if (is_max_exponent(*src1, x) || is_max_exponent(*src2, y) || is_zero(*src1)
-        || is_zero(*src2)) {
+    //! Results of the operation on the `n` elements of `x` and `y`, into `dst`
+    void operator()(
+        const APyFloatData* x, const APyFloatData* y, APyFloatData* dst, std::size_t n
+    ) const;
+
+private:
+    FloatOpTable(
+        FloatTableOp op,
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization
+    );
 
-        if (is_nan(*src1, x) || is_nan(*src2, y) || (is_inf(*src1, x) && is_zero(*src2))
-            || (is_zero(*src1) && is_inf(*src2, y))) {
-            // Set to NaN
-            dst->exp = ((1ULL << res_exp_bits) - 1);
-            dst->man = 1;
-            return; // early exit
-        }
+    std::uint8_t x_exp_bits, x_man_bits, y_exp_bits, y_man_bits, y_bits;
+    std::uint8_t res_exp_bits, res_man_bits;
+    std::vector<std::uint16_t> results; // Packed results
+};
 
-        if (is_inf(*src1, x) || is_inf(*src2, y)) {
-            // Set to inf
-            dst->exp = ((1ULL << res_exp_bits) - 1);
-            dst->man = 0;
-            return; // early exit
-        }
+/* ********************************************************************************** *
+ * *                      Scalar product and sum kernels                            * *
+ * ********************************************************************************** */
 
-        if (is_zero(*src1) || is_zero(*src2)) {
-            // Set to zero
-            dst->exp = 0;
-            dst->man = 0;
-            return; // early exit
-        }
+/*!
+ * Product of two floating-point numbers, quantized to the result format. This is the
+ * kernel of `APyFloat::operator*` and `APyFloatArray::hadamard_multiplication`, with
+ * all format constants computed once. The product of the mantissas is computed in the
+ * integer type `MAN`, `man_t` or `man2_t`. Only valid if the product of the mantissas,
+ * with leading ones and two extra bits, fits in a `MAN` (see `is_applicable`).
+ */
+template <typename MAN> class BasicFloatProductKernel {
+public:
+    BasicFloatProductKernel(
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization
+    )
+        : x_man_bits { x_man_bits }
+        , y_man_bits { y_man_bits }
+        , res_man_bits { res_man_bits }
+        , sum_man_bits { x_man_bits + y_man_bits }
+        , x_max_exponent { exp_t((1ULL << x_exp_bits) - 1) }
+        , y_max_exponent { exp_t((1ULL << y_exp_bits) - 1) }
+        , res_max_exponent { exp_t((1ULL << res_exp_bits) - 1) }
+        , bias_sum { std::int64_t(x_bias + y_bias - res_bias) }
+        , two_before { MAN(1) << (sum_man_bits + 1) }
+        , one_before { MAN(1) << sum_man_bits }
+        , two_res { MAN(1) << res_man_bits }
+        , mask_two { (MAN(1) << (sum_man_bits + 2)) - 1 }
+        , man_bits_delta { std::uint8_t(sum_man_bits + 2 - res_man_bits) }
+        , sticky_constant { (MAN(1) << (man_bits_delta - 1)) - 1 }
+        , quantization { quantization }
+    {
+        assert(is_applicable(x_man_bits, y_man_bits));
+    }
+
+    //! Test if the kernel can be used for operands with `x_man_bits` and `y_man_bits`
+    static APY_INLINE bool is_applicable(int x_man_bits, int y_man_bits)
+    {
+        return unsigned(x_man_bits + y_man_bits) + 3 <= 8 * sizeof(MAN);
+    }
+
+    //! Format constants of the vectorized kernel `simd::vector_float_mul`
+    simd::FloatMulConstants simd_constants() const
+    {
+        return { x_man_bits,      y_man_bits, x_max_exponent, y_max_exponent,
+                 res_max_exponent, bias_sum,  man_bits_delta, quantization };
     }
 
-    const auto quantization = get_float_quantization_mode();
-    const unsigned int sum_man_bits = x.get_man_bits() + y.get_man_bits();
+    APY_INLINE APyFloatData
+    operator()(const APyFloatData& x, const APyFloatData& y) const
+    {
+        // Calculate sign
+        const bool res_sign = x.sign ^ y.sign;
+
+        const bool x_is_subnormal = (x.exp == 0);
+        const bool x_is_maxexp = (x.exp == x_max_exponent);
+        const bool y_is_subnormal = (y.exp == 0);
+        const bool y_is_maxexp = (y.exp == y_max_exponent);
+
+        // Handle special operands
+        if (x_is_maxexp || y_is_maxexp || x_is_subnormal || y_is_subnormal) {
+            const bool x_is_nan = (x_is_maxexp && x.man != 0);
+            const bool x_is_inf = (x_is_maxexp && x.man == 0);
+            const bool y_is_nan = (y_is_maxexp && y.man != 0);
+            const bool y_is_inf = (y_is_maxexp && y.man == 0);
+            const bool x_is_zero = (x_is_subnormal && x.man == 0);
+            const bool y_is_zero = (y_is_subnormal && y.man == 0);
+            if (x_is_nan || y_is_nan || (x_is_inf && y_is_zero)
+                || (y_is_inf && x_is_zero)) {
+                // Set to nan
+                return { res_sign, res_max_exponent, man_t(1) };
+            }
 
-    if (sum_man_bits + 3 <= _MAN_T_SIZE_BITS) {
-        const auto new_man_bits = sum_man_bits + 2;
-        const auto man_bits_delta = new_man_bits - res_man_bits;
+            if (x_is_inf || y_is_inf) {
+                // Set to inf
+                return { res_sign, res_max_exponent, man_t(0) };
+            }
+
+            // x is zero or y is zero (and the other is not inf)
+            if (x_is_zero || y_is_zero) {
+                // Set to zero
+                return { res_sign, exp_t(0), man_t(0) };
+            }
+        }
 
         // Tentative exponent
-        std::int64_t tmp_exp = true_exp(*src1, x) + true_exp(*src2, y) + res_bias;
-        const man_t two = 1ULL << (new_man_bits);
-        const man_t two_before = 1ULL << (new_man_bits - 1);
-        const man_t one_before = 1ULL << (new_man_bits - 2);
-        const man_t two_res = (1ULL << res_man_bits);
+        std::int64_t tmp_exp = (std::int64_t)x.exp + x_is_subnormal
+            + (std::int64_t)y.exp + y_is_subnormal - bias_sum;
+        const MAN mx = (MAN(!x_is_subnormal) << x_man_bits) | x.man;
+        const MAN my = (MAN(!y_is_subnormal) << y_man_bits) | y.man;
 
-        man_t new_man = true_man(*src1, x) * true_man(*src2, y);
+        MAN new_man = mx * my;
 
         // Check result from multiplication larger than/equal two
         if (new_man & two_before) {
@@ -430,99 +1091,96 @@ void float_product(
         if (tmp_exp <= 0) {
             if (tmp_exp < -static_cast<std::int64_t>(res_man_bits)) {
                 // Exponent too small after rounding
-                dst->man = quantize_close_to_zero(res_sign, new_man, quantization);
-                dst->exp = 0;
-                return; // early exit
+                return { res_sign,
+                         exp_t(0),
+                         quantize_close_to_zero(
+                             res_sign, man_t(new_man), quantization
+                         ) };
             }
+            // Shift and add sticky bit
             new_man = (new_man >> (-tmp_exp + 1))
-                | ((new_man & ((1 << (-tmp_exp + 1)) - 1)) != 0);
+                | ((new_man & ((MAN(1) << (-tmp_exp + 1)) - 1)) != 0);
             tmp_exp = 0;
         }
 
-        exp_t res_exp = static_cast<exp_t>(tmp_exp);
-        new_man &= (two - 1);
+        new_man &= mask_two;
+        exp_t new_exp = static_cast<exp_t>(tmp_exp);
         quantize_mantissa(
             new_man,
-            res_exp,
-            ((1ULL << res_exp_bits) - 1), // max_exponent
+            new_exp,
+            res_max_exponent,
             man_bits_delta,
             res_sign,
             two_res,
+            man_bits_delta - 1,
+            sticky_constant,
             quantization
         );
+        return { res_sign, new_exp, man_t(new_man) };
+    }
 
-        dst->man = new_man;
-        dst->exp = res_exp;
-        return;
-    } else {
-        // Normalize both inputs
-        auto [norm_x, norm_x_exp_bits, norm_x_bias] = normalize(*src1, x);
-        auto [norm_y, norm_y_exp_bits, norm_y_bias] = normalize(*src2, y);
-
-        // Add leading one's
-        const man_t mx = true_man(norm_x, norm_x_exp_bits, x.get_man_bits());
-        const man_t my = true_man(norm_y, norm_y_exp_bits, y.get_man_bits());
-
-        // Tentative exponent
-        std::int64_t new_exp = ((std::int64_t)norm_x.exp - (std::int64_t)norm_x_bias)
-            + ((std::int64_t)norm_y.exp - (std::int64_t)norm_y_bias) + res_bias;
-
-        // Two integer bits, sign bit and leading one
-        const APyFixed apy_mx(
-            2 + x.get_man_bits(), 2, limb_vector_from_uint64_t({ mx })
-        );
-        const APyFixed apy_my(
-            2 + y.get_man_bits(), 2, limb_vector_from_uint64_t({ my })
-        );
-
-        auto apy_res = (apy_mx * apy_my);
-
-        // Check result from multiplication larger than/equal two
-        if (apy_res.positive_greater_than_equal_pow2(1)) {
-            apy_res >>= 1;
-            new_exp++;
-        }
-
-        // Handle subnormal case
-        if (new_exp <= 0) {
-            apy_res >>= std::abs(new_exp) + 1;
-            new_exp = 0;
-        }
-
-        // Quantize mantissa
-        quantize_apymantissa(apy_res, res_sign, res_man_bits, quantization);
-
-        // Carry from quantization
-        if (apy_res.positive_greater_than_equal_pow2(1)) {
-            new_exp++;
-            apy_res >>= 1;
-        }
-
-        if (new_exp >= exp_t((1ULL << res_exp_bits) - 1)) {
-            if (do_infinity(quantization, res_sign)) {
-                dst->exp = ((1ULL << res_exp_bits) - 1);
-                dst->man = 0;
-            } else {
-                dst->exp = ((1ULL << res_exp_bits) - 1) - 1;
-                dst->man = (1ULL << res_man_bits) - 1;
-            }
-            return;
-        }
-
-        if (apy_res.positive_greater_than_equal_pow2(0)) { // Remove leading one
-            apy_res = apy_res - fx_one;
-
-            // If a leading one is present while the exponent is zero,
-            // then it 'acts like a carry' and creates a normal number
-            if (new_exp == 0) {
-                new_exp = 1;
-            }
-        }
-        apy_res <<= res_man_bits;
-        dst->man = (man_t)(apy_res).to_double();
-        dst->exp = new_exp;
-        return;
+private:
+    std::uint8_t x_man_bits, y_man_bits, res_man_bits;
+    int sum_man_bits;
+    exp_t x_max_exponent, y_max_exponent, res_max_exponent;
+    std::int64_t bias_sum;
+    MAN two_before, one_before, two_res, mask_two;
+    std::uint8_t man_bits_delta;
+    MAN sticky_constant;
+    QuantizationMode quantization;
+};
+
+//! Product kernel of formats with narrow mantissas
+using FloatProductKernel = BasicFloatProductKernel<man_t>;
+
+//! Product kernel of all other formats, as the product of two mantissas with leading
+//! ones and two extra bits always fits in a `man2_t`
+using WideFloatProductKernel = BasicFloatProductKernel<man2_t>;
+static_assert(2 * _MAN_LIMIT_BITS + 3 <= 8 * sizeof(man2_t));
+
+//! Call `fn` with the product kernel, `FloatProductKernel` or `WideFloatProductKernel`,
+//! of the given formats and return its result
+template <typename FUNC>
+decltype(auto) with_float_product_kernel(
+    std::uint8_t x_exp_bits,
+    std::uint8_t x_man_bits,
+    exp_t x_bias,
+    std::uint8_t y_exp_bits,
+    std::uint8_t y_man_bits,
+    exp_t y_bias,
+    std::uint8_t res_exp_bits,
+    std::uint8_t res_man_bits,
+    exp_t res_bias,
+    QuantizationMode quantization,
+    FUNC&& fn
+)
+{
+    if (FloatProductKernel::is_applicable(x_man_bits, y_man_bits)) {
+        return fn(FloatProductKernel(
+            x_exp_bits,
+            x_man_bits,
+            x_bias,
+            y_exp_bits,
+            y_man_bits,
+            y_bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        ));
     }
+    return fn(WideFloatProductKernel(
+        x_exp_bits,
+        x_man_bits,
+        x_bias,
+        y_exp_bits,
+        y_man_bits,
+        y_bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        quantization
+    ));
 }
 
 //! Iterator-based multiply-accumulate
@@ -546,17 +1204,676 @@ void float_inner_product(
         res_exp_bits, x.get_exp_bits(), x.get_bias(), y.get_exp_bits(), y.get_bias()
     );
 
-    APyFloatData product { 0, 0, 0 };
     APyFloat accumulator(0, 0, 0, res_exp_bits, res_man_bits, res_bias);
-    for (std::size_t i = 0; i < n_items; i++) {
-        // Multiply
-        float_product(src1 + i, src2 + i, &product, x, y);
+    with_float_product_kernel(
+        x.get_exp_bits(),
+        x.get_man_bits(),
+        x.get_bias(),
+        y.get_exp_bits(),
+        y.get_man_bits(),
+        y.get_bias(),
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        get_float_quantization_mode(),
+        [&](const auto& product) {
+            for (std::size_t i = 0; i < n_items; i++) {
+                accumulator += APyFloat(
+                    product(src1[i], src2[i]), res_exp_bits, res_man_bits, res_bias
+                );
+            }
+        }
+    );
 
-        // Accumulate
-        accumulator += APyFloat(product, res_exp_bits, res_man_bits, res_bias);
+    *dst = accumulator.get_data();
+}
+
+/*!
+ * Sum of two floating-point numbers in a single format, quantized to that format. This
+ * is the kernel of `APyFloat::operator+` and `APyFloatArray::operator+`, with all
+ * format constants computed once. The mantissas are aligned and added in the integer
+ * type `MAN`, `man_t` or `man2_t`. Only valid if the mantissa, with leading one,
+ * carry, and three guard bits, fits in a `MAN`, and for quantization modes other than
+ * `STOCH_WEIGHTED` (see `is_applicable`).
+ */
+template <typename MAN> class BasicFloatAddKernel {
+public:
+    BasicFloatAddKernel(
+        std::uint8_t exp_bits, std::uint8_t man_bits, QuantizationMode quantization
+    )
+        : max_man_bits { man_bits + 5u }
+        , res_max_exponent { exp_t((1ULL << exp_bits) - 1) }
+        , final_res_leading_one { MAN(1) << man_bits }
+        , res_leading_one { final_res_leading_one << 3 }
+        , carry_res_leading_one { res_leading_one << 1 }
+        , shift_normalization_const { unsigned(MAN_BITS) - (man_bits + 4u) }
+        , man_mask { carry_res_leading_one - 1 }
+        , is_to_neg { quantization == QuantizationMode::TRN }
+        , quantization { quantization }
+    {
+        assert(is_applicable(man_bits, quantization));
     }
 
-    *dst = accumulator.get_data();
+    //! Test if the kernel can be used for `man_bits` and `quantization`
+    static APY_INLINE bool is_applicable(int man_bits, QuantizationMode quantization)
+    {
+        return unsigned(man_bits) + 5 <= MAN_BITS
+            && quantization != QuantizationMode::STOCH_WEIGHTED;
+    }
+
+    APY_INLINE APyFloatData operator()(APyFloatData x, APyFloatData y) const
+    {
+        bool x_is_zero_exponent = (x.exp == 0);
+        bool y_is_zero_exponent = (y.exp == 0);
+        // Handle zero cases
+        if (x_is_zero_exponent && x.man == 0) {
+            if (y_is_zero_exponent && y.man == 0) {
+                y.sign = (x.sign == y.sign) ? x.sign : is_to_neg;
+            }
+            return y;
+        }
+        if (y_is_zero_exponent && y.man == 0) {
+            return x;
+        }
+        const bool x_is_max_exponent = x.exp == res_max_exponent;
+        const bool y_is_max_exponent = y.exp == res_max_exponent;
+
+        // Handle the NaN and inf cases
+        if (x_is_max_exponent || y_is_max_exponent) {
+            if ((x_is_max_exponent && x.man != 0) || (y_is_max_exponent && y.man != 0)
+                || (x_is_max_exponent && y_is_max_exponent && x.sign != y.sign)) {
+                // Set to NaN
+                return { x.sign, res_max_exponent, man_t(1) };
+            }
+
+            // Handle inf cases
+            if (x_is_max_exponent && x.man == 0) {
+                // Set to inf
+                return { x.sign, res_max_exponent, man_t(0) };
+            }
+
+            if (y_is_max_exponent && y.man == 0) {
+                // Set to inf
+                return { y.sign, res_max_exponent, man_t(0) };
+            }
+        }
+        // Compute sign and swap operands if need to make sure |x| >= |y|
+        if (x.exp < y.exp || (x.exp == y.exp && x.man < y.man)) {
+            std::swap(x, y);
+            std::swap(x_is_zero_exponent, y_is_zero_exponent);
+        } else if (x.sign != y.sign && x.exp == y.exp && x.man == y.man) {
+            // Set to zero
+            return { is_to_neg, exp_t(0), man_t(0) };
+        }
+
+        // Tentative exponent
+        exp_t new_exp = x.exp + x_is_zero_exponent;
+
+        // Conditionally add leading one's, also add room for guard bits
+        // Note that exp can never be res_max_exponent here
+        const MAN mx
+            = (x_is_zero_exponent ? MAN(0) : res_leading_one) | (MAN(x.man) << 3);
+        const MAN my
+            = (y_is_zero_exponent ? MAN(0) : res_leading_one) | (MAN(y.man) << 3);
+
+        // Align mantissas based on exponent difference
+        const unsigned exp_delta = new_exp - y.exp - y_is_zero_exponent;
+
+        // Align mantissa based on difference in exponent
+        MAN m_aligned;
+        if (exp_delta <= 3) {
+            m_aligned = my >> exp_delta;
+        } else if (exp_delta >= max_man_bits) {
+            // `my` is shifted out entirely, only the sticky bit remains
+            m_aligned = 1;
+        } else {
+            m_aligned = (my >> exp_delta) | ((my << (MAN_BITS - exp_delta)) != 0);
+        }
+
+        // Perform addition / subtraction
+        MAN new_man = (x.sign == y.sign) ? mx + m_aligned : mx - m_aligned;
+
+        // Check for carry and cancellation
+        if (new_man & carry_res_leading_one) {
+            // Carry
+            new_exp++;
+        } else if (new_man & res_leading_one) {
+            // Align mantissa to carry case
+            new_man <<= 1;
+        } else {
+            // Cancellation or addition with subnormals
+            // Mantissa should be shifted until 1.xx is obtained or new_exp equals 0
+            const unsigned int man_leading_zeros = leading_zeros(new_man);
+            const unsigned int normalizing_shift
+                = man_leading_zeros - shift_normalization_const;
+
+            if (new_exp > normalizing_shift) {
+                new_man <<= normalizing_shift + 1;
+                new_exp -= normalizing_shift;
+            } else {
+                // The result will be a subnormal
+                new_man <<= new_exp;
+                new_exp = 0;
+            }
+        }
+
+        new_man &= man_mask;
+
+        quantize_mantissa(
+            new_man,
+            new_exp,
+            res_max_exponent,
+            4,
+            x.sign,
+            final_res_leading_one,
+            3,
+            7,
+            quantization
+        );
+
+        return { x.sign, new_exp, man_t(new_man) };
+    }
+
+private:
+    static constexpr unsigned MAN_BITS = 8 * sizeof(MAN);
+
+    unsigned max_man_bits;
+    exp_t res_max_exponent;
+    MAN final_res_leading_one, res_leading_one, carry_res_leading_one;
+    unsigned shift_normalization_const;
+    MAN man_mask;
+    bool is_to_neg;
+    QuantizationMode quantization;
+};
+
+//! Addition kernel of formats with narrow mantissas
+using FloatAddKernel = BasicFloatAddKernel<man_t>;
+
+//! Addition kernel of all other formats
+using WideFloatAddKernel = BasicFloatAddKernel<man2_t>;
+
+/*!
+ * Sequential sum of floating-point numbers in a single format, quantized after every
+ * addition. This is the kernel of `APyFloatArray::vector_sum`, starting from positive
+ * zero. Once an addition produces NaN, further terms are ignored. The mantissas are
+ * aligned and added in the integer type `MAN`, `man_t` or `man2_t`. Only valid if the
+ * mantissa, with leading one, carry, and three guard bits, fits in a `MAN`, and for
+ * quantization modes other than `STOCH_WEIGHTED` (see `is_applicable`).
+ */
+template <typename MAN> class BasicFloatSumKernel {
+public:
+    BasicFloatSumKernel(
+        std::uint8_t exp_bits, std::uint8_t man_bits, QuantizationMode quantization
+    )
+        : max_man_bits { man_bits + 5u }
+        , res_max_exponent { exp_t((1ULL << exp_bits) - 1) }
+        , final_res_leading_one { MAN(1) << man_bits }
+        , res_leading_one { final_res_leading_one << 3 }
+        , carry_res_leading_one { res_leading_one << 1 }
+        , shift_normalization_const { unsigned(MAN_BITS) - (man_bits + 4u) }
+        , man_mask { carry_res_leading_one - 1 }
+        , quantization { quantization }
+    {
+        assert(is_applicable(man_bits, quantization));
+    }
+
+    //! Test if the kernel can be used for `man_bits` and `quantization`
+    static APY_INLINE bool is_applicable(int man_bits, QuantizationMode quantization)
+    {
+        return unsigned(man_bits) + 5 <= MAN_BITS
+            && quantization != QuantizationMode::STOCH_WEIGHTED;
+    }
+
+    //! Restart the sum from positive zero
+    APY_INLINE void reset()
+    {
+        sum_sign = false;
+        sum_exp = 0;
+        sum_man = 0;
+        sum_is_max_exponent = false;
+        sum_is_nan = false;
+    }
+
+    //! Test if a NaN has been produced, in which case further terms have no effect
+    APY_INLINE bool is_nan() const { return sum_is_nan; }
+
+    //! Retrieve the current sum
+    APY_INLINE APyFloatData get() const
+    {
+        return { sum_sign, sum_exp, man_t(sum_man) };
+    }
+
+    //! Add `x` to the sum
+    APY_INLINE void add(const APyFloatData& x)
+    {
+        if (sum_is_nan) {
+            return;
+        }
+        const bool x_is_zero_exponent = (x.exp == 0);
+        // Handle zero cases
+        if (x_is_zero_exponent && x.man == 0) {
+            return;
+        }
+        const bool sum_is_zero_exponent = (sum_exp == 0);
+        if (sum_is_zero_exponent && sum_man == 0) {
+            sum_sign = x.sign;
+            sum_exp = x.exp;
+            sum_man = x.man;
+            sum_is_max_exponent = (x.exp == res_max_exponent);
+            return;
+        }
+        const bool x_is_max_exponent = x.exp == res_max_exponent;
+        const bool same_sign = (x.sign == sum_sign);
+        // Handle the NaN and inf cases
+        if (x_is_max_exponent || sum_is_max_exponent) {
+            if ((x_is_max_exponent && x.man != 0)
+                || (sum_is_max_exponent && sum_man != 0)
+                || (x_is_max_exponent && sum_is_max_exponent && !same_sign)) {
+                // Set to NaN
+                sum_sign = false;
+                sum_exp = res_max_exponent;
+                sum_man = 1;
+                sum_is_nan = true;
+                return;
+            }
+
+            // Handle inf cases
+            if (x_is_max_exponent && x.man == 0) {
+                // Set to inf
+                sum_sign = x.sign;
+                sum_exp = res_max_exponent;
+                sum_man = 0;
+                sum_is_max_exponent = true;
+            }
+
+            // Here: sum_is_max_exponent && sum_man == 0
+            // Keep at inf
+            return;
+        }
+
+        if (!same_sign && x.exp == sum_exp && x.man == sum_man) {
+            // Set to zero
+            sum_sign = false;
+            sum_exp = 0;
+            sum_man = 0;
+            return;
+        }
+
+        const exp_t true_x_exp = x.exp + x_is_zero_exponent;
+        const exp_t true_sum_exp = sum_exp + sum_is_zero_exponent;
+        // Conditionally add leading one's, also add room for guard bits
+        // Note that exp can never be res_max_exponent here
+        MAN mx = (x_is_zero_exponent ? MAN(0) : res_leading_one) | (MAN(x.man) << 3);
+        const MAN msum
+            = (sum_is_zero_exponent ? MAN(0) : res_leading_one) | (sum_man << 3);
+
+        // Compute sign and swap operands if need to make sure |x| >= |y|
+        if (x.exp < sum_exp || (x.exp == sum_exp && x.man < sum_man)) {
+            const unsigned exp_delta = true_sum_exp - true_x_exp;
+            // Align mantissa based on difference in exponent
+            if (exp_delta <= 3) {
+                mx >>= exp_delta;
+            } else if (exp_delta >= max_man_bits) {
+                mx = (mx >> max_man_bits) | 1;
+            } else {
+                mx = (mx >> exp_delta) | ((mx << (MAN_BITS - exp_delta)) != 0);
+            }
+            sum_exp = true_sum_exp;
+            // Perform addition / subtraction
+            sum_man = same_sign ? msum + mx : msum - mx;
+        } else {
+            // Align mantissas based on exponent difference
+            const unsigned exp_delta = true_x_exp - true_sum_exp;
+            // Align mantissa based on difference in exponent
+            MAN m_aligned;
+            if (exp_delta <= 3) {
+                m_aligned = msum >> exp_delta;
+            } else if (exp_delta >= max_man_bits) {
+                m_aligned = (msum >> max_man_bits) | 1;
+            } else {
+                m_aligned = (msum >> exp_delta)
+                    | ((msum << (MAN_BITS - exp_delta)) != 0);
+            }
+            sum_exp = true_x_exp;
+            // Perform addition / subtraction
+            sum_man = same_sign ? mx + m_aligned : mx - m_aligned;
+            sum_sign = x.sign;
+        }
+
+        // Check for carry and cancellation
+        if (sum_man & carry_res_leading_one) {
+            // Carry
+            sum_exp++;
+        } else if (sum_man & res_leading_one) {
+            // Align mantissa to carry case
+            sum_man <<= 1;
+        } else {
+            // Cancellation or addition with subnormals
+            // Mantissa should be shifted until 1.xx is obtained or new_exp
+            // equals 0
+            const unsigned int man_leading_zeros = leading_zeros(sum_man);
+            const unsigned int normalizing_shift
+                = man_leading_zeros - shift_normalization_const;
+
+            if (sum_exp > normalizing_shift) {
+                sum_man <<= normalizing_shift + 1;
+                sum_exp -= normalizing_shift;
+            } else {
+                // The result will be a subnormal
+                sum_man <<= sum_exp;
+                sum_exp = 0;
+            }
+        }
+
+        sum_man &= man_mask;
+
+        quantize_mantissa(
+            sum_man,
+            sum_exp,
+            res_max_exponent,
+            4,
+            sum_sign,
+            final_res_leading_one,
+            3,
+            7,
+            quantization
+        );
+
+        // Check for overflow
+        if (sum_exp == res_max_exponent) {
+            sum_is_max_exponent = true;
+        }
+    }
+
+private:
+    static constexpr unsigned MAN_BITS = 8 * sizeof(MAN);
+
+    unsigned max_man_bits;
+    exp_t res_max_exponent;
+    MAN final_res_leading_one, res_leading_one, carry_res_leading_one;
+    unsigned shift_normalization_const;
+    MAN man_mask;
+    QuantizationMode quantization;
+
+    bool sum_sign = false;
+    exp_t sum_exp = 0;
+    MAN sum_man = 0;
+    bool sum_is_max_exponent = false;
+    bool sum_is_nan = false;
+};
+
+//! Sum kernel of formats with narrow mantissas
+using FloatSumKernel = BasicFloatSumKernel<man_t>;
+
+//! Sum kernel of all other formats
+using WideFloatSumKernel = BasicFloatSumKernel<man2_t>;
+
+//! Quotient `floor(num * 2^shift / den)`. Only valid if `shift < 128`, `den < 2^63`,
+//! and the quotient fits in a `man2_t`.
+APY_INLINE man2_t divide_shifted(man_t num, unsigned shift, man_t den)
+{
+    assert(shift < 128);
+    // Words of the shifted numerator
+    const std::uint64_t top = shift > 64 ? num >> (128 - shift) : 0;
+    const man2_t bottom = man2_t(num) << shift;
+    std::uint64_t rem;
+    const std::uint64_t high = divide_words(top, bottom.hi, den, rem);
+    return { high, divide_words(rem, bottom.lo, den, rem) };
 }
 
+/*!
+ * Quotient of two floating-point numbers, quantized to the result format. This is the
+ * kernel of `APyFloat::operator/` and `APyFloatArray::operator/`, with all format
+ * constants computed once. The quotient of the mantissas is computed with 64 guard
+ * bits, truncated, and then quantized, which always fits in a `man2_t`.
+ */
+class FloatQuotientKernel {
+public:
+    FloatQuotientKernel(
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization
+    )
+        : x_man_bits { x_man_bits }
+        , y_man_bits { y_man_bits }
+        , x_max_exponent { exp_t((1ULL << x_exp_bits) - 1) }
+        , y_max_exponent { exp_t((1ULL << y_exp_bits) - 1) }
+        , res_max_exponent { exp_t((1ULL << res_exp_bits) - 1) }
+        , bias_delta { std::int64_t(res_bias) - std::int64_t(x_bias) + y_bias }
+        , leading_one { man2_t(1) << (_GUARD_BITS + 2 + x_man_bits) }
+        , two_res { man2_t(1) << res_man_bits }
+        , man_bits_delta { std::uint8_t(_GUARD_BITS + 2 + x_man_bits - res_man_bits) }
+        , sticky_constant { (man2_t(1) << (man_bits_delta - 1)) - 1 }
+        , quantization { quantization }
+    {
+    }
+
+    APY_INLINE APyFloatData
+    operator()(const APyFloatData& x, const APyFloatData& y) const
+    {
+        // Calculate sign
+        const bool res_sign = x.sign ^ y.sign;
+
+        const bool x_is_subnormal = (x.exp == 0);
+        const bool x_is_maxexp = (x.exp == x_max_exponent);
+        const bool y_is_subnormal = (y.exp == 0);
+        const bool y_is_maxexp = (y.exp == y_max_exponent);
+
+        // Handle special operands
+        if (x_is_maxexp || y_is_maxexp || x_is_subnormal || y_is_subnormal) {
+            const bool x_is_nan = (x_is_maxexp && x.man != 0);
+            const bool x_is_inf = (x_is_maxexp && x.man == 0);
+            const bool y_is_nan = (y_is_maxexp && y.man != 0);
+            const bool y_is_inf = (y_is_maxexp && y.man == 0);
+            const bool x_is_zero = (x_is_subnormal && x.man == 0);
+            const bool y_is_zero = (y_is_subnormal && y.man == 0);
+            if (x_is_nan || y_is_nan || (x_is_zero && y_is_zero)
+                || (x_is_inf && y_is_inf)) {
+                // Set to nan
+                return { res_sign, res_max_exponent, man_t(1) };
+            }
+
+            if (x_is_zero || y_is_inf) {
+                // Set to zero
+                return { res_sign, exp_t(0), man_t(0) };
+            }
+
+            if (x_is_inf || y_is_zero) {
+                // Set to inf
+                return { res_sign, res_max_exponent, man_t(0) };
+            }
+        }
+
+        // Normalize both operands, so that the mantissas are 1.xx
+        std::int64_t new_exp = (std::int64_t)x.exp + x_is_subnormal
+            - (std::int64_t)y.exp - y_is_subnormal + bias_delta;
+        man_t mx = (man_t(!x_is_subnormal) << x_man_bits) | x.man;
+        man_t my = (man_t(!y_is_subnormal) << y_man_bits) | y.man;
+        if (x_is_subnormal) {
+            const int shift = x_man_bits + 1 - bit_width(mx);
+            mx <<= shift;
+            new_exp -= shift;
+        }
+        if (y_is_subnormal) {
+            const int shift = y_man_bits + 1 - bit_width(my);
+            my <<= shift;
+            new_exp += shift;
+        }
+
+        // Quotient of the mantissas, with two integer bits and `_GUARD_BITS` extra
+        // fractional bits. It is in (1/2, 2), so normalization may be required.
+        man2_t new_man = divide_shifted(mx, _GUARD_BITS + 2 + y_man_bits, my);
+        if (!(new_man & leading_one)) {
+            new_man <<= 1;
+            new_exp--;
+        }
+
+        // Check limits
+        if (new_exp >= std::int64_t(res_max_exponent)) {
+            if (do_infinity(quantization, res_sign)) {
+                return { res_sign, res_max_exponent, man_t(0) };
+            }
+            return { res_sign, exp_t(res_max_exponent - 1), man_t(two_res) - 1 };
+        }
+
+        if (new_exp <= 0) {
+            // Handle subnormal case, the leading one is shifted into the fraction
+            new_man = shift_right_sticky(new_man, unsigned(-new_exp + 1));
+            new_exp = 0;
+        } else {
+            // Remove leading one
+            new_man = new_man - leading_one;
+        }
+
+        exp_t res_exp = exp_t(new_exp);
+        quantize_mantissa(
+            new_man,
+            res_exp,
+            res_max_exponent,
+            man_bits_delta,
+            res_sign,
+            two_res,
+            man_bits_delta - 1,
+            sticky_constant,
+            quantization
+        );
+        return { res_sign, res_exp, man_t(new_man) };
+    }
+
+private:
+    //! Number of guard bits of the mantissa quotient, as in `APyFloat::operator/`
+    static constexpr unsigned _GUARD_BITS = 64;
+
+    std::uint8_t x_man_bits, y_man_bits;
+    exp_t x_max_exponent, y_max_exponent, res_max_exponent;
+    std::int64_t bias_delta;
+    man2_t leading_one, two_res;
+    std::uint8_t man_bits_delta;
+    man2_t sticky_constant;
+    QuantizationMode quantization;
+};
+
+/*!
+ * Fused inner product of floating-point numbers: the products are quantized to the
+ * result format as by `FloatProductKernel` and accumulated as by `FloatSumKernel`,
+ * which gives the same result as a Hadamard product followed by a sequential sum,
+ * without writing the products to memory. The products are computed a tile at a time,
+ * with the vectorized or native floating-point kernels when possible. Only valid if
+ * both kernels are applicable, and for deterministic quantization modes.
+ */
+class FloatDotKernel {
+public:
+    //! Scratch memory of a call, see `operator()`
+    using scratch_t = simd::FloatTile;
+
+    //! Construct the kernel for computing `n_products` products in total, which decides
+    //! if the products are looked up in a `FloatOpTable`. If `quantize_operands`, the
+    //! operands are quantized to the result format before they are multiplied, as by
+    //! `float_cast`, which is how an accumulator format is applied. This is done a tile
+    //! at a time, so no quantized copies of the operand arrays are needed.
+    FloatDotKernel(
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization,
+        std::size_t n_products,
+        bool quantize_operands = false
+    );
+
+    //! Test if the kernel can be used for the operand and result formats. With
+    //! `quantize_operands`, the operand formats are the result format.
+    static bool is_applicable(
+        int x_man_bits, int y_man_bits, int res_man_bits, QuantizationMode quantization
+    );
+
+    //! Inner product of the `n` elements of `x` and `y`. The tile is scratch memory,
+    //! which should be reused between calls.
+    APyFloatData operator()(
+        const APyFloatData* x,
+        const APyFloatData* y,
+        std::size_t n,
+        simd::FloatTile& tile
+    ) const;
+
+private:
+    FloatProductKernel product;
+    FloatSumKernel sum;
+    simd::FloatMulConstants simd_constants;
+    NativeFloatFormat native_format;
+    std::shared_ptr<const FloatOpTable> product_table;
+
+    //! Casts of the operands to the result format, if `quantize_operands` and the
+    //! formats differ
+    std::optional<FloatCastConstants> x_cast, y_cast;
+    QuantizationMode quantization;
+};
+
+//! Maximum number of exponent bits of the operands of `FloatExactDotKernel`
+constexpr int _EXACT_DOT_MAX_EXP_BITS = 11;
+
+/*!
+ * Exact inner product of floating-point numbers, quantized once to the result format.
+ * The products are accumulated without error in a two's complement fixed-point
+ * accumulator (a Kulisch accumulator), which spans every product of finite operands
+ * with room for 2^63 terms. This models fused dot-product hardware, and is faster
+ * than quantizing after every addition. Only valid if the product of the mantissas
+ * fits in a `man_t` and if the operands have at most `_EXACT_DOT_MAX_EXP_BITS`
+ * exponent bits. A result of exactly zero is positive zero.
+ */
+class FloatExactDotKernel {
+public:
+    //! Scratch memory of a call (the accumulator), see `operator()`
+    using scratch_t = std::vector<mp_limb_t>;
+
+    FloatExactDotKernel(
+        std::uint8_t x_exp_bits,
+        std::uint8_t x_man_bits,
+        exp_t x_bias,
+        std::uint8_t y_exp_bits,
+        std::uint8_t y_man_bits,
+        exp_t y_bias,
+        std::uint8_t res_exp_bits,
+        std::uint8_t res_man_bits,
+        exp_t res_bias,
+        QuantizationMode quantization
+    );
+
+    //! Test if the kernel can be used for the operand formats
+    static bool
+    is_applicable(int x_exp_bits, int x_man_bits, int y_exp_bits, int y_man_bits);
+
+    //! Inner product of the `n` elements of `x` and `y`. The accumulator is scratch
+    //! memory, which should be reused between calls.
+    APyFloatData operator()(
+        const APyFloatData* x,
+        const APyFloatData* y,
+        std::size_t n,
+        std::vector<mp_limb_t>& acc
+    ) const;
+
+private:
+    //! Quantize the value of the accumulator to the result format
+    APyFloatData quantize(std::vector<mp_limb_t>& acc) const;
+
+    std::uint8_t x_man_bits, y_man_bits, res_man_bits;
+    exp_t x_max_exponent, y_max_exponent, res_max_exponent;
+    exp_t res_bias;
+    std::int64_t lsb_exp; // Exponent of the least significant accumulator bit
+    std::size_t acc_limbs;
+    QuantizationMode quantization;
+};
+
 #endif // _APYFLOAT_UTIL_H
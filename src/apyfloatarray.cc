@@ -1,6 +1,8 @@
 // Python object access through Pybind
 #include "apyfloatarray_iterator.h"
 #include "apytypes_common.h"
+#include "apytypes_profiling.h"
+#include "apytypes_simd.h"
 #include "apytypes_util.h"
 #include <cstddef>
 #include <iostream>
@@ -18,6 +20,7 @@ namespace nb = nanobind;
 #include "python_util.h"
 #include <algorithm>
 #include <fmt/format.h>
+#include <functional> // std::plus, std::multiplies, std::divides
 #include <iostream>
 #include <set>
 #include <stdexcept>
@@ -117,158 +120,110 @@ APyFloatArray APyFloatArray::operator+(const APyFloatArray& rhs) const
         return broadcast_to(broadcast_shape) + rhs.broadcast_to(broadcast_shape);
     }
 
+    APyGILRelease gil_release(data.size());
     const auto quantization = get_float_quantization_mode();
-    const bool is_to_neg = quantization == QuantizationMode::TRN;
-    // +5 to give room for leading one, carry, and 3 guard bits
-    const unsigned int max_man_bits = man_bits + 5;
-    if (same_type_as(rhs) && (max_man_bits <= _MAN_T_SIZE_BITS)
-        && (quantization != QuantizationMode::STOCH_WEIGHTED)) {
+
+    // Calculate new format
+    const auto res_exp_bits = std::max(exp_bits, rhs.exp_bits);
+    const auto res_man_bits = std::max(man_bits, rhs.man_bits);
+    const auto res_bias
+        = calc_bias(res_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias);
+
+    if (FloatOpTable::is_applicable(
+            exp_bits,
+            man_bits,
+            rhs.exp_bits,
+            rhs.man_bits,
+            res_exp_bits,
+            res_man_bits,
+            quantization,
+            data.size()
+        )) {
+        // Small formats, looked up in a table of all sums
+        APY_PROFILE_SCOPE("float.add.table", data.size());
+        APyFloatArray res(shape, res_exp_bits, res_man_bits, res_bias);
+        const auto table = FloatOpTable::get(
+            FloatTableOp::ADD,
+            exp_bits,
+            man_bits,
+            bias,
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        );
+        (*table)(data.data(), rhs.data.data(), res.data.data(), data.size());
+        return res;
+    }
+
+    if (same_type_as(rhs) && FloatAddKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.add.fast", data.size());
         // Result array
         APyFloatArray res(shape, exp_bits, man_bits, bias);
-
-        APyFloatData x, y;
         const exp_t res_max_exponent = ((1ULL << exp_bits) - 1);
-        const man_t final_res_leading_one = (1ULL << man_bits);
-        const man_t res_leading_one = final_res_leading_one << 3;
-        const man_t carry_res_leading_one = res_leading_one << 1;
-        const std::uint8_t tmp_man_bits
-            = man_bits + 4; // 4 for leading 1 and 3 guard bits
-        const auto shift_normalization_const = _MAN_T_SIZE_BITS - tmp_man_bits;
-        const auto man_mask = carry_res_leading_one - 1;
-        // Perform operation
-        for (std::size_t i = 0; i < data.size(); i++) {
-            x = data[i];
-            y = rhs.data[i];
-            bool x_is_zero_exponent = (x.exp == 0);
-            bool y_is_zero_exponent = (y.exp == 0);
-            // Handle zero cases
-            if (x_is_zero_exponent && x.man == 0) {
-                if (y_is_zero_exponent && y.man == 0) {
-                    y.sign = (x.sign == y.sign) ? x.sign : is_to_neg;
-                }
-                res.data[i] = y;
-                continue;
-            }
-            if (y_is_zero_exponent && y.man == 0) {
-                res.data[i] = x;
-                continue;
-            }
-            bool x_is_max_exponent = x.exp == res_max_exponent;
-            bool y_is_max_exponent = y.exp == res_max_exponent;
-
-            // Handle the NaN and inf cases
-            if (x_is_max_exponent || y_is_max_exponent) {
-                if ((x_is_max_exponent && x.man != 0)
-                    || (y_is_max_exponent && y.man != 0)
-                    || (x_is_max_exponent && y_is_max_exponent && x.sign != y.sign)) {
-                    // Set to NaN
-                    res.data[i] = { x.sign,
-                                    static_cast<exp_t>(res_max_exponent),
-                                    static_cast<man_t>(1) };
-                    continue;
-                }
+        const FloatAddKernel add(exp_bits, man_bits, quantization);
 
-                // Handle inf cases
-                if (x_is_max_exponent && x.man == 0) {
-                    // Set to inf
-                    res.data[i] = { x.sign,
-                                    static_cast<exp_t>(res_max_exponent),
-                                    static_cast<man_t>(0) };
-                    continue;
-                }
+        // Scalar kernel, computing element `i`
+        auto add_element
+            = [&](std::size_t i) { res.data[i] = add(data[i], rhs.data[i]); };
 
-                if (y_is_max_exponent && y.man == 0) {
-                    // Set to inf
-                    res.data[i] = { y.sign,
-                                    static_cast<exp_t>(res_max_exponent),
-                                    static_cast<man_t>(0) };
-                    continue;
+        // Perform operation
+        const auto native_format = native_float_format(exp_bits, man_bits, bias);
+        if (quantization == QuantizationMode::RND_CONV
+            && native_format != NativeFloatFormat::NONE) {
+            // Standard format, computed with native floating-point arithmetic
+            APY_PROFILE_SCOPE("float.add.native", data.size());
+            native_float_binary_op(
+                native_format,
+                data.data(),
+                rhs.data.data(),
+                res.data.data(),
+                data.size(),
+                std::plus<>(),
+                add_element
+            );
+        } else if (simd::float_quantization_is_vectorizable(quantization)) {
+            // Vectorized kernel for the normal numbers, with a scalar fixup of all
+            // other lanes
+            const simd::FloatAddConstants constants { man_bits,
+                                                      res_max_exponent,
+                                                      quantization };
+            simd::FloatTile tile;
+            for (std::size_t begin = 0; begin < data.size();
+                 begin += simd::_FLOAT_TILE_SIZE) {
+                const std::size_t size
+                    = std::min(simd::_FLOAT_TILE_SIZE, data.size() - begin);
+                tile.load(&data[begin], &rhs.data[begin], size);
+                simd::vector_float_add(tile, size, constants);
+                for (std::size_t i = 0; i < size; i++) {
+                    if (tile.fixup[i]) {
+                        add_element(begin + i);
+                    } else {
+                        res.data[begin + i] = tile.result(i);
+                    }
                 }
             }
-            // Compute sign and swap operands if need to make sure |x| >= |y|
-            if (x.exp < y.exp || (x.exp == y.exp && x.man < y.man)) {
-                std::swap(x, y);
-                std::swap(x_is_zero_exponent, y_is_zero_exponent);
-            } else if (x.sign != y.sign && x.exp == y.exp && x.man == y.man) {
-                // Set to zero
-                res.data[i]
-                    = { is_to_neg, static_cast<exp_t>(0), static_cast<man_t>(0) };
-                continue;
-            }
-
-            // Tentative exponent
-            exp_t new_exp = x.exp + x_is_zero_exponent;
-
-            // Conditionally add leading one's, also add room for guard bits
-            // Note that exp can never be res_max_exponent here
-            man_t mx = (x_is_zero_exponent ? 0 : res_leading_one) | (x.man << 3);
-            man_t my = (y_is_zero_exponent ? 0 : res_leading_one) | (y.man << 3);
-
-            // Align mantissas based on exponent difference
-            const unsigned exp_delta = new_exp - y.exp - y_is_zero_exponent;
-
-            // Align mantissa based on difference in exponent
-            man_t m_aligned;
-            if (exp_delta <= 3) {
-                m_aligned = my >> exp_delta;
-            } else if (exp_delta >= max_man_bits) {
-                m_aligned = (my >> max_man_bits) | 1;
-            } else {
-                m_aligned
-                    = (my >> exp_delta) | ((my << (_MAN_T_SIZE_BITS - exp_delta)) != 0);
-            }
-
-            // Perform addition / subtraction
-            man_t new_man = (x.sign == y.sign) ? mx + m_aligned : mx - m_aligned;
-
-            // Check for carry and cancellation
-            if (new_man & carry_res_leading_one) {
-                // Carry
-                new_exp++;
-            } else if (new_man & res_leading_one) {
-                // Align mantissa to carry case
-                new_man <<= 1;
-            } else {
-                // Cancellation or addition with subnormals
-                // Mantissa should be shifted until 1.xx is obtained or new_exp equals 0
-                const unsigned int man_leading_zeros = leading_zeros(new_man);
-                const unsigned int normalizing_shift
-                    = man_leading_zeros - shift_normalization_const;
-
-                if (new_exp > normalizing_shift) {
-                    new_man <<= normalizing_shift + 1;
-                    new_exp -= normalizing_shift;
-                } else {
-                    // The result will be a subnormal
-                    new_man <<= new_exp;
-                    new_exp = 0;
-                }
+        } else {
+            for (std::size_t i = 0; i < data.size(); i++) {
+                add_element(i);
             }
-
-            new_man &= man_mask;
-
-            quantize_mantissa(
-                new_man,
-                new_exp,
-                res_max_exponent,
-                4,
-                x.sign,
-                final_res_leading_one,
-                3,
-                7,
-                quantization
-            );
-
-            res.data[i]
-                = { x.sign, static_cast<exp_t>(new_exp), static_cast<man_t>(new_man) };
         }
         return res;
     }
-    // Calculate new format
-    const auto res_exp_bits = std::max(exp_bits, rhs.exp_bits);
-    const auto res_man_bits = std::max(man_bits, rhs.man_bits);
-    const auto res_bias
-        = calc_bias(res_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias);
+    if (same_type_as(rhs)
+        && WideFloatAddKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.add.wide", data.size());
+        APyFloatArray res(shape, exp_bits, man_bits, bias);
+        const WideFloatAddKernel add(exp_bits, man_bits, quantization);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            res.data[i] = add(data[i], rhs.data[i]);
+        }
+        return res;
+    }
+    APY_PROFILE_SCOPE("float.add.scalar_fallback", data.size());
     APyFloatArray res(shape, res_exp_bits, res_man_bits, res_bias);
 
     APyFloat lhs_scalar(exp_bits, man_bits, bias);
@@ -286,6 +241,7 @@ APyFloatArray APyFloatArray::operator+(const APyFloatArray& rhs) const
 
 APyFloatArray APyFloatArray::operator+(const APyFloat& rhs) const
 {
+    APyGILRelease gil_release(data.size());
     const auto quantization = get_float_quantization_mode();
     // +5 to give room for leading one, carry, and 3 guard bits
     const unsigned int max_man_bits = man_bits + 5;
@@ -531,6 +487,8 @@ APyFloatArray APyFloatArray::operator*(const APyFloatArray& rhs) const
         return broadcast_to(broadcast_shape) * rhs.broadcast_to(broadcast_shape);
     }
 
+    APyGILRelease gil_release(data.size());
+
     // Calculate new format
     const uint8_t res_exp_bits = std::max(exp_bits, rhs.exp_bits);
     const uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
@@ -553,147 +511,140 @@ void APyFloatArray::hadamard_multiplication(
     const QuantizationMode quantization
 ) const
 {
-    const int sum_man_bits = man_bits + rhs_man_bits;
-
-    if (unsigned(sum_man_bits) + 3 <= _MAN_T_SIZE_BITS) {
-        // Compute constants for reuse
-        const exp_t x_max_exponent = ((1ULL << exp_bits) - 1);
-        const exp_t y_max_exponent = ((1ULL << rhs_exp_bits) - 1);
-        const exp_t res_max_exponent = ((1ULL << res.exp_bits) - 1);
-        const uint8_t new_man_bits = sum_man_bits + 2;
-        const man_t two = 1ULL << new_man_bits;
-        const man_t two_before = two >> 1;
-        const man_t one_before = 1ULL << sum_man_bits;
-        const man_t two_res = 1 << res.man_bits;
-        const man_t mask_two = two - 1;
-        const uint8_t man_bits_delta = new_man_bits - res.man_bits;
-        const uint8_t man_bits_delta_dec = man_bits_delta - 1;
-        const man_t sticky_constant = (1ULL << man_bits_delta_dec) - 1;
-        const std::int64_t bias_sum = bias + rhs_bias - res.bias;
-
-        // Perform operation
-        for (std::size_t i = 0; i < data.size(); i++) {
-            const auto x = data[i];
-            const auto y = rhs[i];
-
-            // Calculate sign
-            const bool res_sign = x.sign ^ y.sign;
-
-            const bool x_is_subnormal = (x.exp == 0);
-            const bool x_is_maxexp = (x.exp == x_max_exponent);
-            const bool y_is_subnormal = (y.exp == 0);
-            const bool y_is_maxexp = (y.exp == y_max_exponent);
+    // Standard format of both operands and the result, if any, for which native
+    // floating-point arithmetic gives the same result
+    auto native_format = native_float_format(exp_bits, man_bits, bias);
+    if (quantization != QuantizationMode::RND_CONV
+        || native_format != native_float_format(rhs_exp_bits, rhs_man_bits, rhs_bias)
+        || native_format != native_float_format(res.exp_bits, res.man_bits, res.bias)) {
+        native_format = NativeFloatFormat::NONE;
+    }
 
-            // Handle special operands
-            if (x_is_maxexp || y_is_maxexp || x_is_subnormal || y_is_subnormal) {
-                const bool x_is_nan = (x_is_maxexp && x.man != 0);
-                const bool x_is_inf = (x_is_maxexp && x.man == 0);
-                const bool y_is_nan = (y_is_maxexp && y.man != 0);
-                const bool y_is_inf = (y_is_maxexp && y.man == 0);
-                const bool x_is_zero = (x_is_subnormal && x.man == 0);
-                const bool y_is_zero = (y_is_subnormal && y.man == 0);
-                if (x_is_nan || y_is_nan || (x_is_inf && y_is_zero)
-                    || (y_is_inf && x_is_zero)) {
-                    // Set to nan
-                    res.data[i] = { res_sign,
-                                    static_cast<exp_t>(res_max_exponent),
-                                    static_cast<man_t>(1) };
-                    continue;
-                }
+    if (FloatOpTable::is_applicable(
+            exp_bits,
+            man_bits,
+            rhs_exp_bits,
+            rhs_man_bits,
+            res.exp_bits,
+            res.man_bits,
+            quantization,
+            data.size()
+        )) {
+        // Small formats, looked up in a table of all products
+        APY_PROFILE_SCOPE("float.mul.table", data.size());
+        const auto table = FloatOpTable::get(
+            FloatTableOp::MUL,
+            exp_bits,
+            man_bits,
+            bias,
+            rhs_exp_bits,
+            rhs_man_bits,
+            rhs_bias,
+            res.exp_bits,
+            res.man_bits,
+            res.bias,
+            quantization
+        );
+        (*table)(data.data(), rhs, res.data.data(), data.size());
+    } else if (FloatProductKernel::is_applicable(man_bits, rhs_man_bits)) {
+        APY_PROFILE_SCOPE("float.mul.fast", data.size());
+        const FloatProductKernel product(
+            exp_bits,
+            man_bits,
+            bias,
+            rhs_exp_bits,
+            rhs_man_bits,
+            rhs_bias,
+            res.exp_bits,
+            res.man_bits,
+            res.bias,
+            quantization
+        );
 
-                if (x_is_inf || y_is_inf) {
-                    // Set to inf
-                    res.data[i] = { res_sign,
-                                    static_cast<exp_t>(res_max_exponent),
-                                    static_cast<man_t>(0) };
-                    continue;
-                }
+        // Scalar kernel, computing element `i`
+        auto mul_element
+            = [&](std::size_t i) { res.data[i] = product(data[i], rhs[i]); };
 
-                // x is zero or y is zero (and the other is not inf)
-                if (x_is_zero || y_is_zero) {
-                    // Set to zero
-                    res.data[i]
-                        = { res_sign, static_cast<exp_t>(0), static_cast<man_t>(0) };
-                    continue;
+        // Perform operation
+        if (native_format != NativeFloatFormat::NONE) {
+            // Standard format, computed with native floating-point arithmetic
+            APY_PROFILE_SCOPE("float.mul.native", data.size());
+            native_float_binary_op(
+                native_format,
+                data.data(),
+                rhs,
+                res.data.data(),
+                data.size(),
+                std::multiplies<>(),
+                mul_element
+            );
+        } else if (simd::float_quantization_is_vectorizable(quantization)) {
+            // Vectorized kernel for the normal numbers, with a scalar fixup of all
+            // other lanes
+            const simd::FloatMulConstants constants = product.simd_constants();
+            simd::FloatTile tile;
+            for (std::size_t begin = 0; begin < data.size();
+                 begin += simd::_FLOAT_TILE_SIZE) {
+                const std::size_t size
+                    = std::min(simd::_FLOAT_TILE_SIZE, data.size() - begin);
+                tile.load(&data[begin], &rhs[begin], size);
+                simd::vector_float_mul(tile, size, constants);
+                for (std::size_t i = 0; i < size; i++) {
+                    if (tile.fixup[i]) {
+                        mul_element(begin + i);
+                    } else {
+                        res.data[begin + i] = tile.result(i);
+                    }
                 }
             }
-
-            // Tentative exponent
-            std::int64_t tmp_exp = (std::int64_t)x.exp + x_is_subnormal
-                + (std::int64_t)y.exp + y_is_subnormal - bias_sum;
-            const man_t mx = (static_cast<man_t>(!x_is_subnormal) << man_bits) | x.man;
-            const man_t my
-                = (static_cast<man_t>(!y_is_subnormal) << rhs_man_bits) | y.man;
-
-            man_t new_man = mx * my;
-
-            // Check result from multiplication larger than/equal two
-            if (new_man & two_before) {
-                tmp_exp++;
-                new_man <<= 1;
-            } else if (new_man & one_before) {
-                // Align with longer result
-                new_man <<= 2;
-            } else {
-                // One or two of the operands were subnormal.
-                // If the exponent is positive, the result is normalized by
-                // left-shifting until the exponent is zero or the mantissa is 1.xx
-                const int leading_zeros = 1 + sum_man_bits - bit_width(new_man);
-                const int shift = std::max(
-                    std::min(tmp_exp, (std::int64_t)leading_zeros), (std::int64_t)0
-                );
-                tmp_exp -= shift;
-                // + 2 to align with longer result
-                new_man <<= shift + 2;
-            }
-
-            if (tmp_exp <= 0) {
-                if (tmp_exp < -static_cast<std::int64_t>(res.man_bits)) {
-                    // Exponent too small after rounding
-                    man_t res_man
-                        = quantize_close_to_zero(res_sign, new_man, quantization);
-                    res.data[i] = { res_sign, 0, res_man };
-                    continue;
-                }
-                // Shift and add sticky bit
-                new_man = (new_man >> (-tmp_exp + 1))
-                    | ((new_man & ((1 << (-tmp_exp + 1)) - 1)) != 0);
-                tmp_exp = 0;
+        } else {
+            for (std::size_t i = 0; i < data.size(); i++) {
+                mul_element(i);
             }
-
-            new_man &= mask_two;
-            exp_t new_exp = static_cast<exp_t>(tmp_exp);
-            quantize_mantissa(
-                new_man,
-                new_exp,
-                res_max_exponent,
-                man_bits_delta,
-                res_sign,
-                two_res,
-                man_bits_delta_dec,
-                sticky_constant,
-                quantization
-            );
-
-            res.data[i] = { res_sign,
-                            static_cast<exp_t>(new_exp),
-                            static_cast<man_t>(new_man) };
         }
     } else {
-        APyFloat lhs_scalar(exp_bits, man_bits, bias);
-        APyFloat rhs_scalar(rhs_exp_bits, rhs_man_bits, rhs_bias);
-        // Perform operation
-        for (std::size_t i = 0; i < data.size(); i++) {
-            lhs_scalar.set_data(data[i]);
-            rhs_scalar.set_data(rhs[i]);
+        // Wide mantissas, with the product of the mantissas in two words
+        APY_PROFILE_SCOPE("float.mul.wide", data.size());
+        const WideFloatProductKernel product(
+            exp_bits,
+            man_bits,
+            bias,
+            rhs_exp_bits,
+            rhs_man_bits,
+            rhs_bias,
+            res.exp_bits,
+            res.man_bits,
+            res.bias,
+            quantization
+        );
+        auto mul_element
+            = [&](std::size_t i) { res.data[i] = product(data[i], rhs[i]); };
 
-            res.data[i] = (lhs_scalar * rhs_scalar).get_data();
+        // Perform operation
+        if (native_format != NativeFloatFormat::NONE) {
+            // Standard format, computed with native floating-point arithmetic
+            APY_PROFILE_SCOPE("float.mul.native", data.size());
+            native_float_binary_op(
+                native_format,
+                data.data(),
+                rhs,
+                res.data.data(),
+                data.size(),
+                std::multiplies<>(),
+                mul_element
+            );
+        } else {
+            for (std::size_t i = 0; i < data.size(); i++) {
+                mul_element(i);
+            }
         }
     }
 }
 
 APyFloatArray APyFloatArray::operator*(const APyFloat& rhs) const
 {
+    APyGILRelease gil_release(data.size());
+
     // Calculate new format
     const auto res_exp_bits = std::max(exp_bits, rhs.get_exp_bits());
     const auto res_man_bits = std::max(man_bits, rhs.get_man_bits());
@@ -906,6 +857,8 @@ APyFloatArray APyFloatArray::operator/(const APyFloatArray& rhs) const
         return broadcast_to(broadcast_shape) / rhs.broadcast_to(broadcast_shape);
     }
 
+    APyGILRelease gil_release(data.size());
+
     // Calculate new format
     const auto res_exp_bits = std::max(exp_bits, rhs.exp_bits);
     const auto res_man_bits = std::max(man_bits, rhs.man_bits);
@@ -913,14 +866,71 @@ APyFloatArray APyFloatArray::operator/(const APyFloatArray& rhs) const
         = calc_bias(res_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias);
     APyFloatArray res(shape, res_exp_bits, res_man_bits, res_bias);
 
-    APyFloat lhs_scalar(exp_bits, man_bits, bias);
-    APyFloat rhs_scalar(rhs.exp_bits, rhs.man_bits, rhs.bias);
-    // Perform operation
-    for (std::size_t i = 0; i < data.size(); i++) {
-        lhs_scalar.set_data(data[i]);
-        rhs_scalar.set_data(rhs.data[i]);
+    const auto quantization = get_float_quantization_mode();
+    if (FloatOpTable::is_applicable(
+            exp_bits,
+            man_bits,
+            rhs.exp_bits,
+            rhs.man_bits,
+            res_exp_bits,
+            res_man_bits,
+            quantization,
+            data.size()
+        )) {
+        // Small formats, looked up in a table of all quotients
+        APY_PROFILE_SCOPE("float.div.table", data.size());
+        const auto table = FloatOpTable::get(
+            FloatTableOp::DIV,
+            exp_bits,
+            man_bits,
+            bias,
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            quantization
+        );
+        (*table)(data.data(), rhs.data.data(), res.data.data(), data.size());
+        return res;
+    }
 
-        res.data[i] = (lhs_scalar / rhs_scalar).get_data();
+    const FloatQuotientKernel quotient(
+        exp_bits,
+        man_bits,
+        bias,
+        rhs.exp_bits,
+        rhs.man_bits,
+        rhs.bias,
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        quantization
+    );
+    auto div_element
+        = [&](std::size_t i) { res.data[i] = quotient(data[i], rhs.data[i]); };
+
+    // Perform operation
+    const auto native_format = native_float_format(exp_bits, man_bits, bias);
+    if (same_type_as(rhs) && native_format != NativeFloatFormat::NONE
+        && quantization == QuantizationMode::RND_CONV) {
+        // Standard format, computed with native floating-point arithmetic
+        APY_PROFILE_SCOPE("float.div.native", data.size());
+        native_float_binary_op(
+            native_format,
+            data.data(),
+            rhs.data.data(),
+            res.data.data(),
+            data.size(),
+            std::divides<>(),
+            div_element
+        );
+    } else {
+        APY_PROFILE_SCOPE("float.div.fast", data.size());
+        for (std::size_t i = 0; i < data.size(); i++) {
+            div_element(i);
+        }
     }
 
     return res;
@@ -928,6 +938,8 @@ APyFloatArray APyFloatArray::operator/(const APyFloatArray& rhs) const
 
 APyFloatArray APyFloatArray::operator/(const APyFloat& rhs) const
 {
+    APyGILRelease gil_release(data.size());
+
     // Calculate new format
     const auto res_exp_bits = std::max(exp_bits, rhs.get_exp_bits());
     const auto res_man_bits = std::max(man_bits, rhs.get_man_bits());
@@ -935,11 +947,22 @@ APyFloatArray APyFloatArray::operator/(const APyFloat& rhs) const
         = calc_bias(res_exp_bits, exp_bits, bias, rhs.get_exp_bits(), rhs.get_bias());
     APyFloatArray res(shape, res_exp_bits, res_man_bits, res_bias);
 
-    APyFloat lhs_scalar(exp_bits, man_bits, bias);
+    const FloatQuotientKernel quotient(
+        exp_bits,
+        man_bits,
+        bias,
+        rhs.get_exp_bits(),
+        rhs.get_man_bits(),
+        rhs.get_bias(),
+        res_exp_bits,
+        res_man_bits,
+        res_bias,
+        get_float_quantization_mode()
+    );
+    const APyFloatData rhs_data = rhs.get_data();
     // Perform operations
     for (std::size_t i = 0; i < data.size(); i++) {
-        lhs_scalar.set_data(data[i]);
-        res.data[i] = (lhs_scalar / rhs).get_data();
+        res.data[i] = quotient(data[i], rhs_data);
     }
 
     return res;
@@ -947,6 +970,8 @@ APyFloatArray APyFloatArray::operator/(const APyFloat& rhs) const
 
 APyFloatArray APyFloatArray::rtruediv(const APyFloat& lhs) const
 {
+    APyGILRelease gil_release(data.size());
+
     // Calculate new format
     APyFloatArray res(
         shape,
@@ -967,6 +992,8 @@ APyFloatArray APyFloatArray::rtruediv(const APyFloat& lhs) const
 std::variant<APyFloatArray, APyFloat> APyFloatArray::matmul(const APyFloatArray& rhs
 ) const
 {
+    APyGILRelease gil_release(data.size() * (rhs.get_ndim() > 1 ? rhs.shape[1] : 1));
+
     if (get_ndim() == 1 && rhs.get_ndim() == 1) {
         if (shape[0] == rhs.shape[0]) {
             // Dimensionality for a standard scalar inner product checks out.
@@ -1051,6 +1078,96 @@ APyFloatArray::squeeze(std::optional<std::variant<nb::int_, nb::tuple>> axis) co
     return result;
 }
 
+//! Throw if the exact inner-product kernel can not be used for `lhs` and `rhs`
+static void check_exact_accumulation(
+    const APyFloatArray& lhs, const APyFloatArray& rhs, const char* fn_name
+)
+{
+    if (!FloatExactDotKernel::is_applicable(
+            lhs.get_exp_bits(),
+            lhs.get_man_bits(),
+            rhs.get_exp_bits(),
+            rhs.get_man_bits()
+        )) {
+        auto msg = fmt::format(
+            "APyFloatArray.{}: exact accumulation requires at most {} exponent bits, "
+            "and at most {} mantissa bits in total, for the operands",
+            fn_name,
+            _EXACT_DOT_MAX_EXP_BITS,
+            _MAN_T_SIZE_BITS - 3
+        );
+        throw nb::value_error(msg.c_str());
+    }
+}
+
+/*!
+ * Inner product of the `n` elements at `x` and `y`, of the formats of `lhs` and `rhs`,
+ * with the products and sums in the accumulator format `acc_exp_bits`,
+ * `acc_man_bits`, and `acc_bias`. Each operand is quantized to the accumulator format
+ * as it is read, which gives the same result as casting both operands, a Hadamard
+ * product, and `vector_sum`, without any temporary arrays. Used for the accumulator
+ * formats and quantization modes that `FloatDotKernel` does not support.
+ */
+static APyFloatData float_accumulator_inner_product(
+    const APyFloatData* x,
+    const APyFloatData* y,
+    std::size_t n,
+    const APyFloatArray& lhs,
+    const APyFloatArray& rhs,
+    std::uint8_t acc_exp_bits,
+    std::uint8_t acc_man_bits,
+    exp_t acc_bias,
+    QuantizationMode quantization
+)
+{
+    auto operand = [&](const APyFloatData& data, const APyFloatArray& src) {
+        return APyFloat(data, src.get_exp_bits(), src.get_man_bits(), src.get_bias())
+            ._cast(acc_exp_bits, acc_man_bits, acc_bias, quantization)
+            .get_data();
+    };
+    return with_float_product_kernel(
+        acc_exp_bits,
+        acc_man_bits,
+        acc_bias,
+        acc_exp_bits,
+        acc_man_bits,
+        acc_bias,
+        acc_exp_bits,
+        acc_man_bits,
+        acc_bias,
+        quantization,
+        [&](const auto& product) {
+            // Sequential sum of the products, as in `vector_sum`
+            auto accumulate = [&](auto&& sum) {
+                for (std::size_t i = 0; i < n && !sum.is_nan(); i++) {
+                    sum.add(product(operand(x[i], lhs), operand(y[i], rhs)));
+                }
+                return sum.get();
+            };
+            if (FloatSumKernel::is_applicable(acc_man_bits, quantization)) {
+                return accumulate(
+                    FloatSumKernel(acc_exp_bits, acc_man_bits, quantization)
+                );
+            }
+            if (WideFloatSumKernel::is_applicable(acc_man_bits, quantization)) {
+                return accumulate(
+                    WideFloatSumKernel(acc_exp_bits, acc_man_bits, quantization)
+                );
+            }
+            APyFloat sum(0, 0, 0, acc_exp_bits, acc_man_bits, acc_bias);
+            for (std::size_t i = 0; i < n; i++) {
+                sum += APyFloat(
+                    product(operand(x[i], lhs), operand(y[i], rhs)),
+                    acc_exp_bits,
+                    acc_man_bits,
+                    acc_bias
+                );
+            }
+            return sum.get_data();
+        }
+    );
+}
+
 //! Perform a linear convolution with `other` using `mode`
 APyFloatArray
 APyFloatArray::convolve(const APyFloatArray& other, const std::string& mode) const
@@ -1064,13 +1181,13 @@ APyFloatArray::convolve(const APyFloatArray& other, const std::string& mode) con
         throw nanobind::value_error(msg.c_str());
     }
 
-    // TODO: Add convolution support for accumulator contexts
-    if (get_accumulator_mode_float().has_value()) {
-        throw NotImplementedException(
-            "APyFloatArray convolve with accumulator context not implemented"
-        );
+    const auto acc_mode = get_accumulator_mode_float();
+    if (acc_mode.has_value() && acc_mode->exact) {
+        check_exact_accumulation(*this, other, "convolve");
     }
 
+    APyGILRelease gil_release(shape[0] * other.shape[0]);
+
     // Find the shorter array of `*this` and `other` based on length.
     bool swap = shape[0] < other.shape[0];
 
@@ -1086,47 +1203,165 @@ APyFloatArray::convolve(const APyFloatArray& other, const std::string& mode) con
     // Extract convolution properties
     auto [len, n_left, n_right] = get_conv_lengths(mode, a, b);
 
-    auto acc_mode = get_accumulator_mode_float();
-
-    // Result vector
-    const int res_exp_bits
-        = acc_mode ? acc_mode->exp_bits : std::max(a->exp_bits, b->exp_bits);
-    const int res_man_bits
-        = acc_mode ? acc_mode->man_bits : std::max(a->man_bits, b->man_bits);
-    const int res_bias = acc_mode.has_value() && acc_mode->bias.has_value()
-        ? *acc_mode->bias
-        : calc_bias(res_exp_bits, a->exp_bits, a->bias, b->exp_bits, b->bias);
+    // Result vector. As for `__matmul__`, the sums of an accumulator are quantized
+    // back to the result format.
+    const std::uint8_t res_exp_bits = std::max(a->exp_bits, b->exp_bits);
+    const std::uint8_t res_man_bits = std::max(a->man_bits, b->man_bits);
+    const exp_t res_bias
+        = calc_bias(res_exp_bits, a->exp_bits, a->bias, b->exp_bits, b->bias);
     APyFloatArray result({ len }, res_exp_bits, res_man_bits, res_bias);
 
-    // Loop working variables
-    std::size_t n = b->shape[0] - n_left;
-    auto dst = std::begin(result.data);
-    auto src1 = std::cbegin(a->data);
-    auto src2 = std::cbegin(b->data) + n_left;
+    // The `k`-th output sample is the inner product of the `n` elements starting at
+    // `a->data[a_begin]` and `b->data[b_begin]`
+    const std::size_t a_len = a->shape[0];
+    const std::size_t b_len = b->shape[0];
+    auto output_window = [&](std::size_t k) {
+        std::size_t a_begin = 0, b_begin = 0, n = b_len;
+        if (k < n_left) {
+            b_begin = n_left - k;
+            n = b_len - b_begin;
+        } else {
+            a_begin = k - n_left;
+            n = std::min(b_len, a_len - a_begin);
+        }
+        return std::make_tuple(a_begin, b_begin, n);
+    };
 
-    // `b` limits length of the inner product length
-    for (std::size_t i = 0; i < n_left; i++) {
-        float_inner_product(src1, src2, dst, *a, *b, n);
-        src2--;
-        dst++;
-        n++;
-    }
+    // Output samples computed by the inner-product kernel `dot` into `dst`,
+    // distributed over threads
+    auto convolve_fused = [&](const APyFloatArray& x,
+                              const APyFloatArray& y,
+                              APyFloatData* dst,
+                              const auto& dot) {
+        using scratch_t = typename std::decay_t<decltype(dot)>::scratch_t;
+        auto compute_samples = [&](std::size_t begin, std::size_t end) {
+            scratch_t scratch;
+            for (std::size_t k = begin; k < end; k++) {
+                auto [a_begin, b_begin, n] = output_window(k);
+                dst[k] = dot(&x.data[a_begin], &y.data[b_begin], n, scratch);
+            }
+        };
+        parallel_for(len, len * b_len, compute_samples);
+    };
 
-    // full inner product length
-    for (std::size_t i = 0; i < a->shape[0] - b->shape[0] + 1; i++) {
-        float_inner_product(src1, src2, dst, *a, *b, n);
-        src1++;
-        dst++;
+    // Exact accumulator, with the products accumulated in the result format
+    if (acc_mode.has_value() && acc_mode->exact) {
+        APY_PROFILE_SCOPE("float.convolve.exact", len * b_len);
+        const FloatExactDotKernel dot(
+            a->exp_bits,
+            a->man_bits,
+            a->bias,
+            b->exp_bits,
+            b->man_bits,
+            b->bias,
+            res_exp_bits,
+            res_man_bits,
+            res_bias,
+            acc_mode->quantization
+        );
+        convolve_fused(*a, *b, result.data.data(), dot);
+        return result;
     }
 
-    // `a` limits length of the inner product length
-    for (std::size_t i = 0; i < n_right; i++) {
-        n--;
-        float_inner_product(src1, src2, dst, *a, *b, n);
-        src1++;
-        dst++;
+    // Format of the products and the sums, and their quantization mode
+    const auto quantization
+        = acc_mode.has_value() ? acc_mode->quantization : get_float_quantization_mode();
+    const std::uint8_t sum_exp_bits
+        = acc_mode.has_value() ? acc_mode->exp_bits : res_exp_bits;
+    const std::uint8_t sum_man_bits
+        = acc_mode.has_value() ? acc_mode->man_bits : res_man_bits;
+    const exp_t sum_bias = acc_mode.has_value()
+        ? acc_mode->bias.value_or(
+              calc_bias(sum_exp_bits, a->exp_bits, a->bias, b->exp_bits, b->bias)
+          )
+        : res_bias;
+    const bool is_fused = acc_mode.has_value()
+        ? FloatDotKernel::is_applicable(
+              sum_man_bits, sum_man_bits, sum_man_bits, quantization
+          )
+        : FloatDotKernel::is_applicable(
+              a->man_bits, b->man_bits, sum_man_bits, quantization
+          );
+
+    if (is_fused) {
+        APY_PROFILE_SCOPE("float.convolve.fused", len * b_len);
+
+        // If an accumulator is used, the operands are quantized to the accumulator
+        // format by the kernel, before the multiplication
+        const FloatDotKernel dot(
+            a->exp_bits,
+            a->man_bits,
+            a->bias,
+            b->exp_bits,
+            b->man_bits,
+            b->bias,
+            sum_exp_bits,
+            sum_man_bits,
+            sum_bias,
+            quantization,
+            len * b_len,
+            acc_mode.has_value()
+        );
+
+        // The sums must be quantized back if an accumulator was used
+        const bool is_result_format = sum_exp_bits == res_exp_bits
+            && sum_man_bits == res_man_bits && sum_bias == res_bias;
+        std::vector<APyFloatData> sums(is_result_format ? 0 : len);
+        convolve_fused(
+            *a, *b, is_result_format ? result.data.data() : sums.data(), dot
+        );
+        if (!is_result_format) {
+            float_cast(
+                sums.data(),
+                result.data.data(),
+                len,
+                sum_exp_bits,
+                sum_man_bits,
+                sum_bias,
+                res_exp_bits,
+                res_man_bits,
+                res_bias,
+                quantization
+            );
+        }
+        return result;
     }
 
+    APY_PROFILE_SCOPE("float.convolve.scalar_fallback", len * b_len);
+    for (std::size_t k = 0; k < len; k++) {
+        auto [a_begin, b_begin, n] = output_window(k);
+        if (acc_mode.has_value()) {
+            // Inner product of the overlapping windows, with the accumulator
+            const APyFloat sum(
+                float_accumulator_inner_product(
+                    &a->data[a_begin],
+                    &b->data[b_begin],
+                    n,
+                    *a,
+                    *b,
+                    sum_exp_bits,
+                    sum_man_bits,
+                    sum_bias,
+                    quantization
+                ),
+                sum_exp_bits,
+                sum_man_bits,
+                sum_bias
+            );
+            result.data[k]
+                = sum._cast(res_exp_bits, res_man_bits, res_bias, quantization)
+                      .get_data();
+        } else {
+            float_inner_product(
+                std::cbegin(a->data) + a_begin,
+                std::cbegin(b->data) + b_begin,
+                std::begin(result.data) + k,
+                *a,
+                *b,
+                n
+            );
+        }
+    }
     return result;
 }
 
@@ -1151,6 +1386,8 @@ std::variant<APyFloatArray, APyFloat> APyFloatArray::prod_sum_function(
         axes_set.insert(shape.size());
     }
 
+    APyGILRelease gil_release(data.size());
+
     // Resulting vector
     APyFloatArray result(shape, exp_bits, man_bits);
     APyFloatArray source(shape, exp_bits, man_bits);
@@ -1198,56 +1435,131 @@ std::variant<APyFloatArray, APyFloat> APyFloatArray::prod_sum_function(
 }
 
 APyFloatArray APyFloatArray::cumulative_prod_sum_function(
-    void (*pos_func)(std::size_t, std::size_t, std::size_t, APyFloatArray&, APyFloatArray&, APyFloat&, APyFloat&),
-    std::optional<nb::int_> axis
+    bool is_prod, bool ignore_nan, std::optional<nb::int_> axis
 ) const
 {
-    // determine input value
-    // if no input is received _shape.size() will be used
-    std::size_t _axis = shape.size();
-    if (axis.has_value()) {
-        _axis = std::size_t(axis.value());
-        if (_axis >= shape.size()) {
-            throw nb::index_error(
-                "specified axis outside number of dimensions in the APyFloatArray"
-            );
-        }
-    }
+    auto [res_shape, sections, elements, stride]
+        = get_cumulative_geometry(shape, axis, "APyFloatArray");
 
-    // initialize variables used for the summation or multiplication
-    // and determine the new shape
-    std::size_t elements = data.size();
-    std::size_t res_nitems = data.size();
-    std::vector<std::size_t> shape_ = { data.size() };
-    if (_axis < shape.size()) {
-        elements = shape.at(_axis);
-        shape_ = shape;
-    }
+    APyGILRelease gil_release(data.size());
 
-    // temporary vector and source vector.
-    // the source vector will also contain the result after the summation or
-    // multiplication are performed
-    APyFloatArray temp(shape, exp_bits, man_bits);
-    APyFloatArray source(shape, exp_bits, man_bits);
-    std::copy_n(data.begin(), data.size(), source.data.begin());
+    APyFloatArray result(res_shape, exp_bits, man_bits, bias);
+    const auto quantization = get_float_quantization_mode();
 
-    // temporary APyFloat used for the arithmetic later on
-    APyFloat lhs_scalar(exp_bits, man_bits, bias);
-    APyFloat rhs_scalar(exp_bits, man_bits, bias);
+    // The identity of the operation replaces NaN elements, if `ignore_nan` is set
+    const exp_t max_exponent = exp_t((1ULL << exp_bits) - 1);
+    const APyFloatData identity = is_prod ? APyFloatData { 0, exp_t(bias), 0 }
+                                          : APyFloatData { 0, 0, 0 };
+    auto element = [&](std::size_t i) -> const APyFloatData& {
+        const APyFloatData& x = data[i];
+        return ignore_nan && x.exp == max_exponent && x.man != 0 ? identity : x;
+    };
+
+    // Stochastic quantization draws random numbers on the calling thread, so the
+    // lanes are only distributed over threads for the deterministic modes
+    const std::size_t section_items = elements * stride;
+    const std::size_t work
+        = simd::float_quantization_is_vectorizable(quantization) ? data.size() : 0;
+
+    // Scan of the lanes with a sum kernel, `FloatSumKernel` or `WideFloatSumKernel`
+    auto cumsum_with = [&](const auto& kernel) {
+        auto scan_block = [&](std::size_t section,
+                              std::size_t lane_begin,
+                              std::size_t lane_end) {
+            auto sum = kernel;
+            for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+                sum.reset();
+                for (std::size_t row = 0; row < elements; row++) {
+                    const std::size_t i = section * section_items + row * stride + lane;
+                    sum.add(element(i));
+                    result.data[i] = sum.get();
+                }
+            }
+        };
+        cumulative_for_each_block(sections, stride, work, scan_block);
+    };
+
+    // Scan of the lanes with a product kernel, `FloatProductKernel` or
+    // `WideFloatProductKernel`
+    auto cumprod_with = [&](const auto& product) {
+        auto scan_block = [&](std::size_t section,
+                              std::size_t lane_begin,
+                              std::size_t lane_end) {
+            for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+                const std::size_t first = section * section_items + lane;
+                result.data[first] = element(first);
+                for (std::size_t row = 1; row < elements; row++) {
+                    const std::size_t i = first + row * stride;
+                    result.data[i] = product(result.data[i - stride], element(i));
+                }
+            }
+        };
+        cumulative_for_each_block(sections, stride, work, scan_block);
+    };
 
-    // get the stride
-    std::size_t stride = strides_from_shape(shape)[_axis];
-    if (_axis == shape.size()) {
-        stride = 1;
+    if (!is_prod && FloatSumKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.cumsum.fast", data.size());
+        cumsum_with(FloatSumKernel(exp_bits, man_bits, quantization));
+        return result;
     }
-    // perform the summation or multiplication and place result in 'result'
-    for (std::size_t i = 0; i < temp.data.size(); i++) {
-        pos_func(i, stride, elements, source, temp, lhs_scalar, rhs_scalar);
+    if (!is_prod && WideFloatSumKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.cumsum.wide", data.size());
+        cumsum_with(WideFloatSumKernel(exp_bits, man_bits, quantization));
+        return result;
     }
-    // copy the elements into a new array to get the correct shape
-    APyFloatArray result2(shape_, exp_bits, man_bits);
-    std::copy_n(temp.data.begin(), res_nitems, result2.data.begin());
-    return result2;
+
+    if (is_prod && FloatProductKernel::is_applicable(man_bits, man_bits)) {
+        APY_PROFILE_SCOPE("float.cumprod.fast", data.size());
+        cumprod_with(FloatProductKernel(
+            exp_bits,
+            man_bits,
+            bias,
+            exp_bits,
+            man_bits,
+            bias,
+            exp_bits,
+            man_bits,
+            bias,
+            quantization
+        ));
+        return result;
+    }
+    if (is_prod) {
+        APY_PROFILE_SCOPE("float.cumprod.wide", data.size());
+        cumprod_with(WideFloatProductKernel(
+            exp_bits,
+            man_bits,
+            bias,
+            exp_bits,
+            man_bits,
+            bias,
+            exp_bits,
+            man_bits,
+            bias,
+            quantization
+        ));
+        return result;
+    }
+
+    // Scalar fallback of sums with quantization mode `STOCH_WEIGHTED`
+    APY_PROFILE_SCOPE("float.cumsum.scalar_fallback", data.size());
+    auto scan_block = [&](std::size_t section,
+                          std::size_t lane_begin,
+                          std::size_t lane_end) {
+        APyFloat acc(exp_bits, man_bits, bias);
+        APyFloat x(exp_bits, man_bits, bias);
+        for (std::size_t lane = lane_begin; lane < lane_end; lane++) {
+            acc = APyFloat(0, 0, 0, exp_bits, man_bits, bias);
+            for (std::size_t row = 0; row < elements; row++) {
+                const std::size_t i = section * section_items + row * stride + lane;
+                x.set_data(element(i));
+                acc = acc + x;
+                result.data[i] = acc.get_data();
+            }
+        }
+    };
+    cumulative_for_each_block(sections, stride, 0, scan_block);
+    return result;
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1276,26 +1588,7 @@ APyFloatArray::sum(std::optional<std::variant<nb::tuple, nb::int_>> axis) const
 
 APyFloatArray APyFloatArray::cumsum(std::optional<nb::int_> axis) const
 {
-    auto pos_func = [](std::size_t i,
-                       std::size_t sec_length,
-                       std::size_t elements,
-                       APyFloatArray& src,
-                       APyFloatArray& dst,
-                       APyFloat& lhs_scalar,
-                       APyFloat& rhs_scalar) {
-        // calculate new position
-        std::size_t pos = i - sec_length;
-        if (i % (sec_length * elements) < sec_length) {
-            pos = i;
-        }
-
-        // perform addition
-        lhs_scalar.set_data(dst.data.at(pos));
-        rhs_scalar.set_data(src.data.at(i));
-        dst.data[i] = (lhs_scalar + rhs_scalar).get_data();
-    };
-
-    return cumulative_prod_sum_function(pos_func, axis);
+    return cumulative_prod_sum_function(false, false, axis);
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1328,29 +1621,7 @@ APyFloatArray::nansum(std::optional<std::variant<nb::tuple, nb::int_>> axis) con
 
 APyFloatArray APyFloatArray::nancumsum(std::optional<nb::int_> axis) const
 {
-    auto pos_func = [](std::size_t i,
-                       std::size_t sec_length,
-                       std::size_t elements,
-                       APyFloatArray& src,
-                       APyFloatArray& dst,
-                       APyFloat& lhs_scalar,
-                       APyFloat& rhs_scalar) {
-        // calculate new position
-        std::size_t pos = i - sec_length;
-        if (i % (sec_length * elements) < sec_length) {
-            pos = i;
-        }
-
-        // perform addition
-        lhs_scalar.set_data(dst.data.at(pos));
-        rhs_scalar.set_data(src.data.at(i));
-        if (rhs_scalar.is_nan()) {
-            rhs_scalar.set_data({ 0, 0, 0 });
-        }
-        dst.data[i] = (lhs_scalar + rhs_scalar).get_data();
-    };
-
-    return cumulative_prod_sum_function(pos_func, axis);
+    return cumulative_prod_sum_function(false, true, axis);
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1386,27 +1657,7 @@ APyFloatArray::prod(std::optional<std::variant<nb::tuple, nb::int_>> axis) const
 
 APyFloatArray APyFloatArray::cumprod(std::optional<nb::int_> axis) const
 {
-    auto pos_func = [](std::size_t i,
-                       std::size_t sec_length,
-                       std::size_t elements,
-                       APyFloatArray& src,
-                       APyFloatArray& dst,
-                       APyFloat& lhs_scalar,
-                       APyFloat& rhs_scalar) {
-        // calculate new position
-        if (i % (sec_length * elements) < sec_length) {
-            dst.data.at(i) = src.data.at(i);
-            return;
-        }
-        std::size_t pos = i - sec_length;
-        lhs_scalar.set_data(dst.data.at(pos));
-        rhs_scalar.set_data(src.data.at(i));
-
-        // perform multiplication
-        dst.data[i] = (lhs_scalar * rhs_scalar).get_data();
-    };
-
-    return cumulative_prod_sum_function(pos_func, axis);
+    return cumulative_prod_sum_function(true, false, axis);
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1438,44 +1689,18 @@ APyFloatArray::nanprod(std::optional<std::variant<nb::tuple, nb::int_>> axis) co
             lhs_scalar.set_data({ 0, lhs_scalar.get_bias(), 0 });
         }
         if (rhs_scalar.is_nan()) {
-            rhs_scalar.set_data({ 0, rhs_scalar.get_bias(), 0 });
-        }
-        // perform multiplication
-        dst.data[pos] = (lhs_scalar * rhs_scalar).get_data();
-    };
-
-    return prod_sum_function(pos_func, axis);
-}
-
-APyFloatArray APyFloatArray::nancumprod(std::optional<nb::int_> axis) const
-{
-    auto pos_func = [](std::size_t i,
-                       std::size_t sec_length,
-                       std::size_t elements,
-                       APyFloatArray& src,
-                       APyFloatArray& dst,
-                       APyFloat& lhs_scalar,
-                       APyFloat& rhs_scalar) {
-        // get source data for the multiplication
-        rhs_scalar.set_data(src.data.at(i));
-        if (rhs_scalar.is_nan()) {
-            rhs_scalar.set_data({ 0, rhs_scalar.get_bias(), 0 });
-        }
-        // if its the first in a multiplicatiojn chain we can assign it directly
-        if (i % (sec_length * elements) < sec_length) {
-            dst.data.at(i) = rhs_scalar.get_data();
-            return;
+            rhs_scalar.set_data({ 0, rhs_scalar.get_bias(), 0 });
         }
-        // get temporary data for the multiplication
-        // calculate new position
-        std::size_t pos = i - sec_length;
-        lhs_scalar.set_data(dst.data.at(pos));
-
         // perform multiplication
-        dst.data[i] = (lhs_scalar * rhs_scalar).get_data();
+        dst.data[pos] = (lhs_scalar * rhs_scalar).get_data();
     };
 
-    return cumulative_prod_sum_function(pos_func, axis);
+    return prod_sum_function(pos_func, axis);
+}
+
+APyFloatArray APyFloatArray::nancumprod(std::optional<nb::int_> axis) const
+{
+    return cumulative_prod_sum_function(true, true, axis);
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1751,10 +1976,13 @@ nb::ndarray<nb::numpy, double> APyFloatArray::to_numpy() const
 {
     // Dynamically allocate data to be passed to python
     double* result_data = new double[data.size()];
-    auto apy_f = APyFloat(exp_bits, man_bits, bias);
-    for (std::size_t i = 0; i < data.size(); i++) {
-        apy_f.set_data(data[i]);
-        result_data[i] = apy_f.to_double();
+    {
+        APyGILRelease gil_release(data.size());
+        auto apy_f = APyFloat(exp_bits, man_bits, bias);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            apy_f.set_data(data[i]);
+            result_data[i] = apy_f.to_double();
+        }
     }
 
     // Delete 'data' when the 'owner' capsule expires
@@ -1764,6 +1992,76 @@ nb::ndarray<nb::numpy, double> APyFloatArray::to_numpy() const
     return nb::ndarray<nb::numpy, double>(result_data, ndim, &shape[0], owner);
 }
 
+std::tuple<
+    nb::ndarray<nb::numpy, std::uint8_t>,
+    nb::ndarray<nb::numpy, exp_t>,
+    nb::ndarray<nb::numpy, man_t>>
+APyFloatArray::_get_fields() const
+{
+    // Dynamically allocate data to be passed to python
+    std::uint8_t* sign_data = new std::uint8_t[data.size()];
+    exp_t* exp_data = new exp_t[data.size()];
+    man_t* man_data = new man_t[data.size()];
+    for (std::size_t i = 0; i < data.size(); i++) {
+        sign_data[i] = std::uint8_t(data[i].sign);
+        exp_data[i] = data[i].exp;
+        man_data[i] = data[i].man;
+    }
+
+    // Delete the fields when the 'owner' capsules expire
+    nb::capsule sign_owner(sign_data, [](void* p) noexcept {
+        delete[] (std::uint8_t*)p;
+    });
+    nb::capsule exp_owner(exp_data, [](void* p) noexcept { delete[] (exp_t*)p; });
+    nb::capsule man_owner(man_data, [](void* p) noexcept { delete[] (man_t*)p; });
+
+    std::size_t ndim = shape.size();
+    return {
+        nb::ndarray<nb::numpy, std::uint8_t>(sign_data, ndim, &shape[0], sign_owner),
+        nb::ndarray<nb::numpy, exp_t>(exp_data, ndim, &shape[0], exp_owner),
+        nb::ndarray<nb::numpy, man_t>(man_data, ndim, &shape[0], man_owner),
+    };
+}
+
+//! Pack `src` into a NumPy array of bit patterns of type `T`
+template <typename T>
+static nb::object packed_bits_ndarray(
+    const std::vector<APyFloatData>& src,
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits
+)
+{
+    T* dst = new T[src.size()];
+    {
+        APyGILRelease gil_release(src.size());
+        for (std::size_t i = 0; i < src.size(); i++) {
+            dst[i] = pack_float_data<T>(src[i], exp_bits, man_bits);
+        }
+    }
+
+    // Delete the bit patterns when the 'owner' capsule expires
+    nb::capsule owner(dst, [](void* p) noexcept { delete[] (T*)p; });
+    return nb::cast(nb::ndarray<nb::numpy, T>(dst, shape.size(), shape.data(), owner));
+}
+
+nb::object APyFloatArray::to_bits() const
+{
+    const int bits = get_bits();
+    if (bits <= 8) {
+        return packed_bits_ndarray<std::uint8_t>(data, shape, exp_bits, man_bits);
+    } else if (bits <= 16) {
+        return packed_bits_ndarray<std::uint16_t>(data, shape, exp_bits, man_bits);
+    } else if (bits <= 32) {
+        return packed_bits_ndarray<std::uint32_t>(data, shape, exp_bits, man_bits);
+    } else if (bits <= 64) {
+        return packed_bits_ndarray<std::uint64_t>(data, shape, exp_bits, man_bits);
+    }
+    throw nb::value_error(
+        "APyFloatArray.to_bits(): formats wider than 64 bits are not supported"
+    );
+}
+
 bool APyFloatArray::is_identical(const APyFloatArray& other) const
 {
     const bool same_spec = (shape == other.shape) && (exp_bits == other.exp_bits)
@@ -1837,7 +2135,112 @@ APyFloatArray APyFloatArray::from_array(
     }
 
     APyFloatArray result(shape, exp_bits, man_bits, bias);
-    result._set_values_from_ndarray(ndarray);
+    {
+        APyGILRelease gil_release(result.data.size());
+        result._set_values_from_ndarray(ndarray);
+    }
+    return result;
+}
+
+APyFloatArray APyFloatArray::from_bits(
+    const nb::ndarray<nb::c_contig>& bit_patterns,
+    int exp_bits,
+    int man_bits,
+    std::optional<exp_t> bias
+)
+{
+    check_exponent_format(exp_bits);
+    check_mantissa_format(man_bits);
+
+    const int bits = 1 + exp_bits + man_bits;
+    if (bits > 64) {
+        throw nb::value_error(
+            "APyFloatArray.from_bits(): formats wider than 64 bits are not supported"
+        );
+    }
+
+    const std::size_t ndim = bit_patterns.ndim();
+    if (ndim == 0) {
+        throw nb::value_error(
+            "APyFloatArray.from_bits(): NDArray with ndim == 0 not supported"
+        );
+    }
+    std::vector<std::size_t> shape(ndim, 0);
+    for (std::size_t i = 0; i < ndim; i++) {
+        shape[i] = bit_patterns.shape(i);
+    }
+
+    APyFloatArray result(shape, exp_bits, man_bits, bias);
+
+    // Signed bit patterns are read as the unsigned type of the same width
+    const auto try_unpack = [&](auto zero) {
+        using T = decltype(zero);
+        if (bit_patterns.dtype() != nb::dtype<T>()
+            && bit_patterns.dtype() != nb::dtype<std::make_signed_t<T>>()) {
+            return false;
+        }
+        if (int(8 * sizeof(T)) < bits) {
+            throw nb::value_error(fmt::format(
+                "APyFloatArray.from_bits(): {}-bit format does not fit in a {}-bit "
+                "dtype",
+                bits,
+                8 * sizeof(T)
+            )
+                                      .c_str());
+        }
+        const T* src = static_cast<const T*>(bit_patterns.data());
+        APyGILRelease gil_release(result.data.size());
+        for (std::size_t i = 0; i < result.data.size(); i++) {
+            result.data[i] = unpack_float_data<T>(src[i], exp_bits, man_bits);
+        }
+        return true;
+    };
+    if (!try_unpack(std::uint8_t(0)) && !try_unpack(std::uint16_t(0))
+        && !try_unpack(std::uint32_t(0)) && !try_unpack(std::uint64_t(0))) {
+        throw nb::type_error("APyFloatArray.from_bits(): expected an integer ndarray");
+    }
+    return result;
+}
+
+APyFloatArray APyFloatArray::_from_fields(
+    const nb::ndarray<const std::uint8_t, nb::c_contig>& sign,
+    const nb::ndarray<const exp_t, nb::c_contig>& exp,
+    const nb::ndarray<const man_t, nb::c_contig>& man,
+    int exp_bits,
+    int man_bits,
+    exp_t bias
+)
+{
+    check_exponent_format(exp_bits);
+    check_mantissa_format(man_bits);
+
+    const std::size_t ndim = sign.ndim();
+    std::vector<std::size_t> shape(ndim, 0);
+    for (std::size_t i = 0; i < ndim; i++) {
+        shape[i] = sign.shape(i);
+    }
+    bool same_shape = ndim > 0 && exp.ndim() == ndim && man.ndim() == ndim;
+    for (std::size_t i = 0; same_shape && i < ndim; i++) {
+        same_shape = std::size_t(exp.shape(i)) == shape[i]
+            && std::size_t(man.shape(i)) == shape[i];
+    }
+    if (!same_shape) {
+        throw nb::value_error(
+            "APyFloatArray._from_fields(): sign, exp, and man must have the same shape"
+        );
+    }
+
+    const exp_t max_exp = exp_t((std::uint64_t(1) << exp_bits) - 1);
+    const man_t max_man = man_t((man_t(1) << man_bits) - 1);
+    APyFloatArray result(shape, exp_bits, man_bits, bias);
+    for (std::size_t i = 0; i < result.data.size(); i++) {
+        if (exp.data()[i] > max_exp || man.data()[i] > max_man) {
+            throw nb::value_error(
+                "APyFloatArray._from_fields(): field out of range for the format"
+            );
+        }
+        result.data[i] = { sign.data()[i] != 0, exp.data()[i], man.data()[i] };
+    }
     return result;
 }
 
@@ -1900,6 +2303,7 @@ APyFloatArray APyFloatArray::broadcast_to(const std::vector<std::size_t> shape)
                 .c_str()
         );
     }
+    APY_PROFILE_SCOPE("float.broadcast", ::fold_shape(shape));
     APyFloatArray result(shape, exp_bits, man_bits, bias);
     broadcast_data_copy(data.begin(), result.data.begin(), this->shape, shape);
     return result;
@@ -2030,21 +2434,27 @@ APyFloatArray APyFloatArray::_cast(
         return *this;
     }
 
+    APyGILRelease gil_release(data.size());
+
     // If longer word lengths, use simpler/faster method
     if (new_exp_bits >= exp_bits && new_man_bits >= man_bits) {
         return cast_no_quant(new_exp_bits, new_man_bits, new_bias);
     }
 
+    APY_PROFILE_SCOPE("float.cast.quantize", data.size());
     APyFloatArray result(shape, new_exp_bits, new_man_bits, new_bias);
-
-    APyFloat caster(exp_bits, man_bits, bias);
-    for (std::size_t i = 0; i < data.size(); i++) {
-        caster.set_data(data[i]);
-        result.data[i]
-            = caster._checked_cast(new_exp_bits, new_man_bits, new_bias, quantization)
-                  .get_data();
-    }
-
+    float_cast(
+        data.data(),
+        result.data.data(),
+        data.size(),
+        exp_bits,
+        man_bits,
+        bias,
+        new_exp_bits,
+        new_man_bits,
+        new_bias,
+        quantization
+    );
     return result;
 }
 
@@ -2052,15 +2462,19 @@ APyFloatArray APyFloatArray::cast_no_quant(
     std::uint8_t new_exp_bits, std::uint8_t new_man_bits, std::optional<exp_t> new_bias
 ) const
 {
+    APY_PROFILE_SCOPE("float.cast.widen", data.size());
     APyFloatArray result(shape, new_exp_bits, new_man_bits, new_bias);
-
-    APyFloat caster(exp_bits, man_bits, bias);
-    for (std::size_t i = 0; i < data.size(); i++) {
-        caster.set_data(data[i]);
-        result.data[i]
-            = caster.cast_no_quant(new_exp_bits, new_man_bits, new_bias).get_data();
-    }
-
+    float_cast_no_quant(
+        data.data(),
+        result.data.data(),
+        data.size(),
+        exp_bits,
+        man_bits,
+        bias,
+        new_exp_bits,
+        new_man_bits,
+        result.bias
+    );
     return result;
 }
 
@@ -2079,7 +2493,34 @@ APyFloat APyFloatArray::checked_inner_product(
     const std::uint8_t max_man_bits
 ) const
 {
-    // No accumulator context set
+    // Exact accumulator
+    if (accumulator_mode.has_value() && accumulator_mode->exact) {
+        check_exact_accumulation(*this, rhs, "__matmul__");
+        APY_PROFILE_SCOPE("float.dot.exact", data.size());
+        const auto res_bias
+            = calc_bias(max_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias);
+        const FloatExactDotKernel dot(
+            exp_bits,
+            man_bits,
+            bias,
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            max_exp_bits,
+            max_man_bits,
+            res_bias,
+            accumulator_mode->quantization
+        );
+        FloatExactDotKernel::scratch_t acc;
+        return APyFloat(
+            dot(data.data(), rhs.data.data(), data.size(), acc),
+            max_exp_bits,
+            max_man_bits,
+            res_bias
+        );
+    }
+
+    // Accumulator context set
     if (accumulator_mode.has_value()) {
         const auto acc_option = accumulator_mode.value();
         const auto tmp_exp_bits = acc_option.exp_bits;
@@ -2087,27 +2528,45 @@ APyFloat APyFloatArray::checked_inner_product(
         const auto tmp_bias = acc_option.bias.value_or(
             calc_bias(tmp_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias)
         );
-        ;
         // If an accumulator is used, the operands must be resized before the
         // multiplication. This is because the products would otherwise get
         // quantized too early. NOTE: This assumes that the format of the
         // accumulator is larger
-
-        APyFloatArray hadamard(shape, tmp_exp_bits, tmp_man_bits, tmp_bias);
-        // Hadamard product of `*this` and `rhs`
-        (this->_cast(tmp_exp_bits, tmp_man_bits, tmp_bias, acc_option.quantization))
-            .hadamard_multiplication(
-                &rhs._cast(
-                        tmp_exp_bits, tmp_man_bits, tmp_bias, acc_option.quantization
-                )
-                     .data[0],
+        APyFloat sum(tmp_exp_bits, tmp_man_bits, tmp_bias);
+        if (FloatDotKernel::is_applicable(
+                tmp_man_bits, tmp_man_bits, tmp_man_bits, acc_option.quantization
+            )) {
+            // Fused multiply-accumulate, quantizing the operands a tile at a time
+            APY_PROFILE_SCOPE("float.dot.fused", data.size());
+            const FloatDotKernel dot(
+                exp_bits,
+                man_bits,
+                bias,
+                rhs.exp_bits,
+                rhs.man_bits,
+                rhs.bias,
                 tmp_exp_bits,
                 tmp_man_bits,
                 tmp_bias,
-                hadamard,
-                acc_option.quantization
+                acc_option.quantization,
+                data.size(),
+                true
             );
-        APyFloat sum = hadamard.vector_sum(acc_option.quantization);
+            simd::FloatTile tile;
+            sum.set_data(dot(data.data(), rhs.data.data(), data.size(), tile));
+        } else {
+            sum.set_data(float_accumulator_inner_product(
+                data.data(),
+                rhs.data.data(),
+                data.size(),
+                *this,
+                rhs,
+                tmp_exp_bits,
+                tmp_man_bits,
+                tmp_bias,
+                acc_option.quantization
+            ));
+        }
         // The result must be quantized back if an accumulator was used.
         sum = sum._cast(
             max_exp_bits,
@@ -2119,177 +2578,65 @@ APyFloat APyFloatArray::checked_inner_product(
     }
     // No accumulator context
 
+    const auto quantization = get_float_quantization_mode();
+    if (FloatDotKernel::is_applicable(
+            man_bits, rhs.man_bits, max_man_bits, quantization
+        )) {
+        // Fused multiply-accumulate
+        APY_PROFILE_SCOPE("float.dot.fused", data.size());
+        const auto res_bias
+            = calc_bias(max_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias);
+        const FloatDotKernel dot(
+            exp_bits,
+            man_bits,
+            bias,
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            max_exp_bits,
+            max_man_bits,
+            res_bias,
+            quantization,
+            data.size()
+        );
+        simd::FloatTile tile;
+        return APyFloat(
+            dot(data.data(), rhs.data.data(), data.size(), tile),
+            max_exp_bits,
+            max_man_bits,
+            res_bias
+        );
+    }
+
     // Hadamard product of `*this` and `rhs`
     APyFloatArray hadamard = *this * rhs;
-    APyFloat sum = hadamard.vector_sum(get_float_quantization_mode());
+    APyFloat sum = hadamard.vector_sum(quantization);
     return sum;
 }
 
 // Compute sum of all elements
 APyFloat APyFloatArray::vector_sum(const QuantizationMode quantization) const
 {
-    // +5 to give room for leading one, carry, and 3 guard bits
-    const unsigned int max_man_bits = man_bits + 5;
     APyFloat ret(0, 0, 0, exp_bits, man_bits, bias);
-    if ((max_man_bits <= _MAN_T_SIZE_BITS)
-        && (quantization != QuantizationMode::STOCH_WEIGHTED)) {
-        APyFloatData x;
-        bool sum_sign = false;
-        exp_t sum_exp = 0;
-        man_t sum_man = 0;
-        const exp_t res_max_exponent = ((1ULL << exp_bits) - 1);
-        const man_t final_res_leading_one = (1ULL << man_bits);
-        const man_t res_leading_one = final_res_leading_one << 3;
-        const man_t carry_res_leading_one = res_leading_one << 1;
-        const std::uint8_t tmp_man_bits
-            = man_bits + 4; // 4 for leading 1 and 3 guard bits
-        const auto shift_normalization_const = _MAN_T_SIZE_BITS - tmp_man_bits;
-        const auto man_mask = carry_res_leading_one - 1;
-        bool sum_is_max_exponent = false;
-        // Perform operation
-        for (std::size_t i = 0; i < data.size(); i++) {
-            x = data[i];
-            const bool x_is_zero_exponent = (x.exp == 0);
-            // Handle zero cases
-            if (x_is_zero_exponent && x.man == 0) {
-                continue;
-            }
-            const bool sum_is_zero_exponent = (sum_exp == 0);
-            if (sum_is_zero_exponent && sum_man == 0) {
-                sum_sign = x.sign;
-                sum_exp = x.exp;
-                sum_man = x.man;
-                sum_is_max_exponent = (x.exp == res_max_exponent);
-                continue;
-            }
-            const bool x_is_max_exponent = x.exp == res_max_exponent;
-            const bool same_sign = (x.sign == sum_sign);
-            // Handle the NaN and inf cases
-            if (x_is_max_exponent || sum_is_max_exponent) {
-                if ((x_is_max_exponent && x.man != 0)
-                    || (sum_is_max_exponent && sum_man != 0)
-                    || (x_is_max_exponent && sum_is_max_exponent && !same_sign)) {
-                    // Set to NaN
-                    ret.set_data({ false,
-                                   static_cast<exp_t>(res_max_exponent),
-                                   static_cast<man_t>(1) });
-                    return ret;
-                }
-
-                // Handle inf cases
-                if (x_is_max_exponent && x.man == 0) {
-                    // Set to inf
-                    // No early return as later values may be NaN
-                    sum_sign = x.sign;
-                    sum_exp = res_max_exponent;
-                    sum_man = 0;
-                    sum_is_max_exponent = true;
-                    continue;
-                }
-
-                // Here: sum_is_max_exponent && sum_man == 0
-                // Keep at inf
-                // No early return as later values may be NaN
-                continue;
-            }
-
-            if (!same_sign && x.exp == sum_exp && x.man == sum_man) {
-                // Set to zero
-                sum_sign = false;
-                sum_exp = 0;
-                sum_man = 0;
-                continue;
-            }
-
-            const exp_t true_x_exp = x.exp + x_is_zero_exponent;
-            const exp_t true_sum_exp = sum_exp + sum_is_zero_exponent;
-            // Conditionally add leading one's, also add room for guard bits
-            // Note that exp can never be res_max_exponent here
-            man_t mx = (x_is_zero_exponent ? 0 : res_leading_one) | (x.man << 3);
-            const man_t msum
-                = (sum_is_zero_exponent ? 0 : res_leading_one) | (sum_man << 3);
-
-            // Compute sign and swap operands if need to make sure |x| >= |y|
-            if (x.exp < sum_exp || (x.exp == sum_exp && x.man < sum_man)) {
-                const unsigned exp_delta = true_sum_exp - true_x_exp;
-                // Align mantissa based on difference in exponent
-                if (exp_delta <= 3) {
-                    mx >>= exp_delta;
-                } else if (exp_delta >= max_man_bits) {
-                    mx = (mx >> max_man_bits) | 1;
-                } else {
-                    mx = (mx >> exp_delta)
-                        | ((mx << (_MAN_T_SIZE_BITS - exp_delta)) != 0);
-                }
-                sum_exp = true_sum_exp;
-                // Perform addition / subtraction
-                sum_man = same_sign ? msum + mx : msum - mx;
-            } else {
-                // Align mantissas based on exponent difference
-                const unsigned exp_delta = true_x_exp - true_sum_exp;
-                // Align mantissa based on difference in exponent
-                man_t m_aligned;
-                if (exp_delta <= 3) {
-                    m_aligned = msum >> exp_delta;
-                } else if (exp_delta >= max_man_bits) {
-                    m_aligned = (msum >> max_man_bits) | 1;
-                } else {
-                    m_aligned = (msum >> exp_delta)
-                        | ((msum << (_MAN_T_SIZE_BITS - exp_delta)) != 0);
-                }
-                sum_exp = true_x_exp;
-                // Perform addition / subtraction
-                sum_man = same_sign ? mx + m_aligned : mx - m_aligned;
-                sum_sign = x.sign;
-            }
-
-            // Check for carry and cancellation
-            if (sum_man & carry_res_leading_one) {
-                // Carry
-                sum_exp++;
-            } else if (sum_man & res_leading_one) {
-                // Align mantissa to carry case
-                sum_man <<= 1;
-            } else {
-                // Cancellation or addition with subnormals
-                // Mantissa should be shifted until 1.xx is obtained or new_exp
-                // equals 0
-                const unsigned int man_leading_zeros = leading_zeros(sum_man);
-                const unsigned int normalizing_shift
-                    = man_leading_zeros - shift_normalization_const;
-
-                if (sum_exp > normalizing_shift) {
-                    sum_man <<= normalizing_shift + 1;
-                    sum_exp -= normalizing_shift;
-                } else {
-                    // The result will be a subnormal
-                    sum_man <<= sum_exp;
-                    sum_exp = 0;
-                }
-            }
-
-            sum_man &= man_mask;
-
-            quantize_mantissa(
-                sum_man,
-                sum_exp,
-                res_max_exponent,
-                4,
-                sum_sign,
-                final_res_leading_one,
-                3,
-                7,
-                quantization
-            );
-
-            // Check for overflow
-            if (sum_exp == res_max_exponent) {
-                sum_is_max_exponent = true;
-            }
+    if (FloatSumKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.sum.fast", data.size());
+        FloatSumKernel sum(exp_bits, man_bits, quantization);
+        for (std::size_t i = 0; i < data.size() && !sum.is_nan(); i++) {
+            sum.add(data[i]);
+        }
+        ret.set_data(sum.get());
+        return ret;
+    }
+    if (WideFloatSumKernel::is_applicable(man_bits, quantization)) {
+        APY_PROFILE_SCOPE("float.sum.wide", data.size());
+        WideFloatSumKernel sum(exp_bits, man_bits, quantization);
+        for (std::size_t i = 0; i < data.size() && !sum.is_nan(); i++) {
+            sum.add(data[i]);
         }
-        ret.set_data({ sum_sign, sum_exp, sum_man });
+        ret.set_data(sum.get());
         return ret;
     }
+    APY_PROFILE_SCOPE("float.sum.scalar_fallback", data.size());
     APyFloat tmp(0, 0, 0, exp_bits, man_bits, bias);
 
     for (std::size_t i = 0; i < data.size(); i++) {
@@ -2299,6 +2646,76 @@ APyFloat APyFloatArray::vector_sum(const QuantizationMode quantization) const
     return ret;
 }
 
+//! Size (in bytes) of the block of gathered `rhs` columns of `float_matmul_fused`,
+//! which should fit in the L2 cache
+static constexpr std::size_t _MATMUL_BLOCK_BYTES = std::size_t(1) << 17;
+
+//! Number of rows of `lhs` multiplied with each block of `rhs` columns
+static constexpr std::size_t _MATMUL_BLOCK_ROWS = 64;
+
+/*!
+ * Matrix product of the `rows` x `inner` matrix `lhs` and the `inner` x `cols` matrix
+ * `rhs` into `dst`, all row-major. The products and sums are computed by the
+ * inner-product kernel `dot` (a `FloatDotKernel` or a `FloatExactDotKernel`), with
+ * `rhs` as its first operand. The result is
+ * computed in tiles of a block of `rhs` columns, gathered once into a contiguous
+ * buffer, times a block of `lhs` rows, and the tiles are distributed over threads.
+ */
+template <typename DOT_KERNEL>
+static void float_matmul_fused(
+    const APyFloatData* lhs,
+    const APyFloatData* rhs,
+    APyFloatData* dst,
+    std::size_t rows,
+    std::size_t inner,
+    std::size_t cols,
+    const DOT_KERNEL& dot
+)
+{
+    const std::size_t block_cols = std::clamp(
+        _MATMUL_BLOCK_BYTES / (std::max(inner, std::size_t(1)) * sizeof(APyFloatData)),
+        std::size_t(1),
+        std::max(cols, std::size_t(1))
+    );
+    const std::size_t col_blocks = (cols + block_cols - 1) / block_cols;
+    const std::size_t row_blocks = (rows + _MATMUL_BLOCK_ROWS - 1) / _MATMUL_BLOCK_ROWS;
+
+    auto compute_tiles = [&](std::size_t begin, std::size_t end) {
+        typename DOT_KERNEL::scratch_t scratch;
+        std::vector<APyFloatData> columns(cols > 1 ? block_cols * inner : 0);
+        std::size_t loaded_block = col_blocks;
+        for (std::size_t task = begin; task < end; task++) {
+            // Consecutive tasks share the same block of columns
+            const std::size_t col_block = task / row_blocks;
+            const std::size_t col_begin = col_block * block_cols;
+            const std::size_t col_end = std::min(col_begin + block_cols, cols);
+            if (cols > 1 && col_block != loaded_block) {
+                for (std::size_t k = 0; k < inner; k++) {
+                    for (std::size_t col = col_begin; col < col_end; col++) {
+                        columns[(col - col_begin) * inner + k] = rhs[col + k * cols];
+                    }
+                }
+                loaded_block = col_block;
+            }
+            const APyFloatData* block = cols > 1 ? columns.data() : rhs;
+
+            const std::size_t row_begin = (task % row_blocks) * _MATMUL_BLOCK_ROWS;
+            const std::size_t row_end = std::min(row_begin + _MATMUL_BLOCK_ROWS, rows);
+            for (std::size_t row = row_begin; row < row_end; row++) {
+                for (std::size_t col = col_begin; col < col_end; col++) {
+                    dst[col + row * cols] = dot(
+                        &block[(col - col_begin) * inner],
+                        &lhs[row * inner],
+                        inner,
+                        scratch
+                    );
+                }
+            }
+        }
+    };
+    parallel_for(col_blocks * row_blocks, rows * cols * inner, compute_tiles);
+}
+
 // Evaluate the matrix product between two 2D matrices. This method assumes that the
 // shape of `*this` and `rhs` have been checked to match a 2d matrix multiplication.
 APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
@@ -2318,6 +2735,105 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
     // Resulting `APyFloatArray`
     APyFloatArray result(res_shape, max_exp_bits, max_man_bits, res_bias);
 
+    // Exact accumulator, with the products accumulated in the result format
+    if (accumulator_mode.has_value() && accumulator_mode->exact) {
+        check_exact_accumulation(*this, rhs, "__matmul__");
+        APY_PROFILE_SCOPE("float.matmul.exact", result.data.size() * shape[1]);
+        const FloatExactDotKernel dot(
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            exp_bits,
+            man_bits,
+            bias,
+            max_exp_bits,
+            max_man_bits,
+            res_bias,
+            accumulator_mode->quantization
+        );
+        float_matmul_fused(
+            data.data(),
+            rhs.data.data(),
+            result.data.data(),
+            res_shape[0],
+            shape[1],
+            res_cols,
+            dot
+        );
+        return result;
+    }
+
+    // Format of the products and the sums, and their quantization mode
+    const auto quantization = accumulator_mode.has_value()
+        ? accumulator_mode->quantization
+        : get_float_quantization_mode();
+    const std::uint8_t sum_exp_bits
+        = accumulator_mode.has_value() ? accumulator_mode->exp_bits : max_exp_bits;
+    const std::uint8_t sum_man_bits
+        = accumulator_mode.has_value() ? accumulator_mode->man_bits : max_man_bits;
+    const exp_t sum_bias = accumulator_mode.has_value()
+        ? accumulator_mode->bias.value_or(
+              calc_bias(sum_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias)
+          )
+        : res_bias;
+    const bool is_fused = accumulator_mode.has_value()
+        ? FloatDotKernel::is_applicable(
+              sum_man_bits, sum_man_bits, sum_man_bits, quantization
+          )
+        : FloatDotKernel::is_applicable(
+              rhs.man_bits, man_bits, sum_man_bits, quantization
+          );
+
+    if (is_fused) {
+        APY_PROFILE_SCOPE("float.matmul.fused", result.data.size() * shape[1]);
+
+        // If an accumulator is used, the operands are quantized to the accumulator
+        // format by the kernel, a tile at a time, before the multiplication
+        const FloatDotKernel dot(
+            rhs.exp_bits,
+            rhs.man_bits,
+            rhs.bias,
+            exp_bits,
+            man_bits,
+            bias,
+            sum_exp_bits,
+            sum_man_bits,
+            sum_bias,
+            quantization,
+            result.data.size() * shape[1],
+            accumulator_mode.has_value()
+        );
+
+        // The sums must be quantized back if an accumulator was used
+        const bool is_result_format = sum_exp_bits == max_exp_bits
+            && sum_man_bits == max_man_bits && sum_bias == res_bias;
+        std::vector<APyFloatData> sums(is_result_format ? 0 : result.data.size());
+        float_matmul_fused(
+            data.data(),
+            rhs.data.data(),
+            is_result_format ? result.data.data() : sums.data(),
+            res_shape[0],
+            shape[1],
+            res_cols,
+            dot
+        );
+        if (!is_result_format) {
+            float_cast(
+                sums.data(),
+                result.data.data(),
+                sums.size(),
+                sum_exp_bits,
+                sum_man_bits,
+                sum_bias,
+                max_exp_bits,
+                max_man_bits,
+                res_bias,
+                quantization
+            );
+        }
+        return result;
+    }
+
     // Current column from rhs
     APyFloatArray current_column(
         { rhs.shape[0] }, rhs.exp_bits, rhs.man_bits, rhs.bias
@@ -2333,9 +2849,6 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
             calc_bias(tmp_exp_bits, exp_bits, bias, rhs.exp_bits, rhs.bias)
         );
 
-        APyFloatArray hadamard({ shape[1] }, tmp_exp_bits, tmp_man_bits, tmp_bias);
-        APyFloatArray casted_this
-            = _cast(tmp_exp_bits, tmp_man_bits, tmp_bias, acc_option.quantization);
         for (std::size_t x = 0; x < res_cols; x++) {
 
             // Copy column from `rhs` and use as the current working column. As
@@ -2345,24 +2858,25 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
                 current_column.data[col] = rhs.data[x + col * res_cols];
             }
 
-            APyFloatArray casted_current_column = current_column._cast(
-                tmp_exp_bits, tmp_man_bits, tmp_bias, acc_option.quantization
-            );
             for (std::size_t y = 0; y < res_shape[0]; y++) {
-                // If an accumulator is used, the operands must be resized before
-                // the multiplication. This is because the products would otherwise
-                // get quantized too early.
-
-                // Hadamard product of `*this` and `rhs`
-                casted_current_column.hadamard_multiplication(
-                    &casted_this.data[y * shape[1]],
+                // The operands are quantized to the accumulator format as they are
+                // read, as the products would otherwise get quantized too early
+                APyFloat sum(
+                    float_accumulator_inner_product(
+                        current_column.data.data(),
+                        &data[y * shape[1]],
+                        shape[1],
+                        rhs,
+                        *this,
+                        tmp_exp_bits,
+                        tmp_man_bits,
+                        tmp_bias,
+                        acc_option.quantization
+                    ),
                     tmp_exp_bits,
                     tmp_man_bits,
-                    tmp_bias,
-                    hadamard,
-                    acc_option.quantization
+                    tmp_bias
                 );
-                APyFloat sum = hadamard.vector_sum(acc_option.quantization);
                 // The result must be quantized back if an accumulator was used.
                 sum = sum._cast(
                     max_exp_bits, max_man_bits, res_bias, acc_option.quantization
@@ -2380,7 +2894,6 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
 
     // No accumulator mode
 
-    const auto quantization = get_float_quantization_mode();
     APyFloatArray hadamard({ shape[1] }, max_exp_bits, max_man_bits, res_bias);
 
     for (std::size_t x = 0; x < res_cols; x++) {
@@ -8,6 +8,7 @@
 #include <nanobind/ndarray.h>     // nanobind::ndarray
 #include <nanobind/stl/variant.h> // std::variant (with nanobind support)
 #include <optional>
+#include <tuple>
 #include <vector>
 
 class APyFloatArray {
@@ -22,6 +23,16 @@ public:
         std::uint8_t man_bits,
         std::optional<exp_t> bias = std::nullopt
     );
+
+    //! Constructor specifying only the shape and format of the array. Zero data on
+    //! construction.
+    APyFloatArray(
+        const std::vector<std::size_t>& shape,
+        exp_t exp_bits,
+        std::uint8_t man_bits,
+        std::optional<exp_t> bias = std::nullopt
+    );
+
     //! Vector with values
     std::vector<APyFloatData> data;
     //! Number of exponent bits
@@ -92,9 +103,29 @@ public:
         std::optional<exp_t> bias = std::nullopt
     );
 
+    //! Create an `APyFloatArray` tensor object from an ndarray of IEEE-style bit
+    //! patterns `[sign | exp | man]`
+    static APyFloatArray from_bits(
+        const nanobind::ndarray<nanobind::c_contig>& bit_patterns,
+        int exp_bits,
+        int man_bits,
+        std::optional<exp_t> bias = std::nullopt
+    );
+
     //! Set data fields based on an and-array of doubles
     void _set_values_from_ndarray(const nanobind::ndarray<nanobind::c_contig>& ndarray);
 
+    //! Create an `APyFloatArray` tensor object from ndarrays of signs, biased
+    //! exponents, and mantissas, all of the same shape
+    static APyFloatArray _from_fields(
+        const nanobind::ndarray<const std::uint8_t, nanobind::c_contig>& sign,
+        const nanobind::ndarray<const exp_t, nanobind::c_contig>& exp,
+        const nanobind::ndarray<const man_t, nanobind::c_contig>& man,
+        int exp_bits,
+        int man_bits,
+        exp_t bias
+    );
+
     /* ****************************************************************************** *
      * *                          Public member functions                           * *
      * ****************************************************************************** */
@@ -253,6 +284,17 @@ public:
     //! Convert to a NumPy array
     nanobind::ndarray<nanobind::numpy, double> to_numpy() const;
 
+    //! Pack the elements into a NumPy array of IEEE-style bit patterns, using the
+    //! narrowest unsigned integer type that holds the format
+    nanobind::object to_bits() const;
+
+    //! Copy the sign, biased exponent, and mantissa fields to three NumPy arrays
+    std::tuple<
+        nanobind::ndarray<nanobind::numpy, std::uint8_t>,
+        nanobind::ndarray<nanobind::numpy, exp_t>,
+        nanobind::ndarray<nanobind::numpy, man_t>>
+    _get_fields() const;
+
     /* ******************************************************************************
      * * Convenience methods                                                        *
      * ******************************************************************************
@@ -277,13 +319,6 @@ public:
 private:
     //! Default constructor
     APyFloatArray() = default;
-    //! Constructor specifying only the shape and format of the array
-    APyFloatArray(
-        const std::vector<std::size_t>& shape,
-        exp_t exp_bits,
-        std::uint8_t man_bits,
-        std::optional<exp_t> bias = std::nullopt
-    );
     std::vector<std::size_t> shape;
 
     //! Fold the `_shape` field over multiplication
@@ -323,31 +358,18 @@ private:
         const QuantizationMode quantization
     ) const;
 
-    /*
-     * Friend functions
-     */
-    template <
-        typename RANDOM_ACCESS_ITERATOR_IN,
-        typename RANDOM_ACCESS_ITERATOR_INOUT,
-        typename APYFLOAT_TYPE>
-    friend void float_product(
-        RANDOM_ACCESS_ITERATOR_IN src1,
-        RANDOM_ACCESS_ITERATOR_IN src2,
-        RANDOM_ACCESS_ITERATOR_INOUT dst,
-        const APYFLOAT_TYPE& x, // Floating point src1
-        const APYFLOAT_TYPE& y  // Floating point src2
-    );
-
     // internal function for the prod,sum,nanprod and nansum functions
     std::variant<APyFloatArray, APyFloat> prod_sum_function(
         void (*pos_func)(std::size_t, std::size_t, std::size_t, APyFloatArray&, APyFloatArray&, APyFloat&, APyFloat&),
         std::optional<std::variant<nb::tuple, nb::int_>> axis = std::nullopt
     ) const;
 
-    // internal function for the cumprod,cumsum,nancumprod and nancumsum functions
+    // internal function for the cumprod, cumsum, nancumprod and nancumsum functions.
+    // Computes the cumulative product if `is_prod` is set, and the cumulative sum
+    // otherwise. NaN elements are treated as one (product) or zero (sum), if
+    // `ignore_nan` is set.
     APyFloatArray cumulative_prod_sum_function(
-        void (*pos_func)(std::size_t, std::size_t, std::size_t, APyFloatArray&, APyFloatArray&, APyFloat&, APyFloat&),
-        std::optional<nb::int_> axis = std::nullopt
+        bool is_prod, bool ignore_nan, std::optional<nb::int_> axis = std::nullopt
     ) const;
 
     std::variant<APyFloatArray, APyFloat> max_min_helper_function(
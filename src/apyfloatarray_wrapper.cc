@@ -5,6 +5,7 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/operators.h>
 #include <nanobind/stl/optional.h>
+#include <nanobind/stl/tuple.h>
 
 namespace nb = nanobind;
 
@@ -329,6 +330,31 @@ void bind_float_array(nb::module_& m)
             -------
             :class:`numpy.ndarray`
             )pbdoc")
+        .def("to_bits", &APyFloatArray::to_bits, R"pbdoc(
+            Return the bit patterns of the array as a :class:`numpy.ndarray`.
+
+            Each element holds the IEEE-style bit pattern `[sign | exp | man]`, stored in the
+            narrowest of :class:`numpy.uint8`, :class:`numpy.uint16`, :class:`numpy.uint32`,
+            and :class:`numpy.uint64` that holds the format. Only formats of at most 64 bits are
+            supported.
+
+            Examples
+            --------
+
+            >>> from apytypes import APyFloatArray
+
+            >>> a = APyFloatArray.from_float([1.0, -2.0], exp_bits=5, man_bits=10)
+            >>> a.to_bits()
+            array([15360, 49152], dtype=uint16)
+
+            Returns
+            -------
+            :class:`numpy.ndarray`
+
+            See also
+            --------
+            from_bits
+            )pbdoc")
         .def("reshape", &APyFloatArray::reshape, nb::arg("number_sequence"), R"pbdoc(
         Reshape the APyFloatArray to the specified shape without changing its data.
 
@@ -505,6 +531,88 @@ void bind_float_array(nb::module_& m)
             :class:`APyFloatArray`
             )pbdoc"
         )
+        .def_static(
+            "from_bits",
+            &APyFloatArray::from_bits,
+            nb::arg("bit_patterns"),
+            nb::arg("exp_bits"),
+            nb::arg("man_bits"),
+            nb::arg("bias") = nb::none(),
+            R"pbdoc(
+            Create an :class:`APyFloatArray` object from an ndarray of bit patterns.
+
+            Each element of the ndarray holds the IEEE-style bit pattern `[sign | exp | man]`
+            of one floating-point value, e.g., a raw FP8, FP16, or BF16 tensor dump. Bits above
+            the format are ignored. Signed integer dtypes are read as the unsigned type of the
+            same width.
+
+            Parameters
+            ----------
+            bit_patterns : ndarray
+                Integer ndarray of bit patterns, at least `1 + exp_bits + man_bits` bits wide.
+                The tensor shape will be taken from the ndarray shape.
+            exp_bits : int
+                Number of exponent bits in the created floating-point tensor
+            man_bits : int
+                Number of mantissa bits in the created floating-point tensor
+            bias : int, optional
+                Bias in the created floating-point tensor
+
+            Examples
+            --------
+
+            >>> from apytypes import APyFloatArray
+            >>> import numpy as np
+
+            Array `a`, initialized to [1.0, -2.0] from half-precision bit patterns
+
+            >>> a = APyFloatArray.from_bits(
+            ...     np.array([0x3C00, 0xC000], dtype=np.uint16), exp_bits=5, man_bits=10
+            ... )
+            >>> a
+            APyFloatArray([0, 1], [15, 16], [0, 0], shape=(2,), exp_bits=5, man_bits=10, bias=15)
+
+            Returns
+            -------
+            :class:`APyFloatArray`
+
+            See also
+            --------
+            to_bits
+            from_array
+            )pbdoc"
+        )
+
+        /*
+         * Raw field access (serialization)
+         */
+        .def("_get_fields", &APyFloatArray::_get_fields, R"pbdoc(
+            Copy the fields of the array to three :class:`numpy.ndarray`.
+
+            Returns
+            -------
+            sign : :class:`numpy.ndarray` of :class:`numpy.uint8`
+            exp : :class:`numpy.ndarray` of :class:`numpy.uint32`
+            man : :class:`numpy.ndarray` of :class:`numpy.uint64`
+            )pbdoc")
+        .def_static(
+            "_from_fields",
+            &APyFloatArray::_from_fields,
+            nb::arg("sign"),
+            nb::arg("exp"),
+            nb::arg("man"),
+            nb::arg("exp_bits"),
+            nb::arg("man_bits"),
+            nb::arg("bias"),
+            R"pbdoc(
+            Create an :class:`APyFloatArray` from the field arrays returned by
+            :func:`APyFloatArray._get_fields`.
+
+            Returns
+            -------
+            :class:`APyFloatArray`
+            )pbdoc"
+        )
 
         /*
          * Dunder methods
@@ -650,6 +758,10 @@ void bind_float_array(nb::module_& m)
 
             Requires that ``ndim = 1`` for both `self` and `other`.
 
+            If an :class:`APyFloatAccumulatorContext` is active, the products and sums of
+            each output sample are computed in the accumulator format, and quantized back
+            to the result format, as for matrix multiplication.
+
             Parameters
             ----------
             other : :class:`APyFloatArray`
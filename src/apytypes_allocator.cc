@@ -0,0 +1,258 @@
+#include "apytypes_allocator.h"
+#include "apytypes_profiling.h"
+#include "apytypes_util.h"
+
+#include <algorithm> // std::max, std::find
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <limits>    // std::numeric_limits
+#include <mutex>     // std::mutex, std::lock_guard
+#include <new>       // ::operator new, ::operator delete, std::align_val_t
+#include <vector>    // std::vector
+
+/* ********************************************************************************** *
+ * *                              Allocator statistics                              * *
+ * ********************************************************************************** */
+
+//! Index of each allocator statistics counter
+enum AllocatorCounter : unsigned {
+    POOL_HITS,
+    POOL_MISSES,
+    POOL_OVERSIZED,
+    POOL_CACHED,
+    POOL_RELEASED,
+    N_ALLOCATOR_COUNTERS,
+};
+
+//! Statistics counters of a single thread. Only the owning thread writes to its
+//! counters, so counting is a plain load and store to a thread-private cache line,
+//! without the contention of a shared atomic read-modify-write.
+struct ThreadAllocatorCounters {
+    ThreadAllocatorCounters();
+    ~ThreadAllocatorCounters();
+
+    std::atomic<std::uint64_t> counters[N_ALLOCATOR_COUNTERS] = {};
+};
+
+//! Registry of the statistics counters of all live threads
+struct AllocatorCounterRegistry {
+    std::mutex mutex;
+    std::vector<const ThreadAllocatorCounters*> threads;
+    std::uint64_t exited[N_ALLOCATOR_COUNTERS] = {};   // Totals of exited threads
+    std::uint64_t baseline[N_ALLOCATOR_COUNTERS] = {}; // Totals at the last reset
+
+    //! Sum of counter `i` over all threads, including the exited ones
+    std::uint64_t total(unsigned i) const noexcept
+    {
+        std::uint64_t sum = exited[i];
+        for (const ThreadAllocatorCounters* thread : threads) {
+            sum += thread->counters[i].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+};
+
+static AllocatorCounterRegistry& counter_registry()
+{
+    static AllocatorCounterRegistry registry;
+    return registry;
+}
+
+ThreadAllocatorCounters::ThreadAllocatorCounters()
+{
+    auto& registry = counter_registry();
+    std::lock_guard lock(registry.mutex);
+    registry.threads.push_back(this);
+}
+
+ThreadAllocatorCounters::~ThreadAllocatorCounters()
+{
+    auto& registry = counter_registry();
+    std::lock_guard lock(registry.mutex);
+    for (unsigned i = 0; i < N_ALLOCATOR_COUNTERS; i++) {
+        registry.exited[i] += counters[i].load(std::memory_order_relaxed);
+    }
+    registry.threads.erase(
+        std::find(registry.threads.begin(), registry.threads.end(), this)
+    );
+}
+
+//! Add one to counter `i` of the calling thread. Counts during thread teardown, after
+//! the counters of the thread have been merged into the registry, are dropped.
+static APY_INLINE void count_allocator_event(AllocatorCounter i) noexcept
+{
+    static thread_local bool destroyed = false;
+    if (destroyed) {
+        return;
+    }
+    static thread_local struct Counters : ThreadAllocatorCounters {
+        ~Counters() { destroyed = true; }
+    } counters;
+    auto& counter = counters.counters[i];
+    const std::uint64_t value = counter.load(std::memory_order_relaxed);
+    counter.store(value + 1, std::memory_order_relaxed);
+}
+
+//! Counter `i` summed over all threads since the last reset
+static std::uint64_t allocator_counter(unsigned i)
+{
+    auto& registry = counter_registry();
+    std::lock_guard lock(registry.mutex);
+    return registry.total(i) - registry.baseline[i];
+}
+
+APyAllocatorStats get_allocator_stats()
+{
+    return APyAllocatorStats {
+        allocator_counter(POOL_HITS),      allocator_counter(POOL_MISSES),
+        allocator_counter(POOL_OVERSIZED), allocator_counter(POOL_CACHED),
+        allocator_counter(POOL_RELEASED),
+    };
+}
+
+void reset_allocator_stats()
+{
+    auto& registry = counter_registry();
+    std::lock_guard lock(registry.mutex);
+    for (unsigned i = POOL_HITS; i <= POOL_RELEASED; i++) {
+        registry.baseline[i] = registry.total(i);
+    }
+}
+
+/* ********************************************************************************** *
+ * *                          Thread-local scratch arena                            * *
+ * ********************************************************************************** */
+
+//! Intrusive free-list node, stored in the first bytes of each cached block
+struct PoolFreeBlock {
+    PoolFreeBlock* next;
+};
+
+//! Per-thread free-lists, one for each size class
+class PoolThreadArena {
+public:
+    explicit PoolThreadArena(bool& destroyed_flag) noexcept
+        : _destroyed_flag { destroyed_flag }
+    {
+    }
+
+    ~PoolThreadArena()
+    {
+        release();
+        _destroyed_flag = true;
+    }
+
+    //! Pop a block from the free-list of `cls`, or return `nullptr` if empty
+    void* pop(unsigned cls) noexcept
+    {
+        PoolFreeBlock* block = _head[cls];
+        if (block) {
+            _head[cls] = block->next;
+            _count[cls]--;
+        }
+        return block;
+    }
+
+    //! Push a block to the free-list of `cls`. Returns false if the list is full.
+    bool push(void* ptr, unsigned cls) noexcept
+    {
+        std::size_t class_bytes = _POOL_ALIGNMENT << cls;
+        if ((_count[cls] + 1) * class_bytes > _POOL_MAX_CACHED_BYTES_PER_CLASS) {
+            return false;
+        }
+        PoolFreeBlock* block = static_cast<PoolFreeBlock*>(ptr);
+        block->next = _head[cls];
+        _head[cls] = block;
+        _count[cls]++;
+        return true;
+    }
+
+    //! Return every cached block to the system
+    void release() noexcept
+    {
+        for (unsigned cls = 0; cls < _POOL_N_CLASSES; cls++) {
+            while (void* ptr = pop(cls)) {
+                ::operator delete(ptr, std::align_val_t(_POOL_ALIGNMENT));
+                count_allocator_event(POOL_RELEASED);
+            }
+        }
+    }
+
+private:
+    PoolFreeBlock* _head[_POOL_N_CLASSES] = {};
+    std::size_t _count[_POOL_N_CLASSES] = {};
+    bool& _destroyed_flag;
+};
+
+//! Retrieve the scratch arena of the calling thread. Returns `nullptr` during thread
+//! teardown, after the arena has been destroyed, so that late deallocations from other
+//! thread-local objects go straight to the system.
+static APY_INLINE PoolThreadArena* thread_arena() noexcept
+{
+    static thread_local bool destroyed = false;
+    if (destroyed) {
+        return nullptr;
+    }
+    static thread_local PoolThreadArena arena(destroyed);
+    return &arena;
+}
+
+//! Size class index of an allocation of `bytes` bytes
+static APY_INLINE unsigned pool_size_class(std::size_t bytes) noexcept
+{
+    if (bytes <= _POOL_ALIGNMENT) {
+        return 0;
+    }
+    return unsigned(bit_width(bytes - 1)) - _POOL_MIN_CLASS_LOG2;
+}
+
+/* ********************************************************************************** *
+ * *                              Pool allocation                                   * *
+ * ********************************************************************************** */
+
+void* aligned_pool_allocate(std::size_t bytes)
+{
+    if (_profiling_enabled.load(std::memory_order_relaxed)) {
+        _profiling_thread_bytes += bytes;
+    }
+
+    unsigned cls = pool_size_class(bytes);
+    if (cls >= _POOL_N_CLASSES) {
+        count_allocator_event(POOL_OVERSIZED);
+        return ::operator new(bytes, std::align_val_t(_POOL_ALIGNMENT));
+    }
+
+    if (PoolThreadArena* arena = thread_arena()) {
+        if (void* ptr = arena->pop(cls)) {
+            count_allocator_event(POOL_HITS);
+            return ptr;
+        }
+    }
+    count_allocator_event(POOL_MISSES);
+    return ::operator new(_POOL_ALIGNMENT << cls, std::align_val_t(_POOL_ALIGNMENT));
+}
+
+void aligned_pool_deallocate(void* ptr, std::size_t bytes) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+
+    unsigned cls = pool_size_class(bytes);
+    if (cls < _POOL_N_CLASSES) {
+        PoolThreadArena* arena = thread_arena();
+        if (arena && arena->push(ptr, cls)) {
+            count_allocator_event(POOL_CACHED);
+            return;
+        }
+    }
+    ::operator delete(ptr, std::align_val_t(_POOL_ALIGNMENT));
+    count_allocator_event(POOL_RELEASED);
+}
+
+void release_thread_scratch_arena() noexcept
+{
+    if (PoolThreadArena* arena = thread_arena()) {
+        arena->release();
+    }
+}
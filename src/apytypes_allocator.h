@@ -0,0 +1,102 @@
+/*
+ * Aligned, pooled memory allocator for APyTypes buffers and kernel temporaries.
+ *
+ * Allocations are rounded up to power-of-two size classes, starting at one cache line
+ * (64 bytes). Every block is 64-byte aligned, so buffers are always suitable for
+ * aligned SIMD loads and never share a cache line with another buffer. Freed blocks
+ * are kept in a small thread-local free-list (the scratch arena) for each size class
+ * and are handed back out on the next allocation of the same class, avoiding a round
+ * trip to `malloc`/`free` for small-array-heavy workloads and for the scratch vectors
+ * used by the arithmetic kernels.
+ */
+
+#ifndef _APYTYPES_ALLOCATOR_H
+#define _APYTYPES_ALLOCATOR_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <new>     // std::bad_array_new_length
+#include <vector>  // std::vector
+
+/*
+ * GMP should be included after all other includes
+ */
+#include "../extern/mini-gmp/mini-gmp.h"
+
+//! Alignment (in bytes) of every block returned by the pool allocator
+constexpr std::size_t _POOL_ALIGNMENT = 64;
+
+//! log2 of the smallest and largest pooled size class (64 B and 64 KiB)
+constexpr unsigned _POOL_MIN_CLASS_LOG2 = 6;
+constexpr unsigned _POOL_MAX_CLASS_LOG2 = 16;
+constexpr unsigned _POOL_N_CLASSES = _POOL_MAX_CLASS_LOG2 - _POOL_MIN_CLASS_LOG2 + 1;
+
+//! Maximum number of bytes retained in each thread-local free-list
+constexpr std::size_t _POOL_MAX_CACHED_BYTES_PER_CLASS = std::size_t(1) << 18;
+
+//! Process-wide statistics of the pool allocator
+struct APyAllocatorStats {
+    std::uint64_t hits;      // Allocations served from a thread-local free-list
+    std::uint64_t misses;    // Pooled allocations that had to go to the system
+    std::uint64_t oversized; // Allocations too large to be pooled
+    std::uint64_t cached;    // Blocks returned to a thread-local free-list
+    std::uint64_t released;  // Blocks returned to the system
+};
+
+//! Allocate `bytes` bytes of 64-byte aligned memory from the pool
+void* aligned_pool_allocate(std::size_t bytes);
+
+//! Return memory previously allocated by `aligned_pool_allocate(bytes)` to the pool
+void aligned_pool_deallocate(void* ptr, std::size_t bytes) noexcept;
+
+//! Retrieve a snapshot of the allocator statistics
+APyAllocatorStats get_allocator_stats();
+
+//! Reset all allocator statistics counters to zero
+void reset_allocator_stats();
+
+//! Return all blocks cached in the calling thread's free-lists to the system
+void release_thread_scratch_arena() noexcept;
+
+/*!
+ * C++17 `Allocator` using the aligned size-class pool. Stateless, so all instances
+ * compare equal and memory may be freed through any instance, on any thread.
+ */
+template <typename T> class AlignedPoolAllocator {
+public:
+    using value_type = T;
+
+    AlignedPoolAllocator() noexcept = default;
+    template <typename U>
+    AlignedPoolAllocator(const AlignedPoolAllocator<U>&) noexcept { }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(aligned_pool_allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        aligned_pool_deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedPoolAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const AlignedPoolAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+//! Limb vector type used for array buffers and kernel scratch memories
+using APyLimbVector = std::vector<mp_limb_t, AlignedPoolAllocator<mp_limb_t>>;
+
+#endif // _APYTYPES_ALLOCATOR_H
@@ -12,8 +12,11 @@ namespace nb = nanobind;
  * *                          Quantization context for APyFloat * *
  * ********************************************************************************** */
 
-// Global quantization mode
-static QuantizationMode global_quantization_mode_float = QuantizationMode::RND_CONV;
+// Quantization mode of the calling thread. All contexts and global options in this file
+// are thread-local, so that threads running in parallel do not affect each other. New
+// threads start with the default options.
+static thread_local QuantizationMode global_quantization_mode_float
+    = QuantizationMode::RND_CONV;
 
 // Get the global quantization mode
 QuantizationMode get_float_quantization_mode()
@@ -30,9 +33,7 @@ APyFloatQuantizationContext::APyFloatQuantizationContext(
     const QuantizationMode& new_mode, std::optional<std::uint64_t> new_seed
 )
     : new_mode(new_mode)
-    , prev_mode(get_float_quantization_mode())
-    , new_seed(new_seed.value_or(get_float_quantization_seed()))
-    , prev_seed(get_float_quantization_seed())
+    , new_seed(new_seed)
 {
     if (new_seed.has_value() && new_mode != QuantizationMode::STOCH_WEIGHTED
         && new_mode != QuantizationMode::STOCH_EQUAL) {
@@ -44,8 +45,11 @@ APyFloatQuantizationContext::APyFloatQuantizationContext(
 
 void APyFloatQuantizationContext::enter_context()
 {
+    // The previous state is that of the entering thread
+    prev_mode = get_float_quantization_mode();
+    prev_seed = get_float_quantization_seed();
     set_float_quantization_mode(new_mode);
-    set_float_quantization_seed(new_seed);
+    set_float_quantization_seed(new_seed.value_or(prev_seed));
 }
 
 void APyFloatQuantizationContext::exit_context()
@@ -58,29 +62,36 @@ void APyFloatQuantizationContext::exit_context()
  * *                          Random number engine for APyFloat                     * *
  * ********************************************************************************** */
 
-// This creates a random seed on every program start.
-std::uint64_t quantization_seed = std::random_device {}();
-
 // A random number engine is used instead of purely std::random_device so that runs can
-// be reproducible.
-std::mt19937_64 gen64(quantization_seed);
+// be reproducible. Each thread has its own engine, seeded randomly on first use.
+struct APyFloatRandomEngine {
+    std::uint64_t seed = std::random_device {}();
+    std::mt19937_64 gen64 { seed };
+};
+
+static APY_INLINE APyFloatRandomEngine& thread_random_engine()
+{
+    static thread_local APyFloatRandomEngine engine;
+    return engine;
+}
 
 void set_float_quantization_seed(std::uint64_t seed)
 {
-    quantization_seed = seed;
-    gen64.seed(seed);
+    APyFloatRandomEngine& engine = thread_random_engine();
+    engine.seed = seed;
+    engine.gen64.seed(seed);
 }
 
-std::uint64_t get_float_quantization_seed() { return quantization_seed; }
+std::uint64_t get_float_quantization_seed() { return thread_random_engine().seed; }
 
-std::uint64_t random_number_float() { return gen64(); }
+std::uint64_t random_number_float() { return thread_random_engine().gen64(); }
 
 /* ********************************************************************************** *
  * *                      Cast context for APyFixed                                 * *
  * ********************************************************************************** */
 
-// Global accumulator option (default value: std::nullopt)
-static APyFixedCastOption global_cast_option_fixed
+// Cast option of the calling thread
+static thread_local APyFixedCastOption global_cast_option_fixed
     = { QuantizationMode::TRN, OverflowMode::WRAP };
 
 APyFixedCastContext::APyFixedCastContext(
@@ -93,20 +104,18 @@ APyFixedCastContext::APyFixedCastContext(
         );
     }
 
-    // Store the previous accumulator mode
-    previous_mode = global_cast_option_fixed;
-
-    // Extract the input
-    APyFixedCastOption new_mode;
-
-    new_mode.quantization = quantization.value_or(previous_mode.quantization);
-    new_mode.overflow = overflow.value_or(previous_mode.overflow);
-
-    // Set the current mode
-    current_mode = new_mode;
+    new_quantization = quantization;
+    new_overflow = overflow;
 }
 
-void APyFixedCastContext::enter_context() { global_cast_option_fixed = current_mode; }
+void APyFixedCastContext::enter_context()
+{
+    // Unspecified modes are inherited from the entering thread
+    previous_mode = global_cast_option_fixed;
+    current_mode.quantization = new_quantization.value_or(previous_mode.quantization);
+    current_mode.overflow = new_overflow.value_or(previous_mode.overflow);
+    global_cast_option_fixed = current_mode;
+}
 void APyFixedCastContext::exit_context() { global_cast_option_fixed = previous_mode; }
 
 APyFixedCastOption get_fixed_cast_mode() { return global_cast_option_fixed; }
@@ -115,8 +124,9 @@ APyFixedCastOption get_fixed_cast_mode() { return global_cast_option_fixed; }
  * *                      Accumulator context for APyFixedArray                     * *
  * ********************************************************************************** */
 
-// Global accumulator option (default value: std::nullopt)
-static std::optional<APyFixedAccumulatorOption> global_accumulator_option_fixed;
+// Accumulator option of the calling thread (default value: std::nullopt)
+static thread_local std::optional<APyFixedAccumulatorOption>
+    global_accumulator_option_fixed;
 
 // Retrieve the global accumulator mode
 std::optional<APyFixedAccumulatorOption> get_accumulator_mode_fixed()
@@ -132,12 +142,8 @@ APyFixedAccumulatorContext::APyFixedAccumulatorContext(
     std::optional<int> bits
 )
 {
-    // Store the previous accumulator mode
-    previous_mode = global_accumulator_option_fixed;
-
     // Extract the input
-    APyFixedAccumulatorOption new_mode
-        = get_accumulator_mode_fixed().value_or(APyFixedAccumulatorOption {});
+    APyFixedAccumulatorOption new_mode {};
 
     new_mode.bits = bits_from_optional(bits, int_bits, frac_bits);
     new_mode.int_bits = int_bits.has_value() ? *int_bits : *bits - *frac_bits;
@@ -150,6 +156,8 @@ APyFixedAccumulatorContext::APyFixedAccumulatorContext(
 
 void APyFixedAccumulatorContext::enter_context()
 {
+    // The previous state is that of the entering thread
+    previous_mode = global_accumulator_option_fixed;
     global_accumulator_option_fixed = current_mode;
 }
 void APyFixedAccumulatorContext::exit_context()
@@ -161,8 +169,9 @@ void APyFixedAccumulatorContext::exit_context()
  * *                      Accumulator context for APyFloatArray                     * *
  * ********************************************************************************** */
 
-// Global accumulator option (default value: std::nullopt)
-static std::optional<APyFloatAccumulatorOption> global_accumulator_option_float;
+// Accumulator option of the calling thread (default value: std::nullopt)
+static thread_local std::optional<APyFloatAccumulatorOption>
+    global_accumulator_option_float;
 
 // Retrieve the global accumulator mode
 std::optional<APyFloatAccumulatorOption> get_accumulator_mode_float()
@@ -174,36 +183,51 @@ APyFloatAccumulatorContext::APyFloatAccumulatorContext(
     std::optional<int> exp_bits,
     std::optional<int> man_bits,
     std::optional<exp_t> bias,
-    std::optional<QuantizationMode> quantization
+    std::optional<QuantizationMode> quantization,
+    bool exact
 )
 {
-    // Store the previous accumulator mode§
-    previous_mode = global_accumulator_option_float;
-
     // Extract the input
-    APyFloatAccumulatorOption new_mode
-        = get_accumulator_mode_float().value_or(APyFloatAccumulatorOption {});
-
-    if (!exp_bits.has_value() || !man_bits.has_value()) {
-        throw nb::value_error(
-            "Both the exponent bits and mantissa bits must be specified."
-        );
+    APyFloatAccumulatorOption new_mode {};
+
+    if (exact) {
+        // The products are accumulated exactly, so there is no accumulator format
+        if (exp_bits.has_value() || man_bits.has_value() || bias.has_value()) {
+            throw nb::value_error(
+                "The exponent bits, mantissa bits, and bias can not be specified for "
+                "an exact accumulator."
+            );
+        }
+        new_mode.exp_bits = 0;
+        new_mode.man_bits = 0;
+    } else {
+        if (!exp_bits.has_value() || !man_bits.has_value()) {
+            throw nb::value_error(
+                "Both the exponent bits and mantissa bits must be specified."
+            );
+        }
+
+        check_exponent_format(exp_bits.value());
+        check_mantissa_format(man_bits.value());
+
+        new_mode.exp_bits = exp_bits.value();
+        new_mode.man_bits = man_bits.value();
     }
-
-    check_exponent_format(exp_bits.value());
-    check_mantissa_format(man_bits.value());
-
-    new_mode.exp_bits = exp_bits.value();
-    new_mode.man_bits = man_bits.value();
     new_mode.bias = bias;
-    new_mode.quantization = quantization.value_or(get_float_quantization_mode());
+    new_mode.exact = exact;
 
-    // Set the current mode
+    // Set the current mode. An unspecified quantization mode is resolved on entry.
     current_mode = new_mode;
+    new_quantization = quantization;
 }
 
 void APyFloatAccumulatorContext::enter_context()
 {
+    // The previous state, and an unspecified quantization mode, are those of the
+    // entering thread
+    previous_mode = global_accumulator_option_float;
+    current_mode->quantization
+        = new_quantization.value_or(get_float_quantization_mode());
     global_accumulator_option_float = current_mode;
 }
 void APyFloatAccumulatorContext::exit_context()
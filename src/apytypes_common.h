@@ -80,22 +80,23 @@ public:
 
 private:
     QuantizationMode new_mode, prev_mode;
-    std::uint64_t new_seed, prev_seed;
+    std::optional<std::uint64_t> new_seed;
+    std::uint64_t prev_seed;
 };
 
-//! Set the global quantization mode for APyFloat
+//! Set the quantization mode for APyFloat of the calling thread
 void set_float_quantization_mode(QuantizationMode mode);
 
-//! Return the global quantization mode for APyFloat
+//! Return the quantization mode for APyFloat of the calling thread
 QuantizationMode get_float_quantization_mode();
 
-//! Set the global seed for stochastic quantization for APyFloat
+//! Set the seed for stochastic quantization for APyFloat of the calling thread
 void set_float_quantization_seed(std::uint64_t);
 
-//! Get the global seed for stochastic quantization for APyFloat
+//! Get the seed for stochastic quantization for APyFloat of the calling thread
 std::uint64_t get_float_quantization_seed();
 
-//! Return a random 64-bit number from the random number engine used for APyFloat
+//! Return a random 64-bit number from the calling thread's APyFloat random engine
 std::uint64_t random_number_float();
 
 using exp_t = std::uint32_t;
@@ -131,10 +132,12 @@ public:
     void exit_context() override;
 
 private:
+    std::optional<QuantizationMode> new_quantization;
+    std::optional<OverflowMode> new_overflow;
     APyFixedCastOption current_mode, previous_mode;
 };
 
-//! Return the global cast mode for APyFixed
+//! Return the cast mode for APyFixed of the calling thread
 APyFixedCastOption get_fixed_cast_mode();
 
 /* ********************************************************************************** *
@@ -167,7 +170,7 @@ private:
     std::optional<APyFixedAccumulatorOption> current_mode, previous_mode;
 };
 
-//! Return the global accumulator mode for APyFixed
+//! Return the accumulator mode for APyFixed of the calling thread
 std::optional<APyFixedAccumulatorOption> get_accumulator_mode_fixed();
 
 /* ********************************************************************************** *
@@ -180,6 +183,7 @@ struct APyFloatAccumulatorOption {
     std::uint8_t man_bits;
     std::optional<exp_t> bias;
     QuantizationMode quantization;
+    bool exact; //! Accumulate exactly and quantize once to the result format
 };
 
 // Accumulator context
@@ -189,16 +193,18 @@ public:
         std::optional<int> = std::nullopt,
         std::optional<int> = std::nullopt,
         std::optional<exp_t> = std::nullopt,
-        std::optional<QuantizationMode> quantization = std::nullopt
+        std::optional<QuantizationMode> quantization = std::nullopt,
+        bool exact = false
     );
     void enter_context() override;
     void exit_context() override;
 
 private:
     std::optional<APyFloatAccumulatorOption> current_mode, previous_mode;
+    std::optional<QuantizationMode> new_quantization;
 };
 
-//! Return the global accumulator mode for APyFloat
+//! Return the accumulator mode for APyFloat of the calling thread
 std::optional<APyFloatAccumulatorOption> get_accumulator_mode_float();
 
 #endif // _APYTYPES_COMMON_H
@@ -98,11 +98,13 @@ void bind_accumulator_context(nb::module_& m)
                 std::optional<int>,
                 std::optional<int>,
                 std::optional<exp_t>,
-                std::optional<QuantizationMode>>(),
+                std::optional<QuantizationMode>,
+                bool>(),
             nb::arg("exp_bits") = nb::none(),
             nb::arg("man_bits") = nb::none(),
             nb::arg("bias") = nb::none(),
-            nb::arg("quantization") = nb::none()
+            nb::arg("quantization") = nb::none(),
+            nb::arg("exact") = false
         )
         .def("__enter__", &context_enter_handler)
         .def(
@@ -0,0 +1,134 @@
+#include "apytypes_profiling.h"
+
+#include <atomic>        // std::atomic
+#include <chrono>        // std::chrono::steady_clock
+#include <memory>        // std::unique_ptr
+#include <mutex>         // std::mutex, std::lock_guard
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+std::atomic<bool> _profiling_enabled { false };
+
+thread_local std::uint64_t _profiling_thread_bytes = 0;
+
+/* ********************************************************************************** *
+ * *                                Counter registry                                * *
+ * ********************************************************************************** */
+
+//! Registered counters. Counters are never removed, so references stay valid.
+static std::mutex counters_mutex;
+static std::unordered_map<std::string, std::unique_ptr<APyKernelCounter>> counters;
+
+//! Recorded trace events
+static std::mutex trace_mutex;
+static std::vector<APyTraceEvent> trace_events;
+static std::atomic<bool> trace_enabled { false };
+static std::atomic<std::uint64_t> trace_start_ns { 0 };
+
+//! Small, sequential id of the calling thread, for readable trace output
+static std::uint64_t profiling_thread_id() noexcept
+{
+    static std::atomic<std::uint64_t> next_id { 1 };
+    static thread_local std::uint64_t id = next_id.fetch_add(1);
+    return id;
+}
+
+std::uint64_t profiling_now_ns() noexcept
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+void profiling_enable(bool trace)
+{
+    if (trace && !trace_enabled.load()) {
+        trace_start_ns.store(profiling_now_ns());
+    }
+    trace_enabled.store(trace);
+    _profiling_enabled.store(true);
+}
+
+void profiling_disable() noexcept
+{
+    _profiling_enabled.store(false);
+    trace_enabled.store(false);
+}
+
+bool profiling_is_enabled() noexcept { return _profiling_enabled.load(); }
+
+void profiling_reset()
+{
+    {
+        std::lock_guard<std::mutex> lock(counters_mutex);
+        for (auto& [name, counter] : counters) {
+            counter->calls.store(0, std::memory_order_relaxed);
+            counter->elements.store(0, std::memory_order_relaxed);
+            counter->bytes_allocated.store(0, std::memory_order_relaxed);
+            counter->ns.store(0, std::memory_order_relaxed);
+        }
+    }
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    trace_events.clear();
+    trace_start_ns.store(profiling_now_ns());
+}
+
+APyKernelCounter& profiling_counter(const char* name)
+{
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    auto& counter = counters[name];
+    if (!counter) {
+        counter = std::make_unique<APyKernelCounter>(name);
+    }
+    return *counter;
+}
+
+std::vector<APyKernelStats> profiling_stats()
+{
+    std::vector<APyKernelStats> result;
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    for (const auto& [name, counter] : counters) {
+        std::uint64_t calls = counter->calls.load(std::memory_order_relaxed);
+        if (calls) {
+            result.push_back({ name,
+                               calls,
+                               counter->elements.load(std::memory_order_relaxed),
+                               counter->bytes_allocated.load(std::memory_order_relaxed),
+                               counter->ns.load(std::memory_order_relaxed) });
+        }
+    }
+    return result;
+}
+
+std::vector<APyTraceEvent> profiling_trace_events()
+{
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    return trace_events;
+}
+
+void profiling_record(
+    APyKernelCounter& counter,
+    std::uint64_t start_ns,
+    std::uint64_t end_ns,
+    std::uint64_t elements,
+    std::uint64_t bytes_allocated
+)
+{
+    counter.calls.fetch_add(1, std::memory_order_relaxed);
+    counter.elements.fetch_add(elements, std::memory_order_relaxed);
+    counter.bytes_allocated.fetch_add(bytes_allocated, std::memory_order_relaxed);
+    counter.ns.fetch_add(end_ns - start_ns, std::memory_order_relaxed);
+
+    if (trace_enabled.load(std::memory_order_relaxed)) {
+        std::uint64_t origin = trace_start_ns.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        if (trace_events.size() < _PROFILING_MAX_TRACE_EVENTS) {
+            trace_events.push_back({ counter.name,
+                                     start_ns > origin ? start_ns - origin : 0,
+                                     end_ns - start_ns,
+                                     elements,
+                                     bytes_allocated,
+                                     profiling_thread_id() });
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Opt-in runtime instrumentation of the APyTypes kernel paths.
+ *
+ * Each instrumented kernel path (e.g., the single-limb SIMD path of fixed-point
+ * addition, or the scalar fallback of floating-point multiplication) has a named
+ * counter accumulating the number of calls, the number of elements processed, the
+ * number of bytes allocated from the pool allocator, and the time spent in the path.
+ * Optionally, every call is also recorded as a trace event, which can be exported in
+ * the Chrome trace event format.
+ *
+ * Profiling is disabled by default. When disabled, an instrumented path costs a single
+ * relaxed atomic load.
+ */
+
+#ifndef _APYTYPES_PROFILING_H
+#define _APYTYPES_PROFILING_H
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+//! Maximum number of trace events retained while tracing
+constexpr std::size_t _PROFILING_MAX_TRACE_EVENTS = std::size_t(1) << 20;
+
+//! Accumulated counters of a single kernel path
+struct APyKernelCounter {
+    const char* name;
+    std::atomic<std::uint64_t> calls { 0 };
+    std::atomic<std::uint64_t> elements { 0 };
+    std::atomic<std::uint64_t> bytes_allocated { 0 };
+    std::atomic<std::uint64_t> ns { 0 };
+
+    explicit APyKernelCounter(const char* counter_name) noexcept
+        : name { counter_name }
+    {
+    }
+};
+
+//! Snapshot of the counters of a single kernel path
+struct APyKernelStats {
+    std::string name;
+    std::uint64_t calls;
+    std::uint64_t elements;
+    std::uint64_t bytes_allocated;
+    std::uint64_t ns;
+};
+
+//! A single recorded call of a kernel path
+struct APyTraceEvent {
+    const char* name;
+    std::uint64_t start_ns; // Relative to when tracing was enabled
+    std::uint64_t duration_ns;
+    std::uint64_t elements;
+    std::uint64_t bytes_allocated;
+    std::uint64_t thread_id;
+};
+
+//! Global profiling switch. Read with relaxed ordering on every instrumented call.
+extern std::atomic<bool> _profiling_enabled;
+
+//! Bytes allocated from the pool allocator by the calling thread while profiling
+extern thread_local std::uint64_t _profiling_thread_bytes;
+
+//! Enable profiling. If `trace` is true, every call is also recorded as an event.
+void profiling_enable(bool trace);
+
+//! Disable profiling. Accumulated counters and events are kept.
+void profiling_disable() noexcept;
+
+//! Test if profiling is enabled
+bool profiling_is_enabled() noexcept;
+
+//! Reset all counters to zero and discard all recorded events
+void profiling_reset();
+
+//! Retrieve (registering on first use) the counter of the kernel path `name`. The
+//! returned reference remains valid for the lifetime of the module.
+APyKernelCounter& profiling_counter(const char* name);
+
+//! Retrieve a snapshot of all counters that have been called at least once
+std::vector<APyKernelStats> profiling_stats();
+
+//! Retrieve a copy of all recorded trace events
+std::vector<APyTraceEvent> profiling_trace_events();
+
+//! Monotonic clock in nanoseconds
+std::uint64_t profiling_now_ns() noexcept;
+
+//! Accumulate a finished call of a kernel path into its counter (and trace)
+void profiling_record(
+    APyKernelCounter& counter,
+    std::uint64_t start_ns,
+    std::uint64_t end_ns,
+    std::uint64_t elements,
+    std::uint64_t bytes_allocated
+);
+
+/*!
+ * RAII scope recording one call of a kernel path, from construction to destruction.
+ * Does nothing, apart from testing the global switch, when profiling is disabled.
+ */
+class APyProfileScope {
+public:
+    APyProfileScope(APyKernelCounter& counter, std::size_t elements) noexcept
+    {
+        if (_profiling_enabled.load(std::memory_order_relaxed)) {
+            _counter = &counter;
+            _elements = elements;
+            _start_bytes = _profiling_thread_bytes;
+            _start_ns = profiling_now_ns();
+        }
+    }
+
+    ~APyProfileScope()
+    {
+        if (_counter) {
+            profiling_record(
+                *_counter,
+                _start_ns,
+                profiling_now_ns(),
+                _elements,
+                _profiling_thread_bytes - _start_bytes
+            );
+        }
+    }
+
+    APyProfileScope(const APyProfileScope&) = delete;
+    APyProfileScope& operator=(const APyProfileScope&) = delete;
+
+private:
+    APyKernelCounter* _counter = nullptr;
+    std::uint64_t _elements = 0;
+    std::uint64_t _start_bytes = 0;
+    std::uint64_t _start_ns = 0;
+};
+
+#define _APY_PROFILE_CONCAT_IMPL(A, B) A##B
+#define _APY_PROFILE_CONCAT(A, B) _APY_PROFILE_CONCAT_IMPL(A, B)
+
+//! Record the remainder of the enclosing scope as one call of the kernel path `NAME`
+//! (a string literal), processing `ELEMENTS` elements.
+#define APY_PROFILE_SCOPE(NAME, ELEMENTS)                                              \
+    static APyKernelCounter& _APY_PROFILE_CONCAT(_apy_profile_counter_, __LINE__)      \
+        = profiling_counter(NAME);                                                     \
+    APyProfileScope _APY_PROFILE_CONCAT(_apy_profile_scope_, __LINE__)(                \
+        _APY_PROFILE_CONCAT(_apy_profile_counter_, __LINE__), (ELEMENTS)               \
+    )
+
+#endif // _APYTYPES_PROFILING_H
@@ -157,6 +157,23 @@ public:
     {
     }
 
+    ScratchVector(ScratchVector&& other) noexcept
+        : ScratchVector()
+    {
+        _size = other._size;
+        if (other._capacity > _N_SCRATCH_ELEMENTS) {
+            // Steal the heap allocation of `other` and leave it empty
+            _capacity = other._capacity;
+            _ptr = other._ptr;
+            other._size = 0;
+            other._capacity = _N_SCRATCH_ELEMENTS;
+            other._ptr = other._scratch_data.data();
+        } else {
+            _ptr = _scratch_data.data();
+            std::copy_n(std::begin(other), other._size, begin());
+        }
+    }
+
     ScratchVector(std::initializer_list<T> init)
         : ScratchVector(std::begin(init), std::end(init))
     {
@@ -190,6 +207,9 @@ public:
 
     ScratchVector& operator=(const ScratchVector& other)
     {
+        if (this == &other) {
+            return *this;
+        }
         return operator= <ScratchVector, true>(other);
     }
 
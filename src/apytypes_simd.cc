@@ -9,6 +9,9 @@
 #include <vector>
 
 #include "../extern/mini-gmp/mini-gmp.h"
+#include "apytypes_allocator.h"
+#include "apytypes_common.h"
+#include "apytypes_simd.h"
 #include "apytypes_util.h"
 
 namespace simd {
@@ -367,6 +370,356 @@ namespace HWY_NAMESPACE { // required: unique per target
         return sum;
     }
 
+    HWY_ATTR void _hwy_vector_prefix_sum(
+        mp_limb_t* HWY_RESTRICT data,
+        const std::size_t rows,
+        const std::size_t row_stride,
+        const std::size_t size
+    )
+    {
+        constexpr const hn::ScalableTag<mp_limb_t> d;
+        const std::size_t lanes = hn::Lanes(d);
+
+        if (size == 1 && row_stride == 1) {
+            // Contiguous elements. Each block of lanes is scanned in-register, in
+            // log2(lanes) steps, and the total of all previous blocks is added.
+            const std::size_t rows_simd = rows - rows % lanes;
+            auto carry = hn::Zero(d);
+            std::size_t i = 0;
+            for (; i < rows_simd; i += lanes) {
+                auto v = hn::LoadU(d, data + i);
+                for (std::size_t shift = 1; shift < lanes; shift <<= 1) {
+                    v = hn::Add(v, hn::SlideUpLanes(d, v, shift));
+                }
+                v = hn::Add(v, carry);
+                hn::StoreU(v, d, data + i);
+                carry = hn::Set(d, data[i + lanes - 1]);
+            }
+            mp_limb_t sum = i ? data[i - 1] : 0;
+            for (; i < rows; i++) {
+                sum += data[i];
+                data[i] = sum;
+            }
+            return;
+        }
+
+        // Independent lanes. Each row is added, lane-wise, to the next row.
+        const std::size_t size_simd = size - size % lanes;
+        for (std::size_t row = 1; row < rows; row++) {
+            const mp_limb_t* prev = data + (row - 1) * row_stride;
+            mp_limb_t* curr = data + row * row_stride;
+            std::size_t i = 0;
+            for (; i < size_simd; i += lanes) {
+                const auto v1 = hn::LoadU(d, prev + i);
+                const auto v2 = hn::LoadU(d, curr + i);
+                hn::StoreU(hn::Add(v1, v2), d, curr + i);
+            }
+            for (; i < size; i++) {
+                curr[i] += prev[i];
+            }
+        }
+    }
+
+    HWY_ATTR void _hwy_vector_sign_extend(
+        mp_limb_t* HWY_RESTRICT data,
+        unsigned bits,
+        const std::size_t stride,
+        const std::size_t count
+    )
+    {
+        const unsigned shift_amount = _LIMB_SIZE_BITS - bits;
+        if (stride == 1) {
+            constexpr const hn::ScalableTag<mp_limb_signed_t> d;
+            const std::size_t count_simd = count - count % hn::Lanes(d);
+            mp_limb_signed_t* signed_data = reinterpret_cast<mp_limb_signed_t*>(data);
+
+            std::size_t i = 0;
+            for (; i < count_simd; i += hn::Lanes(d)) {
+                const auto v = hn::ShiftLeftSame(
+                    hn::LoadU(d, signed_data + i), shift_amount
+                );
+                hn::StoreU(hn::ShiftRightSame(v, shift_amount), d, signed_data + i);
+            }
+            for (; i < count; i++) {
+                data[i] = mp_limb_signed_t(data[i] << shift_amount) >> shift_amount;
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < count * stride; i += stride) {
+            data[i] = mp_limb_signed_t(data[i] << shift_amount) >> shift_amount;
+        }
+    }
+
+    //! Lane-wise `quantize_mantissa` of `man` (with `bits_to_quantize` guard bits) for
+    //! the deterministic quantization modes. Returns the quantized mantissa before the
+    //! carry into the exponent is handled.
+    template <class D, class V = hn::VFromD<D>>
+    HWY_ATTR HWY_INLINE V _hwy_float_quantize_mantissa(
+        D d,
+        V man,
+        V sign,
+        unsigned bits_to_quantize,
+        std::uint64_t sticky_constant,
+        QuantizationMode quantization
+    )
+    {
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto G = hn::And(hn::ShiftRightSame(man, bits_to_quantize - 1), one);
+        const auto T = hn::IfThenElseZero(
+            hn::Ne(hn::And(man, hn::Set(d, sticky_constant)), zero), one
+        );
+        const auto res_man = hn::ShiftRightSame(man, bits_to_quantize);
+        switch (quantization) {
+        case QuantizationMode::RND_CONV: // TIES_EVEN
+            return hn::Add(res_man, hn::And(G, hn::Or(res_man, T)));
+        case QuantizationMode::RND_CONV_ODD: // TIES_ODD
+            return hn::Add(res_man, hn::And(G, hn::Or(hn::Xor(res_man, one), T)));
+        case QuantizationMode::TRN_INF: // TO_POSITIVE
+            return hn::Add(res_man, hn::AndNot(sign, hn::Or(G, T)));
+        case QuantizationMode::TRN: // TO_NEGATIVE
+            return hn::Add(res_man, hn::And(sign, hn::Or(G, T)));
+        case QuantizationMode::TRN_AWAY: // TO_AWAY
+            return hn::Add(res_man, hn::Or(G, T));
+        case QuantizationMode::TRN_MAG:
+            return hn::Add(res_man, sign);
+        case QuantizationMode::RND_INF: // TIES_AWAY
+            return hn::Add(res_man, G);
+        case QuantizationMode::RND_ZERO: // TIES_ZERO
+            return hn::Add(res_man, hn::And(G, T));
+        case QuantizationMode::RND: // TIES_POS
+            return hn::Add(res_man, hn::And(G, hn::Or(T, hn::Xor(sign, one))));
+        case QuantizationMode::RND_MIN_INF: // TIES_NEG
+            return hn::Add(res_man, hn::And(G, hn::Or(T, sign)));
+        case QuantizationMode::JAM:
+            return hn::Or(res_man, one);
+        case QuantizationMode::JAM_UNBIASED:
+            return hn::Or(res_man, hn::Or(G, T));
+        case QuantizationMode::TRN_ZERO: // TO_ZERO
+        default: // The stochastic modes are never vectorized
+            return res_man;
+        }
+    }
+
+    HWY_ATTR void _hwy_vector_float_mul(
+        FloatTile* HWY_RESTRICT tile, const std::size_t size, const FloatMulConstants& c
+    )
+    {
+        constexpr const hn::ScalableTag<std::uint64_t> d;
+        constexpr const hn::ScalableTag<std::int64_t> di;
+        const std::size_t size_simd = size - size % hn::Lanes(d);
+
+        const unsigned sum_man_bits = c.x_man_bits + c.y_man_bits;
+        const std::uint8_t res_man_bits = sum_man_bits + 2 - c.man_bits_delta;
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto x_max_exp = hn::Set(d, c.x_max_exp);
+        const auto y_max_exp = hn::Set(d, c.y_max_exp);
+        const auto res_max_exp = hn::Set(d, c.res_max_exp);
+        const auto x_leading_one = hn::Set(d, std::uint64_t(1) << c.x_man_bits);
+        const auto y_leading_one = hn::Set(d, std::uint64_t(1) << c.y_man_bits);
+        const auto two_before = hn::Set(d, std::uint64_t(1) << (sum_man_bits + 1));
+        const auto mask_two = hn::Set(d, (std::uint64_t(1) << (sum_man_bits + 2)) - 1);
+        const auto two_res = hn::Set(d, std::uint64_t(1) << res_man_bits);
+        const auto bias_sum = hn::Set(di, c.bias_sum);
+        const std::uint64_t sticky_constant
+            = (std::uint64_t(1) << (c.man_bits_delta - 1)) - 1;
+
+        std::size_t i = 0;
+        for (; i < size_simd; i += hn::Lanes(d)) {
+            const auto x_exp = hn::LoadU(d, tile->x_exp + i);
+            const auto y_exp = hn::LoadU(d, tile->y_exp + i);
+            const auto x_sign = hn::LoadU(d, tile->x_sign + i);
+            const auto y_sign = hn::LoadU(d, tile->y_sign + i);
+            const auto sign = hn::Xor(x_sign, y_sign);
+
+            // Zero, subnormal, NaN, and Inf operands are left to the scalar kernel
+            const auto is_special = hn::Or(
+                hn::Or(hn::Eq(x_exp, zero), hn::Eq(x_exp, x_max_exp)),
+                hn::Or(hn::Eq(y_exp, zero), hn::Eq(y_exp, y_max_exp))
+            );
+
+            // Multiply mantissas with leading ones. The product of two normal numbers
+            // is in [1, 4), so align it to the longer result.
+            const auto mx = hn::Or(hn::LoadU(d, tile->x_man + i), x_leading_one);
+            const auto my = hn::Or(hn::LoadU(d, tile->y_man + i), y_leading_one);
+            const auto product = hn::Mul(mx, my);
+            const auto is_two = hn::Ne(hn::And(product, two_before), zero);
+            auto man = hn::IfThenElse(
+                is_two, hn::ShiftLeft<1>(product), hn::ShiftLeft<2>(product)
+            );
+            man = hn::And(man, mask_two);
+
+            // Tentative exponent. Subnormal results are left to the scalar kernel.
+            const auto tmp_exp = hn::Add(
+                hn::Sub(hn::BitCast(di, hn::Add(x_exp, y_exp)), bias_sum),
+                hn::BitCast(di, hn::IfThenElseZero(is_two, one))
+            );
+            const auto is_subnormal
+                = hn::RebindMask(d, hn::Lt(tmp_exp, hn::Set(di, 1)));
+            auto exp = hn::BitCast(d, tmp_exp);
+
+            man = _hwy_float_quantize_mantissa(
+                d, man, sign, c.man_bits_delta, sticky_constant, c.quantization
+            );
+            const auto is_carry = hn::Ne(hn::And(man, two_res), zero);
+            exp = hn::Add(exp, hn::IfThenElseZero(is_carry, one));
+            man = hn::IfThenZeroElse(is_carry, man);
+
+            // Overflow is left to the scalar kernel
+            const auto fixup
+                = hn::Or(hn::Or(is_special, is_subnormal), hn::Ge(exp, res_max_exp));
+            hn::StoreU(sign, d, tile->res_sign + i);
+            hn::StoreU(exp, d, tile->res_exp + i);
+            hn::StoreU(man, d, tile->res_man + i);
+            hn::StoreU(hn::VecFromMask(d, fixup), d, tile->fixup + i);
+        }
+        for (; i < size; i++) {
+            tile->fixup[i] = 1;
+        }
+    }
+
+    HWY_ATTR void _hwy_vector_float_add(
+        FloatTile* HWY_RESTRICT tile, const std::size_t size, const FloatAddConstants& c
+    )
+    {
+        constexpr const hn::ScalableTag<std::uint64_t> d;
+        const std::size_t size_simd = size - size % hn::Lanes(d);
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto max_exp = hn::Set(d, c.max_exp);
+        const std::uint64_t final_res_leading_one = std::uint64_t(1) << c.man_bits;
+        const auto res_leading_one = hn::Set(d, final_res_leading_one << 3);
+        const auto carry_res_leading_one = hn::Set(d, final_res_leading_one << 4);
+        const auto man_mask = hn::Set(d, (final_res_leading_one << 4) - 1);
+        const auto final_leading_one = hn::Set(d, final_res_leading_one);
+        const auto max_shift = hn::Set(d, 63);
+
+        std::size_t i = 0;
+        for (; i < size_simd; i += hn::Lanes(d)) {
+            const auto x_sign = hn::LoadU(d, tile->x_sign + i);
+            const auto x_exp = hn::LoadU(d, tile->x_exp + i);
+            const auto x_man = hn::LoadU(d, tile->x_man + i);
+            const auto y_sign = hn::LoadU(d, tile->y_sign + i);
+            const auto y_exp = hn::LoadU(d, tile->y_exp + i);
+            const auto y_man = hn::LoadU(d, tile->y_man + i);
+
+            // Zero, subnormal, NaN, and Inf operands are left to the scalar kernel
+            const auto is_special = hn::Or(
+                hn::Or(hn::Eq(x_exp, zero), hn::Eq(x_exp, max_exp)),
+                hn::Or(hn::Eq(y_exp, zero), hn::Eq(y_exp, max_exp))
+            );
+
+            // Swap operands to make sure |a| >= |b|
+            const auto swap = hn::Or(
+                hn::Lt(x_exp, y_exp),
+                hn::And(hn::Eq(x_exp, y_exp), hn::Lt(x_man, y_man))
+            );
+            const auto a_sign = hn::IfThenElse(swap, y_sign, x_sign);
+            const auto a_exp = hn::IfThenElse(swap, y_exp, x_exp);
+            const auto a_man = hn::IfThenElse(swap, y_man, x_man);
+            const auto b_sign = hn::IfThenElse(swap, x_sign, y_sign);
+            const auto b_exp = hn::IfThenElse(swap, x_exp, y_exp);
+            const auto b_man = hn::IfThenElse(swap, x_man, y_man);
+
+            // Add leading ones and room for three guard bits, and align `b` to `a`.
+            // As `mb` is less than 2^63, a shift of 63 behaves as any larger shift.
+            const auto ma = hn::Or(res_leading_one, hn::ShiftLeft<3>(a_man));
+            const auto mb = hn::Or(res_leading_one, hn::ShiftLeft<3>(b_man));
+            const auto exp_delta = hn::Min(hn::Sub(a_exp, b_exp), max_shift);
+            const auto sticky = hn::Ne(
+                hn::And(mb, hn::Sub(hn::Shl(one, exp_delta), one)), zero
+            );
+            const auto mb_aligned
+                = hn::Or(hn::Shr(mb, exp_delta), hn::IfThenElseZero(sticky, one));
+
+            auto man = hn::IfThenElse(
+                hn::Eq(a_sign, b_sign), hn::Add(ma, mb_aligned), hn::Sub(ma, mb_aligned)
+            );
+
+            // Normalize. Cancellation is left to the scalar kernel.
+            const auto is_carry = hn::Ne(hn::And(man, carry_res_leading_one), zero);
+            const auto is_normal = hn::Ne(hn::And(man, res_leading_one), zero);
+            const auto is_cancellation = hn::Not(hn::Or(is_carry, is_normal));
+            auto exp = hn::Add(a_exp, hn::IfThenElseZero(is_carry, one));
+            man = hn::IfThenElse(is_carry, man, hn::ShiftLeft<1>(man));
+            man = hn::And(man, man_mask);
+
+            man = _hwy_float_quantize_mantissa(d, man, a_sign, 4, 7, c.quantization);
+            const auto is_round_carry = hn::Ne(hn::And(man, final_leading_one), zero);
+            exp = hn::Add(exp, hn::IfThenElseZero(is_round_carry, one));
+            man = hn::IfThenZeroElse(is_round_carry, man);
+
+            // Overflow is left to the scalar kernel
+            const auto fixup
+                = hn::Or(hn::Or(is_special, is_cancellation), hn::Ge(exp, max_exp));
+            hn::StoreU(a_sign, d, tile->res_sign + i);
+            hn::StoreU(exp, d, tile->res_exp + i);
+            hn::StoreU(man, d, tile->res_man + i);
+            hn::StoreU(hn::VecFromMask(d, fixup), d, tile->fixup + i);
+        }
+        for (; i < size; i++) {
+            tile->fixup[i] = 1;
+        }
+    }
+
+    HWY_ATTR void _hwy_vector_float_cast(
+        FloatTile* HWY_RESTRICT tile,
+        const std::size_t size,
+        const FloatCastConstants& c
+    )
+    {
+        constexpr const hn::ScalableTag<std::uint64_t> d;
+        constexpr const hn::ScalableTag<std::int64_t> di;
+        const std::size_t size_simd = size - size % hn::Lanes(d);
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto x_max_exp = hn::Set(d, c.x_max_exp);
+        const auto res_max_exp = hn::Set(d, c.res_max_exp);
+        const auto res_leading_one = hn::Set(d, std::uint64_t(1) << c.res_man_bits);
+        const auto bias_delta = hn::Set(di, c.bias_delta);
+        const std::uint64_t sticky_constant
+            = (std::uint64_t(1) << (c.man_bits_delta - 1)) - 1;
+
+        std::size_t i = 0;
+        for (; i < size_simd; i += hn::Lanes(d)) {
+            const auto x_sign = hn::LoadU(d, tile->x_sign + i);
+            const auto x_exp = hn::LoadU(d, tile->x_exp + i);
+            const auto x_man = hn::LoadU(d, tile->x_man + i);
+
+            // Zero, subnormal, NaN, and Inf operands are left to the scalar kernel
+            const auto is_special
+                = hn::Or(hn::Eq(x_exp, zero), hn::Eq(x_exp, x_max_exp));
+
+            // Rebias the exponent. Subnormal results are left to the scalar kernel.
+            const auto tmp_exp = hn::Add(hn::BitCast(di, x_exp), bias_delta);
+            const auto is_subnormal
+                = hn::RebindMask(d, hn::Lt(tmp_exp, hn::Set(di, 1)));
+            auto exp = hn::BitCast(d, tmp_exp);
+
+            auto man = _hwy_float_quantize_mantissa(
+                d, x_man, x_sign, c.man_bits_delta, sticky_constant, c.quantization
+            );
+            const auto is_carry = hn::Ne(hn::And(man, res_leading_one), zero);
+            exp = hn::Add(exp, hn::IfThenElseZero(is_carry, one));
+            man = hn::IfThenZeroElse(is_carry, man);
+
+            // Overflow is left to the scalar kernel
+            const auto fixup
+                = hn::Or(hn::Or(is_special, is_subnormal), hn::Ge(exp, res_max_exp));
+            hn::StoreU(x_sign, d, tile->res_sign + i);
+            hn::StoreU(exp, d, tile->res_exp + i);
+            hn::StoreU(man, d, tile->res_man + i);
+            hn::StoreU(hn::VecFromMask(d, fixup), d, tile->fixup + i);
+        }
+        for (; i < size; i++) {
+            tile->fixup[i] = 1;
+        }
+    }
+
     HWY_ATTR std::string _hwy_simd_version_str()
     {
         constexpr const hn::ScalableTag<mp_limb_t> d;
@@ -408,6 +761,11 @@ HWY_EXPORT(_hwy_vector_sub_const);
 HWY_EXPORT(_hwy_vector_rsub_const);
 HWY_EXPORT(_hwy_vector_rdiv_const_signed);
 HWY_EXPORT(_hwy_vector_multiply_accumulate);
+HWY_EXPORT(_hwy_vector_prefix_sum);
+HWY_EXPORT(_hwy_vector_sign_extend);
+HWY_EXPORT(_hwy_vector_float_mul);
+HWY_EXPORT(_hwy_vector_float_add);
+HWY_EXPORT(_hwy_vector_float_cast);
 
 std::string get_simd_version_str()
 {
@@ -415,9 +773,9 @@ std::string get_simd_version_str()
 }
 
 void vector_shift_add(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     unsigned src2_shift_amount,
     std::size_t size
@@ -434,9 +792,9 @@ void vector_shift_add(
 }
 
 void vector_shift_add_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 )
@@ -447,9 +805,9 @@ void vector_shift_add_const(
 }
 
 void vector_shift_sub(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     unsigned src2_shift_amount,
     std::size_t size
@@ -466,9 +824,9 @@ void vector_shift_sub(
 }
 
 void vector_shift_sub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 )
@@ -479,9 +837,9 @@ void vector_shift_sub_const(
 }
 
 void vector_shift_div_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 )
@@ -496,9 +854,9 @@ void vector_shift_div_signed(
 }
 
 void vector_shift_div_const_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 )
@@ -513,9 +871,9 @@ void vector_shift_div_const_signed(
 }
 
 void vector_mul(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -525,9 +883,9 @@ void vector_mul(
 }
 
 void vector_mul_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -537,9 +895,9 @@ void vector_mul_const(
 }
 
 void vector_add(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -549,9 +907,9 @@ void vector_add(
 }
 
 void vector_sub(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -561,9 +919,9 @@ void vector_sub(
 }
 
 void vector_add_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -573,9 +931,9 @@ void vector_add_const(
 }
 
 void vector_sub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -585,9 +943,9 @@ void vector_sub_const(
 }
 
 void vector_rsub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -597,9 +955,9 @@ void vector_rsub_const(
 }
 
 void vector_rdiv_const_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 )
 {
@@ -612,8 +970,8 @@ void vector_rdiv_const_signed(
 }
 
 mp_limb_t vector_multiply_accumulate(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
     std::size_t size
 )
 {
@@ -622,5 +980,45 @@ mp_limb_t vector_multiply_accumulate(
     );
 }
 
+void vector_prefix_sum(
+    APyLimbVector::iterator begin,
+    std::size_t rows,
+    std::size_t row_stride,
+    std::size_t size
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_prefix_sum)(
+        &*begin, rows, row_stride, size
+    );
+}
+
+void vector_sign_extend(
+    APyLimbVector::iterator begin, unsigned bits, std::size_t stride, std::size_t count
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_sign_extend)(&*begin, bits, stride, count);
+}
+
+bool float_quantization_is_vectorizable(QuantizationMode quantization) noexcept
+{
+    return quantization != QuantizationMode::STOCH_WEIGHTED
+        && quantization != QuantizationMode::STOCH_EQUAL;
+}
+
+void vector_float_mul(FloatTile& tile, std::size_t size, const FloatMulConstants& c)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_float_mul)(&tile, size, c);
+}
+
+void vector_float_add(FloatTile& tile, std::size_t size, const FloatAddConstants& c)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_float_add)(&tile, size, c);
+}
+
+void vector_float_cast(FloatTile& tile, std::size_t size, const FloatCastConstants& c)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_float_cast)(&tile, size, c);
+}
+
 } // namespace simd
 #endif // HWY_ONCE
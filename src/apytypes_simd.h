@@ -6,6 +6,8 @@
 #ifndef _APYTYPES_SIMD_H
 #define _APYTYPES_SIMD_H
 
+#include "apytypes_allocator.h"
+#include "apytypes_common.h"
 #include "apytypes_util.h"
 
 #include <string>
@@ -30,9 +32,9 @@ std::string get_simd_version_str();
  * * Add shifted values and store in `dst_begin`
  */
 void vector_shift_add(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     unsigned src2_shift_amount,
     std::size_t size
@@ -44,9 +46,9 @@ void vector_shift_add(
  * * Add shifted element to `constant` and store the result in `dst_begin`
  */
 void vector_shift_add_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 );
@@ -58,9 +60,9 @@ void vector_shift_add_const(
  * * Subtract shifted values and store in `dst_begin`
  */
 void vector_shift_sub(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     unsigned src2_shift_amount,
     std::size_t size
@@ -72,9 +74,9 @@ void vector_shift_sub(
  * * Subtract `constant` from shifted element and store the result in `dst_begin`
  */
 void vector_shift_sub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 );
@@ -86,9 +88,9 @@ void vector_shift_sub_const(
  *   result in `dst_begin`
  */
 void vector_shift_div_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 );
@@ -100,9 +102,9 @@ void vector_shift_div_signed(
  *   result in `dst_begin`
  */
 void vector_shift_div_const_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     unsigned src1_shift_amount,
     std::size_t size
 );
@@ -112,9 +114,9 @@ void vector_shift_div_const_signed(
  * and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_mul(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -123,9 +125,9 @@ void vector_mul(
  * and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_add(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -134,9 +136,9 @@ void vector_add(
  * and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_sub(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -145,9 +147,9 @@ void vector_sub(
  * and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_add_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -156,9 +158,9 @@ void vector_add_const(
  * and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_sub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -167,9 +169,9 @@ void vector_sub_const(
  * `constant` and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_mul_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -178,9 +180,9 @@ void vector_mul_const(
  * `src1_begin` and store the result in `dst_begin`, for `size` number of elements.
  */
 void vector_rsub_const(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -190,9 +192,9 @@ void vector_rsub_const(
  * * Store the result in `dst_begin`
  */
 void vector_rdiv_const_signed(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
+    APyLimbVector::const_iterator src1_begin,
     mp_limb_t constant,
-    std::vector<mp_limb_t>::iterator dst_begin,
+    APyLimbVector::iterator dst_begin,
     std::size_t size
 );
 
@@ -201,11 +203,142 @@ void vector_rdiv_const_signed(
  * for `size` number of elements. Return accumulated value.
  */
 mp_limb_t vector_multiply_accumulate(
-    std::vector<mp_limb_t>::const_iterator src1_begin,
-    std::vector<mp_limb_t>::const_iterator src2_begin,
+    APyLimbVector::const_iterator src1_begin,
+    APyLimbVector::const_iterator src2_begin,
     std::size_t size
 );
 
+/*!
+ * Inclusive prefix sum, in place, of `rows` rows of `size` elements starting at
+ * `begin`, with a distance of `row_stride` elements between consecutive rows, i.e.,
+ * each row is replaced by the sum of itself and all previous rows. If both `size` and
+ * `row_stride` are one, this is the prefix sum of `rows` contiguous elements, computed
+ * using in-register scans of blocks of elements.
+ */
+void vector_prefix_sum(
+    APyLimbVector::iterator begin,
+    std::size_t rows,
+    std::size_t row_stride,
+    std::size_t size
+);
+
+/*!
+ * Two's complement sign-extension, in place, of `count` limbs starting at `begin`,
+ * with a distance of `stride` limbs between consecutive limbs. Bit `bits - 1` of each
+ * limb is copied to all the bits above it. Contiguous limbs (`stride == 1`) are
+ * processed in SIMD registers.
+ */
+void vector_sign_extend(
+    APyLimbVector::iterator begin, unsigned bits, std::size_t stride, std::size_t count
+);
+
+/* ********************************************************************************** *
+ * *                     Vectorized floating-point arithmetic                       * *
+ * ********************************************************************************** */
+
+//! Number of elements in a `FloatTile`
+constexpr std::size_t _FLOAT_TILE_SIZE = 128;
+
+/*!
+ * Structure-of-arrays tile of floating-point operands and results, gathered from and
+ * scattered to the array-of-structures `APyFloatData` layout by the caller. A result
+ * lane with a non-zero `fixup` holds no valid result and must be recomputed by the
+ * scalar kernel (NaN, Inf, zero, and subnormal operands, subnormal results,
+ * cancellation, overflow, and the lanes past the vectorized part of the tile).
+ */
+struct FloatTile {
+    std::uint64_t x_sign[_FLOAT_TILE_SIZE];
+    std::uint64_t x_exp[_FLOAT_TILE_SIZE];
+    std::uint64_t x_man[_FLOAT_TILE_SIZE];
+    std::uint64_t y_sign[_FLOAT_TILE_SIZE];
+    std::uint64_t y_exp[_FLOAT_TILE_SIZE];
+    std::uint64_t y_man[_FLOAT_TILE_SIZE];
+    std::uint64_t res_sign[_FLOAT_TILE_SIZE];
+    std::uint64_t res_exp[_FLOAT_TILE_SIZE];
+    std::uint64_t res_man[_FLOAT_TILE_SIZE];
+    std::uint64_t fixup[_FLOAT_TILE_SIZE];
+
+    //! Gather `size` elements from `x` and `y` into the operand lanes
+    void load(const APyFloatData* x, const APyFloatData* y, std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            x_sign[i] = x[i].sign;
+            x_exp[i] = x[i].exp;
+            x_man[i] = x[i].man;
+            y_sign[i] = y[i].sign;
+            y_exp[i] = y[i].exp;
+            y_man[i] = y[i].man;
+        }
+    }
+
+    //! Gather `size` elements from `x` into the operand lanes of a unary operation
+    void load(const APyFloatData* x, std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i < size; i++) {
+            x_sign[i] = x[i].sign;
+            x_exp[i] = x[i].exp;
+            x_man[i] = x[i].man;
+        }
+    }
+
+    //! Retrieve result lane `i`
+    APyFloatData result(std::size_t i) const noexcept
+    {
+        return { bool(res_sign[i]), exp_t(res_exp[i]), man_t(res_man[i]) };
+    }
+};
+
+//! Test if `quantization` is supported by the vectorized floating-point kernels, i.e.,
+//! if it is deterministic
+bool float_quantization_is_vectorizable(QuantizationMode quantization) noexcept;
+
+//! Format constants of `vector_float_mul`
+struct FloatMulConstants {
+    std::uint8_t x_man_bits, y_man_bits;
+    exp_t x_max_exp, y_max_exp, res_max_exp;
+    std::int64_t bias_sum;        // `x_bias + y_bias - res_bias`
+    std::uint8_t man_bits_delta;  // `x_man_bits + y_man_bits + 2 - res_man_bits`
+    QuantizationMode quantization;
+};
+
+/*!
+ * Lane-wise floating-point multiplication of the normal numbers in the first `size`
+ * lanes of `tile`. Requires `x_man_bits + y_man_bits + 3` to fit in `man_t`. Same
+ * result as `APyFloatArray::hadamard_multiplication` for all lanes not marked for
+ * fixup.
+ */
+void vector_float_mul(FloatTile& tile, std::size_t size, const FloatMulConstants& c);
+
+//! Format constants of `vector_float_add`. Both operands and the result share format.
+struct FloatAddConstants {
+    std::uint8_t man_bits;
+    exp_t max_exp;
+    QuantizationMode quantization;
+};
+
+/*!
+ * Lane-wise floating-point addition of the normal numbers in the first `size` lanes of
+ * `tile`. Requires `man_bits + 5` to fit in `man_t`. Same result as
+ * `APyFloatArray::operator+` for all lanes not marked for fixup.
+ */
+void vector_float_add(FloatTile& tile, std::size_t size, const FloatAddConstants& c);
+
+//! Format constants of `vector_float_cast`
+struct FloatCastConstants {
+    exp_t x_max_exp, res_max_exp;
+    std::int64_t bias_delta;      // `res_bias - x_bias`
+    std::uint8_t res_man_bits;
+    std::uint8_t man_bits_delta;  // `x_man_bits - res_man_bits`, must be positive
+    QuantizationMode quantization;
+};
+
+/*!
+ * Lane-wise narrowing cast of the normal numbers in the first `size` lanes of `tile`
+ * to a format with fewer mantissa bits. Same result as `APyFloatArray::cast` for all
+ * lanes not marked for fixup.
+ */
+void vector_float_cast(FloatTile& tile, std::size_t size, const FloatCastConstants& c);
+
 /*
  * Functor export from functions
  */
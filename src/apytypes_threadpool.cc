@@ -0,0 +1,137 @@
+#include "apytypes_threadpool.h"
+
+#include <algorithm>          // std::find, std::min
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <memory>             // std::shared_ptr, std::make_shared
+#include <mutex>              // std::mutex, std::unique_lock
+#include <system_error>       // std::system_error
+#include <thread>             // std::thread
+
+#if !defined(_WIN32)
+#include <pthread.h> // pthread_atfork
+#endif
+
+//! A call of `thread_pool_run`, shared by the calling thread and the workers
+struct ThreadPoolJob {
+    ThreadPoolJob(std::size_t n_chunks, const std::function<void(std::size_t)>& fn)
+        : n_chunks { n_chunks }
+        , fn { fn }
+    {
+    }
+
+    const std::size_t n_chunks;
+    const std::function<void(std::size_t)>& fn;
+    std::size_t next_chunk = 0; // Next chunk to process, guarded by the pool mutex
+    std::size_t completed = 0;  // Number of completed chunks, guarded by the pool mutex
+};
+
+class ThreadPool {
+public:
+    //! See `thread_pool_run`
+    void run(
+        std::size_t n_chunks,
+        std::size_t max_workers,
+        const std::function<void(std::size_t)>& fn
+    )
+    {
+        auto job = std::make_shared<ThreadPoolJob>(n_chunks, fn);
+        {
+            std::unique_lock lock(mutex);
+            start_workers(std::min(n_chunks - 1, max_workers));
+            jobs.push_back(job);
+        }
+        work_available.notify_all();
+
+        // Process chunks until all of them are taken, then wait for the workers
+        process(job);
+        std::unique_lock lock(mutex);
+        job_completed.wait(lock, [&] { return job->completed == job->n_chunks; });
+    }
+
+private:
+    //! Start workers until there are at least `n`. If the system is out of threads,
+    //! the calling thread processes the chunks instead.
+    void start_workers(std::size_t n)
+    {
+        try {
+            for (; n_workers < n; n_workers++) {
+                std::thread([this] { worker(); }).detach();
+            }
+        } catch (const std::system_error&) {
+        }
+    }
+
+    //! Process the chunks of `job` until all of them are taken
+    void process(const std::shared_ptr<ThreadPoolJob>& job)
+    {
+        std::unique_lock lock(mutex);
+        while (job->next_chunk < job->n_chunks) {
+            const std::size_t chunk = job->next_chunk++;
+            if (job->next_chunk == job->n_chunks) {
+                // Last chunk taken, no more work for the workers in this job
+                auto it = std::find(jobs.begin(), jobs.end(), job);
+                if (it != jobs.end()) {
+                    jobs.erase(it);
+                }
+            }
+            lock.unlock();
+            job->fn(chunk);
+            lock.lock();
+            if (++job->completed == job->n_chunks) {
+                job_completed.notify_all();
+            }
+        }
+    }
+
+    [[noreturn]] void worker()
+    {
+        for (;;) {
+            std::shared_ptr<ThreadPoolJob> job;
+            {
+                std::unique_lock lock(mutex);
+                work_available.wait(lock, [&] { return !jobs.empty(); });
+                job = jobs.front();
+            }
+            process(job);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable work_available;
+    std::condition_variable job_completed;
+    std::deque<std::shared_ptr<ThreadPoolJob>> jobs; // Jobs with chunks left to take
+    std::size_t n_workers = 0;
+};
+
+//! The process-wide thread pool. It is never destroyed, as its detached workers may
+//! outlive all static objects at exit.
+static ThreadPool*& thread_pool()
+{
+    static ThreadPool* pool = [] {
+#if !defined(_WIN32)
+        // The workers do not survive a `fork()`. The pool of the parent is abandoned
+        // in the child, as its mutex may have been held by another thread.
+        pthread_atfork(nullptr, nullptr, [] { thread_pool() = new ThreadPool; });
+#endif
+        return new ThreadPool;
+    }();
+    return pool;
+}
+
+void thread_pool_run(
+    std::size_t n_chunks,
+    std::size_t max_workers,
+    const std::function<void(std::size_t)>& fn
+)
+{
+    if (n_chunks <= 1 || max_workers == 0) {
+        for (std::size_t chunk = 0; chunk < n_chunks; chunk++) {
+            fn(chunk);
+        }
+        return;
+    }
+    thread_pool()->run(n_chunks, max_workers, fn);
+}
@@ -0,0 +1,29 @@
+/*
+ * Persistent pool of worker threads for the parallel kernels (see `parallel_for` in
+ * `apytypes_util.h`).
+ *
+ * The workers are started on first use and are kept for the lifetime of the process,
+ * so a parallel kernel does not create and join threads on every call. Several threads
+ * may run parallel kernels at the same time, and a parallel kernel may be nested in a
+ * chunk of another: the calling thread processes all chunks not yet taken by a worker,
+ * so a call always completes, even if all workers are busy.
+ */
+
+#ifndef _APYTYPES_THREADPOOL_H
+#define _APYTYPES_THREADPOOL_H
+
+#include <cstddef>    // std::size_t
+#include <functional> // std::function
+
+/*!
+ * Call `fn(chunk)` for each `chunk` in `[0, n_chunks)` on the calling thread and on at
+ * most `max_workers` workers of the thread pool, and return once all calls have
+ * completed. `fn` must not throw.
+ */
+void thread_pool_run(
+    std::size_t n_chunks,
+    std::size_t max_workers,
+    const std::function<void(std::size_t)>& fn
+);
+
+#endif // _APYTYPES_THREADPOOL_H
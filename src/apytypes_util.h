@@ -8,11 +8,14 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
 
+#include "apytypes_threadpool.h"
 #include "fmt/format.h"
 
 #include <algorithm>        // std::find
 #include <cstddef>          // std::size_t
 #include <cstdint>          // int64_t
+#include <cstdlib>          // std::getenv, std::strtoul
+#include <exception>        // std::exception_ptr, std::rethrow_exception
 #include <functional>       // std::bit_not
 #include <initializer_list> // std::initializer_list
 #include <iomanip>          // std::setfill, std::setw
@@ -23,7 +26,9 @@
 #include <regex>            // std::regex, std::regex_replace
 #include <sstream>          // std::stringstream
 #include <string>           // std::string
+#include <thread>           // std::thread
 #include <tuple>            // std::tuple
+#include <utility>          // std::move
 #include <variant>          // std::variant
 #include <vector>           // std::vector
 
@@ -365,6 +370,101 @@ bcds_to_string(const std::vector<mp_limb_t> bcds)
     return ss.str();
 }
 
+//! Number of decimal digits in the largest power of ten fitting in a limb
+static constexpr std::size_t _LIMB_DEC_DIGITS = _LIMB_SIZE_BITS == 64 ? 19 : 9;
+
+//! Largest power of ten fitting in a limb, `10^_LIMB_DEC_DIGITS`
+static constexpr mp_limb_t _LIMB_DEC_BASE = static_cast<mp_limb_t>(
+    _LIMB_SIZE_BITS == 64 ? 10000000000000000000ULL : 1000000000ULL
+);
+
+//! Limb vectors with fewer limbs than this are converted to decimal directly with
+//! `mpn_get_str`. Longer limb vectors are first split on powers of ten.
+static constexpr std::size_t _DEC_CONV_SPLIT_LIMBS = 32;
+
+//! Lazily grown table of the powers `(10^_LIMB_DEC_DIGITS)^(2^k)`, used to split wide
+//! integers during binary-to-decimal conversion. Keeping the table alive between
+//! conversions avoids recomputing the powers for every converted number.
+class DecimalPowerTable {
+public:
+    //! Retrieve the power `(10^_LIMB_DEC_DIGITS)^(2^k)` as a normalized limb vector
+    const std::vector<mp_limb_t>& power(std::size_t k)
+    {
+        if (_powers.empty()) {
+            _powers.push_back({ _LIMB_DEC_BASE });
+        }
+        while (_powers.size() <= k) {
+            const std::vector<mp_limb_t>& prev = _powers.back();
+            std::vector<mp_limb_t> next(2 * prev.size());
+            mpn_sqr(&next[0], &prev[0], prev.size());
+            if (next.back() == 0) {
+                next.pop_back();
+            }
+            _powers.push_back(std::move(next));
+        }
+        return _powers[k];
+    }
+
+    //! Number of decimal digits of the remainder when dividing by `power(k)`
+    static std::size_t digits(std::size_t k) { return _LIMB_DEC_DIGITS << k; }
+
+private:
+    std::vector<std::vector<mp_limb_t>> _powers;
+};
+
+//! Retrieve the decimal power table of the calling thread
+[[maybe_unused, nodiscard]] static APY_INLINE DecimalPowerTable&
+thread_dec_power_table()
+{
+    static thread_local DecimalPowerTable table;
+    return table;
+}
+
+//! Append the decimal digits of the non-negative integer in limb vector [`np`,
+//! `np + n`) to `out`, left-padded with zeros to at least `min_digits` digits. Wide
+//! integers are divided by a power of ten with about half their length, and the
+//! quotient and remainder are converted recursively. The limb vector is destroyed.
+[[maybe_unused]] static APY_INLINE void limb_vector_to_dec_digits(
+    mp_limb_t* np,
+    std::size_t n,
+    std::size_t min_digits,
+    DecimalPowerTable& table,
+    std::string& out
+)
+{
+    while (n && np[n - 1] == 0) {
+        n--;
+    }
+
+    if (n < _DEC_CONV_SPLIT_LIMBS) {
+        // A limb has fewer than `_LIMB_DEC_DIGITS + 1` decimal digits
+        unsigned char digits[_DEC_CONV_SPLIT_LIMBS * (_LIMB_DEC_DIGITS + 1)];
+        std::size_t n_digits = n ? mpn_get_str(digits, 10, np, n) : 0;
+        if (n_digits < min_digits) {
+            out.append(min_digits - n_digits, '0');
+        }
+        for (std::size_t i = 0; i < n_digits; i++) {
+            out.push_back(char('0' + digits[i]));
+        }
+        return;
+    }
+
+    // Split on the largest power `power(k)` with `2^(k+2) <= n`, i.e., a divisor with
+    // at most half as many limbs as the dividend
+    std::size_t k = 0;
+    while ((std::size_t(4) << k) <= n) {
+        k++;
+    }
+    const std::vector<mp_limb_t>& divisor = table.power(k);
+    std::size_t low_digits = DecimalPowerTable::digits(k);
+    std::vector<mp_limb_t> quotient(n - divisor.size() + 1);
+    mpn_div_qr(&quotient[0], np, n, &divisor[0], divisor.size());
+
+    std::size_t high_digits = min_digits > low_digits ? min_digits - low_digits : 0;
+    limb_vector_to_dec_digits(&quotient[0], quotient.size(), high_digits, table, out);
+    limb_vector_to_dec_digits(np, divisor.size(), low_digits, table, out);
+}
+
 //! Reverse double-dabble algorithm for BCD->binary conversion
 [[maybe_unused, nodiscard]] static APY_INLINE std::vector<mp_limb_t>
 reverse_double_dabble(const std::vector<std::uint8_t>& bcd_list)
@@ -1132,6 +1232,41 @@ get_conv_lengths(const std::string& mode, const APY_ARRAY& a, const APY_ARRAY& b
     return { len, n_left, n_right };
 }
 
+/*!
+ * Get the shape of the result, and the geometry, of a cumulative function (e.g.,
+ * `cumsum`) along `axis` of an array with shape `shape`, or along the flattened array
+ * if no axis is given. The array is viewed as `sections` independent sections of
+ * `elements` rows along the axis, and each row has `stride` independent lanes. The
+ * result is returned in the order: shape, `sections`, `elements`, and `stride`.
+ * Throws a `nanobind::index_error` if `axis` is out of range.
+ */
+[[maybe_unused]] static APY_INLINE
+    std::tuple<std::vector<std::size_t>, std::size_t, std::size_t, std::size_t>
+    get_cumulative_geometry(
+        const std::vector<std::size_t>& shape,
+        std::optional<nanobind::int_> axis,
+        const char* type_name
+    )
+{
+    const std::size_t n_items = std::accumulate(
+        shape.begin(), shape.end(), std::size_t(1), std::multiplies {}
+    );
+    if (!axis.has_value()) {
+        return { { n_items }, 1, n_items, 1 };
+    }
+    const std::size_t _axis = std::size_t(axis.value());
+    if (_axis >= shape.size()) {
+        auto msg = fmt::format(
+            "specified axis outside number of dimensions in the {}", type_name
+        );
+        throw nanobind::index_error(msg.c_str());
+    }
+    const std::size_t elements = shape[_axis];
+    const std::size_t stride = strides_from_shape(shape)[_axis];
+    const std::size_t sections = elements * stride ? n_items / (elements * stride) : 0;
+    return { shape, sections, elements, stride };
+}
+
 //! Macro for creating a void-specialization state-less functor `FUNCTOR_NAME` from a
 //! function `FUNC_NAME`. The void-specialization functor allows template argument
 //! deduction to be performed once its function is called. Neat!
@@ -1147,4 +1282,109 @@ get_conv_lengths(const std::string& mode, const APY_ARRAY& a, const APY_ARRAY& b
 CREATE_FUNCTOR_FROM_FUNC(mpn_add_n_functor, mpn_add_n);
 CREATE_FUNCTOR_FROM_FUNC(mpn_sub_n_functor, mpn_sub_n);
 
+//! Minimum amount of work (in elements, or inner-product terms) for which a kernel
+//! releases the GIL. Below this, the cost of releasing and re-acquiring the GIL is
+//! comparable to the kernel itself.
+constexpr std::size_t _GIL_RELEASE_THRESHOLD = 4096;
+
+/*!
+ * Release the GIL for the remainder of the enclosing scope, if `work` reaches
+ * `_GIL_RELEASE_THRESHOLD` and the calling thread holds the GIL (it does not in nested
+ * kernel calls, nor without an initialized interpreter). The guarded scope must not
+ * access any Python objects, but may throw C++ exceptions, as the GIL is re-acquired
+ * before they propagate to nanobind.
+ */
+class APyGILRelease {
+public:
+    explicit APyGILRelease(std::size_t work)
+    {
+        if (work >= _GIL_RELEASE_THRESHOLD && Py_IsInitialized()
+            && PyGILState_Check()) {
+            _release.emplace();
+        }
+    }
+
+private:
+    std::optional<nanobind::gil_scoped_release> _release;
+};
+
+//! Minimum amount of work (in elementary operations, e.g., multiply-accumulates) per
+//! thread of a parallel kernel
+constexpr std::size_t _PARALLEL_WORK_PER_THREAD = std::size_t(1) << 16;
+
+//! Maximum number of threads of the parallel kernels. Set from the environment variable
+//! `APYTYPES_NUM_THREADS` if present, and to the hardware concurrency otherwise.
+[[maybe_unused]] static std::size_t parallel_max_threads()
+{
+    static const std::size_t max_threads = [] {
+        if (const char* env = std::getenv("APYTYPES_NUM_THREADS")) {
+            return std::max(std::size_t(std::strtoul(env, nullptr, 10)), std::size_t(1));
+        }
+        return std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+    }();
+    return max_threads;
+}
+
+/*!
+ * Call `fn(begin, end)` on a partition of `[0, n)` into contiguous chunks, one per
+ * thread. The number of threads is chosen from the total amount of `work` (see
+ * `_PARALLEL_WORK_PER_THREAD`), so small problems run on the calling thread only. The
+ * chunks are processed by the calling thread and the workers of the persistent thread
+ * pool (see `apytypes_threadpool.h`). `fn` is called concurrently, so it must
+ * not access Python objects, nor the thread-local quantization and accumulator
+ * contexts. An exception thrown by any chunk is rethrown on the calling thread.
+ */
+template <typename FUNC>
+[[maybe_unused]] static void parallel_for(std::size_t n, std::size_t work, FUNC&& fn)
+{
+    const std::size_t n_threads = std::min(
+        { parallel_max_threads(), n, work / _PARALLEL_WORK_PER_THREAD }
+    );
+    if (n_threads <= 1) {
+        fn(std::size_t(0), n);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(n_threads);
+    thread_pool_run(n_threads, n_threads - 1, [&](std::size_t chunk) {
+        try {
+            fn(n * chunk / n_threads, n * (chunk + 1) / n_threads);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+//! Number of lanes of each block of `cumulative_for_each_block`
+constexpr std::size_t _CUMULATIVE_BLOCK_LANES = 1024;
+
+/*!
+ * Call `fn(section, lane_begin, lane_end)` for each block of at most
+ * `_CUMULATIVE_BLOCK_LANES` lanes of each section of a cumulative function (see
+ * `get_cumulative_geometry`). The blocks are independent, and are distributed over
+ * threads based on the total amount of `work` (see `parallel_for`).
+ */
+template <typename FUNC>
+[[maybe_unused]] static void cumulative_for_each_block(
+    std::size_t sections, std::size_t stride, std::size_t work, FUNC&& fn
+)
+{
+    const std::size_t blocks
+        = (stride + _CUMULATIVE_BLOCK_LANES - 1) / _CUMULATIVE_BLOCK_LANES;
+    auto process_blocks = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t task = begin; task < end; task++) {
+            const std::size_t lane_begin = (task % blocks) * _CUMULATIVE_BLOCK_LANES;
+            const std::size_t lane_end
+                = std::min(lane_begin + _CUMULATIVE_BLOCK_LANES, stride);
+            fn(task / blocks, lane_begin, lane_end);
+        }
+    };
+    parallel_for(sections * blocks, work, process_blocks);
+}
+
 #endif // _APYTYPES_UTIL_H
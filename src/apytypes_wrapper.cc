@@ -1,5 +1,8 @@
+#include "apytypes_allocator.h"
 #include "apytypes_common.h"
+#include "apytypes_profiling.h"
 #include "apytypes_simd.h"
+#include "apytypes_util.h"
 #include <nanobind/nanobind.h>
 
 namespace nb = nanobind;
@@ -186,6 +189,9 @@ void bind_common(nb::module_& m)
          R"pbdoc(
         Set current quantization context.
 
+        The quantization mode is local to the calling thread. New threads start with
+        the default mode, :attr:`QuantizationMode.RND_CONV`.
+
         Parameters
         ----------
         mode : :class:`QuantizationMode`
@@ -214,7 +220,8 @@ void bind_common(nb::module_& m)
             R"pbdoc(
         Set current quantization seed.
 
-        The quantization seed is used for stochastic quantization.
+        The quantization seed is used for stochastic quantization. Each thread has its
+        own random number engine, which is seeded randomly on first use.
 
         Parameters
         ----------
@@ -241,5 +248,74 @@ void bind_common(nb::module_& m)
         )pbdoc")
 
         /* Get the APyTypes SIMD version string */
-        .def("_get_simd_version_str", &simd::get_simd_version_str);
+        .def("_get_simd_version_str", &simd::get_simd_version_str)
+
+        /* Get and reset the APyTypes pool allocator statistics */
+        .def(
+            "_get_allocator_stats",
+            []() {
+                APyAllocatorStats stats = get_allocator_stats();
+                nb::dict result;
+                result["hits"] = stats.hits;
+                result["misses"] = stats.misses;
+                result["oversized"] = stats.oversized;
+                result["cached"] = stats.cached;
+                result["released"] = stats.released;
+                return result;
+            },
+            R"pbdoc(
+        Retrieve statistics of the APyTypes array buffer allocator.
+
+        Array buffers and kernel scratch memories are allocated from 64-byte aligned
+        power-of-two size classes. Freed blocks are kept in a thread-local free-list
+        and reused by later allocations of the same size class.
+
+        Returns
+        -------
+        :class:`dict`
+            Counters for allocations served from a free-list (``hits``), pooled
+            allocations served by the system (``misses``), allocations too large to
+            be pooled (``oversized``), blocks returned to a free-list (``cached``),
+            and blocks returned to the system (``released``).
+        )pbdoc"
+        )
+        .def("_reset_allocator_stats", &reset_allocator_stats)
+
+        /* Kernel-path profiling, exposed through `apytypes.profiling` */
+        .def("_profiling_enable", &profiling_enable, nb::arg("trace") = false)
+        .def("_profiling_disable", &profiling_disable)
+        .def("_profiling_is_enabled", &profiling_is_enabled)
+        .def("_profiling_reset", &profiling_reset)
+        .def(
+            "_profiling_stats",
+            []() {
+                nb::dict result;
+                for (const auto& stats : profiling_stats()) {
+                    nb::dict counters;
+                    counters["calls"] = stats.calls;
+                    counters["elements"] = stats.elements;
+                    counters["bytes_allocated"] = stats.bytes_allocated;
+                    counters["ns"] = stats.ns;
+                    result[stats.name.c_str()] = counters;
+                }
+                return result;
+            }
+        )
+        .def("_profiling_trace_events", []() {
+            nb::list result;
+            for (const auto& event : profiling_trace_events()) {
+                result.append(nb::make_tuple(
+                    event.name,
+                    event.start_ns,
+                    event.duration_ns,
+                    event.elements,
+                    event.bytes_allocated,
+                    event.thread_id
+                ));
+            }
+            return result;
+        });
+
+    /* Size (in bytes) of the limbs returned by `APyFixedArray._limb_view` */
+    m.attr("_LIMB_SIZE_BYTES") = _LIMB_SIZE_BYTES;
 }
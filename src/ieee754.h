@@ -137,4 +137,86 @@
     d = type_pun_uint64_t_to_double(double_pun);
 }
 
+[[maybe_unused]] static APY_INLINE uint32_t type_pun_float_to_uint32_t(float f)
+{
+    // These functions are only compatible with IEEE-754 single-precision `float`s
+    static_assert(std::numeric_limits<float>::is_iec559);
+
+    uint32_t float_pun;
+    std::memcpy(&float_pun, &f, sizeof(float_pun));
+    return float_pun;
+}
+
+[[maybe_unused]] static APY_INLINE float type_pun_uint32_t_to_float(uint32_t num)
+{
+    // These functions are only compatible with IEEE-754 single-precision `float`s
+    static_assert(std::numeric_limits<float>::is_iec559);
+
+    float f;
+    std::memcpy(&f, &num, sizeof(f));
+    return f;
+}
+
+//! Exact conversion of an IEEE-754 binary16 bit pattern to `float`
+[[maybe_unused]] static APY_INLINE float binary16_to_float(uint16_t h)
+{
+    const uint32_t sign = uint32_t(h & 0x8000) << 16;
+    const uint32_t exp = (h >> 10) & 0x1F;
+    const uint32_t man = h & 0x3FF;
+    if (exp == 0) {
+        // Zero or subnormal: `man` units of 2^-24, exact in `float`
+        const float f = float(man) * 5.9604644775390625e-8f;
+        return type_pun_uint32_t_to_float(type_pun_float_to_uint32_t(f) | sign);
+    } else if (exp == 0x1F) {
+        // Inf or NaN
+        return type_pun_uint32_t_to_float(sign | 0x7F800000 | (man << 13));
+    } else {
+        return type_pun_uint32_t_to_float(sign | ((exp + 112) << 23) | (man << 13));
+    }
+}
+
+//! Conversion of a non-NaN `float` to the nearest IEEE-754 binary16 bit pattern, ties
+//! to even
+[[maybe_unused]] static APY_INLINE uint16_t float_to_binary16(float f)
+{
+    const uint32_t bits = type_pun_float_to_uint32_t(f);
+    const uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+    const uint32_t abs = bits & 0x7FFFFFFF;
+    if (abs >= 0x47800000) {
+        // At least 2^16: overflow to Inf
+        return sign | 0x7C00;
+    } else if (abs >= 0x38800000) {
+        // Normal binary16: rebias the exponent and round away 13 mantissa bits. A carry
+        // out of the mantissa correctly increments the exponent (possibly into Inf).
+        const uint32_t rounding = 0xFFF + ((abs >> 13) & 1);
+        return sign | uint16_t((abs - 0x38000000 + rounding) >> 13);
+    } else if (abs >= 0x33000000) {
+        // Subnormal binary16, in units of 2^-24. Rounding into the smallest normal
+        // number results in the correct bit pattern.
+        const uint32_t man = (abs & 0x7FFFFF) | 0x800000;
+        const unsigned shift = 126 - (abs >> 23);
+        const uint32_t half = uint32_t(1) << (shift - 1);
+        const uint32_t rest = man & ((half << 1) - 1);
+        uint32_t res = man >> shift;
+        res += (rest > half) || (rest == half && (res & 1));
+        return sign | uint16_t(res);
+    } else {
+        // At most 2^-25: round to zero
+        return sign;
+    }
+}
+
+//! Exact conversion of a bfloat16 bit pattern to `float`
+[[maybe_unused]] static APY_INLINE float bfloat16_to_float(uint16_t b)
+{
+    return type_pun_uint32_t_to_float(uint32_t(b) << 16);
+}
+
+//! Conversion of a non-NaN `float` to the nearest bfloat16 bit pattern, ties to even
+[[maybe_unused]] static APY_INLINE uint16_t float_to_bfloat16(float f)
+{
+    const uint32_t bits = type_pun_float_to_uint32_t(f);
+    return uint16_t((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
 #endif // _CXX_IEEE754_FIDDLE